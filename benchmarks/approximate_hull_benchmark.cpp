@@ -0,0 +1,53 @@
+/**
+ * @file benchmarks/approximate_hull_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры приближённой выпуклой оболочки.
+ */
+
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+
+/**
+ * @brief Сравнение geometry::ApproximateConvexHull() с
+ * geometry::GrahamScan().
+ *
+ * @param options Параметры запуска.
+ *
+ * Точки распределены нормально. Приближённая оболочка строится с
+ * относительной погрешностью \f$ 10^{-3} \f$. Кроме времени выводится
+ * скорость приближённого алгоритма в миллионах точек в секунду.
+ */
+void ApproximateHullBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("approximate_hull: seconds, normal distribution",
+              {"points", "graham", "approximate", "speedup", "Mpoints/s"});
+
+  std::mt19937 gen(1);
+  std::normal_distribution<double> coordDist(0.0, 1000.0);
+  geometry::AdaptiveOrientationPolicy orientation;
+  const std::size_t strips = geometry::ApproximateHullStrips(1e-3);
+
+  for (std::size_t size : options.Sizes()) {
+    std::vector<Point<double>> points(size);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    double graham = MeasureSeconds([]() { }, [&]() {
+      geometry::GrahamScan(points, orientation);
+    }, options.repetitions);
+
+    double approximate = MeasureSeconds([]() { }, [&]() {
+      geometry::ApproximateConvexHull(points, strips, orientation);
+    }, options.repetitions);
+
+    PrintRow(size, {graham, approximate, graham / approximate,
+                    size / approximate / 1e6});
+  }
+}
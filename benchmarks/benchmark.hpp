@@ -0,0 +1,100 @@
+/**
+ * @file benchmarks/benchmark.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Заголовочный файл для объявлений наборов замеров.
+ */
+
+#ifndef BENCHMARKS_BENCHMARK_HPP_
+#define BENCHMARKS_BENCHMARK_HPP_
+
+#include "benchmark_core.hpp"
+
+/* Сюда нужно добавить объявления наборов замеров. */
+
+/**
+ * @brief Сравнение geometry::RadixSort() с std::sort().
+ *
+ * @param options Параметры запуска.
+ */
+void PointSortBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Сравнение geometry::ConvexLayers() с повторным вызовом
+ * geometry::GrahamScan().
+ *
+ * @param options Параметры запуска.
+ */
+void ConvexLayersBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Сравнение geometry::ApproximateConvexHull() с
+ * geometry::GrahamScan().
+ *
+ * @param options Параметры запуска.
+ */
+void ApproximateHullBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Стоимость обновления geometry::SlidingWindowConvexHull.
+ *
+ * @param options Параметры запуска.
+ */
+void SlidingWindowBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Сравнение geometry::WindingNumberPointInPolygon() с
+ * geometry::AnglePointInPolygon().
+ *
+ * @param options Параметры запуска.
+ */
+void PointInPolygonBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Замер geometry::PreparedPolygon на больших наборах точек.
+ *
+ * @param options Параметры запуска.
+ */
+void PointInPolygonBatchBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Сравнение geometry::PreparedPolygon для выпуклых многоугольников
+ * с geometry::WindingNumberPointInPolygon().
+ *
+ * @param options Параметры запуска.
+ */
+void ConvexPointInPolygonBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Сравнение geometry::PolygonLocator с
+ * geometry::AnglePointInPolygon().
+ *
+ * @param options Параметры запуска.
+ */
+void PolygonLocatorBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Сравнение geometry::PolygonGrid с geometry::PreparedPolygon.
+ *
+ * @param options Параметры запуска.
+ */
+void PolygonGridBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Сравнение geometry::PolygonSet с перебором многоугольников.
+ *
+ * @param options Параметры запуска.
+ */
+void PolygonSetBenchmark(const BenchmarkOptions& options);
+
+/**
+ * @brief Время TriangulateMonotonePolygon() в зависимости от количества
+ * вершин.
+ *
+ * @param options Параметры запуска.
+ */
+void MonotoneTriangulationBenchmark(const BenchmarkOptions& options);
+
+/* Конец вставки. */
+
+#endif  // BENCHMARKS_BENCHMARK_HPP_
@@ -0,0 +1,106 @@
+/**
+ * @file benchmarks/benchmark_core.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Вспомогательные функции для измерения времени работы алгоритмов.
+ */
+
+#ifndef BENCHMARKS_BENCHMARK_CORE_HPP_
+#define BENCHMARKS_BENCHMARK_CORE_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Параметры запуска наборов замеров.
+ */
+struct BenchmarkOptions {
+  //! Минимальный размер входных данных.
+  std::size_t minSize = 100000;
+  //! Максимальный размер входных данных.
+  std::size_t maxSize = 10000000;
+  //! Количество повторов каждого замера.
+  int repetitions = 3;
+
+  /**
+   * @brief Получить размеры входных данных.
+   * @return Функция возвращает степени 10 от minSize до maxSize.
+   */
+  std::vector<std::size_t> Sizes() const {
+    std::vector<std::size_t> sizes;
+
+    for (std::size_t size = minSize; size <= maxSize; size *= 10)
+      sizes.push_back(size);
+
+    return sizes;
+  }
+};
+
+/**
+ * @brief Измерить время работы функции.
+ *
+ * @tparam Prepare Тип функции подготовки данных.
+ * @tparam Run Тип измеряемой функции.
+ * @param prepare Функция подготовки данных (время не учитывается).
+ * @param run Измеряемая функция.
+ * @param repetitions Количество повторов.
+ * @return Функция возвращает минимальное по всем повторам время в секундах.
+ */
+template<typename Prepare, typename Run>
+double MeasureSeconds(Prepare prepare, Run run, int repetitions) {
+  double best = std::numeric_limits<double>::infinity();
+
+  for (int i = 0; i < repetitions; i++) {
+    prepare();
+
+    auto start = std::chrono::steady_clock::now();
+
+    run();
+
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    best = std::min(best, elapsed.count());
+  }
+
+  return best;
+}
+
+/**
+ * @brief Напечатать заголовок таблицы результатов.
+ *
+ * @param name Название набора замеров.
+ * @param columns Названия столбцов.
+ */
+inline void PrintHeader(const std::string& name,
+                        const std::vector<std::string>& columns) {
+  std::printf("\n%s\n", name.c_str());
+
+  for (const std::string& column : columns)
+    std::printf("%14s", column.c_str());
+
+  std::printf("\n");
+}
+
+/**
+ * @brief Напечатать строку таблицы результатов.
+ *
+ * @param size Размер входных данных.
+ * @param values Значения столбцов, кроме первого.
+ */
+inline void PrintRow(std::size_t size, const std::vector<double>& values) {
+  std::printf("%14zu", size);
+
+  for (double value : values)
+    std::printf("%14.4f", value);
+
+  std::printf("\n");
+  std::fflush(stdout);
+}
+
+#endif  // BENCHMARKS_BENCHMARK_CORE_HPP_
@@ -0,0 +1,90 @@
+/**
+ * @file benchmarks/convex_layers_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры разбиения точек на выпуклые слои.
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <convex_layers.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+
+/**
+ * @brief Разбить точки на слои повторным вызовом GrahamScan().
+ *
+ * @param points Точки.
+ * @return Функция возвращает количество слоёв.
+ *
+ * Так слои строит клиент без ConvexLayers(): оболочка оставшихся точек
+ * вычисляется заново, после чего её вершины удаляются.
+ */
+static std::size_t NaiveLayers(std::vector<Point<double>> points) {
+  geometry::AdaptiveOrientationPolicy orientation;
+  std::size_t numLayers = 0;
+
+  while (!points.empty()) {
+    std::vector<Point<double>> hull = geometry::GrahamScan(points,
+                                                           orientation);
+
+    std::sort(hull.begin(), hull.end());
+
+    points.erase(std::remove_if(points.begin(), points.end(),
+                                [&hull](const Point<double>& point) {
+                                  return std::binary_search(hull.begin(),
+                                                            hull.end(),
+                                                            point);
+                                }),
+                 points.end());
+    numLayers++;
+  }
+
+  return numLayers;
+}
+
+/**
+ * @brief Сравнение geometry::ConvexLayers() с повторным вызовом
+ * geometry::GrahamScan().
+ *
+ * @param options Параметры запуска.
+ *
+ * Точки равномерно распределены в квадрате, количество слоёв растёт как
+ * \f$ n^{2/3} \f$. Размеры больше \f$ 10^5 \f$ не замеряются: наивный
+ * способ на них работает минуты.
+ */
+void ConvexLayersBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("convex_layers: seconds, uniform points in a square",
+              {"points", "layers", "naive", "ConvexLayers", "speedup"});
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+
+  for (std::size_t size : {1000, 10000, 100000}) {
+    if (size > options.maxSize)
+      break;
+
+    std::vector<Point<double>> points(size);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    std::size_t numLayers = 0;
+
+    double naive = MeasureSeconds([]() { }, [&]() {
+      numLayers = NaiveLayers(points);
+    }, options.repetitions);
+
+    double layers = MeasureSeconds([]() { }, [&]() {
+      geometry::ConvexLayers(points);
+    }, options.repetitions);
+
+    PrintRow(size, {static_cast<double>(numLayers), naive, layers,
+                    naive / layers});
+  }
+}
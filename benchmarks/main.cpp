@@ -0,0 +1,69 @@
+/**
+ * @file benchmarks/main.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Файл с функцией main() для замеров производительности.
+ *
+ * Использование: geometry_benchmark [набор] [максимальный размер].
+ * По-умолчанию запускаются все наборы для размеров до 10^7.
+ */
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include "benchmark.hpp"
+
+int main(int argc, char* argv[]) {
+  /* Сюда нужно добавить наборы замеров. */
+
+  const std::map<std::string, void (*)(const BenchmarkOptions&)> benchmarks = {
+    {"approximate_hull", ApproximateHullBenchmark},
+    {"convex_layers", ConvexLayersBenchmark},
+    {"convex_point_in_polygon", ConvexPointInPolygonBenchmark},
+    {"monotone_triangulation", MonotoneTriangulationBenchmark},
+    {"point_in_polygon", PointInPolygonBenchmark},
+    {"point_in_polygon_batch", PointInPolygonBatchBenchmark},
+    {"point_sort", PointSortBenchmark},
+    {"polygon_grid", PolygonGridBenchmark},
+    {"polygon_locator", PolygonLocatorBenchmark},
+    {"polygon_set", PolygonSetBenchmark},
+    {"sliding_window", SlidingWindowBenchmark}
+  };
+
+  /* Конец вставки. */
+
+  BenchmarkOptions options;
+  std::string name = "all";
+
+  if (argc >= 2)
+    name = argv[1];
+
+  if (argc >= 3) {
+    if (std::sscanf(argv[2], "%zu", &options.maxSize) != 1)
+      return -1;
+  }
+
+  if (name == "all") {
+    for (const auto& [benchmarkName, benchmark] : benchmarks)
+      benchmark(options);
+
+    return 0;
+  }
+
+  auto it = benchmarks.find(name);
+
+  if (it == benchmarks.end()) {
+    std::fprintf(stderr, "Unknown benchmark '%s'. Available:", name.c_str());
+
+    for (const auto& benchmark : benchmarks)
+      std::fprintf(stderr, " %s", benchmark.first.c_str());
+
+    std::fprintf(stderr, "\n");
+
+    return -1;
+  }
+
+  it->second(options);
+
+  return 0;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file benchmarks/monotone_triangulation_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры триангуляции монотонного многоугольника.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <monotone_polygone_triangulation.hpp>
+#include "benchmark.hpp"
+
+/**
+ * @brief Время TriangulateMonotonePolygon() в зависимости от количества
+ * вершин.
+ *
+ * @param options Параметры запуска.
+ *
+ * Многоугольник монотонен по \f$ Y \f$: вершины левой и правой цепей
+ * чередуются по высоте, а их удаление от оси --- случайное, поэтому
+ * примерно половина вершин невыпуклые. Столбец seconds --- время
+ * триангуляции, per_vertex --- время на одну вершину в наносекундах
+ * (для линейного алгоритма не зависит от размера), triangles ---
+ * количество треугольников (должно быть \f$ n - 2 \f$).
+ */
+void MonotoneTriangulationBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("monotone_triangulation: zigzag y-monotone polygon",
+              {"vertices", "seconds", "per_vertex", "triangles"});
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> widthDist(1.0, 100.0);
+
+  for (std::size_t size = 1000; size <= options.maxSize; size *= 10) {
+    std::vector<geometry::Point<double>> polygon;
+
+    polygon.reserve(size);
+    polygon.emplace_back(0.0, static_cast<double>(size));
+
+    // Левая цепь сверху вниз, затем правая снизу вверх.
+    for (std::size_t i = 1; i < size - 1; i += 2)
+      polygon.emplace_back(-widthDist(gen), static_cast<double>(size - i));
+
+    polygon.emplace_back(0.0, 0.0);
+
+    for (std::size_t i = size - 2 - (size % 2); i >= 2; i -= 2)
+      polygon.emplace_back(widthDist(gen), static_cast<double>(size - i));
+
+    std::vector<uint32_t> triangles;
+
+    double seconds = MeasureSeconds([]() { }, [&]() {
+      triangles = geometry::TriangulateMonotonePolygon(polygon);
+    }, options.repetitions);
+
+    PrintRow(polygon.size(), {seconds, seconds / polygon.size() * 1e9,
+                              static_cast<double>(triangles.size() / 3)});
+  }
+}
@@ -0,0 +1,243 @@
+/**
+ * @file benchmarks/point_in_polygon_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры определения положения точек относительно многоугольника.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <angle_point_in_polygon.hpp>
+#include <point_in_polygon.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+using geometry::CyclicVector;
+
+/**
+ * @brief Сравнение geometry::WindingNumberPointInPolygon() с
+ * geometry::AnglePointInPolygon().
+ *
+ * @param options Параметры запуска.
+ *
+ * Многоугольник --- звёздный с \f$ n \f$ вершинами, хранящимися в
+ * CyclicVector и в std::list (angle_list), точки равномерно
+ * распределены в его ограничивающем квадрате. Количество точек подобрано
+ * так, чтобы всего обрабатывалось около \f$ 10^7 \f$ рёбер. Время в
+ * наносекундах на ребро, mismatches --- количество точек, для которых
+ * результаты различаются.
+ */
+void PointInPolygonBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("point_in_polygon: nanoseconds per edge, star polygon",
+              {"vertices", "angle", "angle_list", "winding", "speedup",
+               "mismatches"});
+
+  const std::size_t totalEdges = 10000000;
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
+  std::uniform_real_distribution<double> radiusDist(500.0, 1000.0);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+
+  for (std::size_t size = 16; size <= std::min<std::size_t>(options.maxSize,
+                                                            65536);
+       size *= 16) {
+    std::vector<double> angles(size);
+
+    for (double& angle : angles)
+      angle = angleDist(gen);
+
+    std::sort(angles.rbegin(), angles.rend());
+
+    CyclicVector<Point<double>> vertices;
+
+    for (double angle : angles) {
+      double radius = radiusDist(gen);
+
+      vertices.emplace_back(radius * std::cos(angle),
+                            radius * std::sin(angle));
+    }
+
+    geometry::Polygon<double, std::list<Point<double>>> listPolygon(
+        std::list<Point<double>>(vertices.begin(), vertices.end()));
+    geometry::Polygon<double, CyclicVector<Point<double>>> polygon(
+        std::move(vertices));
+    std::vector<Point<double>> points(std::max<std::size_t>(totalEdges / size,
+                                                            1));
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    std::vector<geometry::PointPosition> angleResults(points.size());
+    std::vector<geometry::PointPosition> windingResults(points.size());
+
+    double angle = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < points.size(); i++)
+        angleResults[i] = geometry::AnglePointInPolygon(points[i], polygon);
+    }, options.repetitions);
+
+    double angleList = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < points.size(); i++)
+        angleResults[i] = geometry::AnglePointInPolygon(points[i],
+                                                        listPolygon);
+    }, options.repetitions);
+
+    double winding = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < points.size(); i++)
+        windingResults[i] = geometry::WindingNumberPointInPolygon(points[i],
+                                                                  polygon);
+    }, options.repetitions);
+
+    std::size_t mismatches = 0;
+
+    for (std::size_t i = 0; i < points.size(); i++)
+      mismatches += angleResults[i] != windingResults[i];
+
+    const double edges = static_cast<double>(points.size() * size);
+
+    PrintRow(size, {angle / edges * 1e9, angleList / edges * 1e9,
+                    winding / edges * 1e9,
+                    angle / winding, static_cast<double>(mismatches)});
+  }
+}
+
+/**
+ * @brief Замер geometry::PreparedPolygon на больших наборах точек.
+ *
+ * @param options Параметры запуска.
+ *
+ * Многоугольник --- звёздный со 100 вершинами. Сравниваются вызовы
+ * geometry::WindingNumberPointInPolygon() для каждой точки и
+ * geometry::PreparedPolygon::Classify() в одном потоке и в потоках по
+ * количеству ядер. Время в секундах.
+ */
+void PointInPolygonBatchBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("point_in_polygon_batch: seconds, star polygon with 100 "
+              "vertices",
+              {"points", "single", "prepared", "parallel", "speedup"});
+
+  const std::size_t numVertices = 100;
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
+  std::uniform_real_distribution<double> radiusDist(500.0, 1000.0);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+
+  std::vector<double> angles(numVertices);
+
+  for (double& angle : angles)
+    angle = angleDist(gen);
+
+  std::sort(angles.rbegin(), angles.rend());
+
+  CyclicVector<Point<double>> vertices;
+
+  for (double angle : angles) {
+    double radius = radiusDist(gen);
+
+    vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+  }
+
+  geometry::Polygon<double, CyclicVector<Point<double>>> polygon(
+      std::move(vertices));
+
+  for (std::size_t size : options.Sizes()) {
+    std::vector<Point<double>> points(size);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    std::vector<geometry::PointPosition> positions(size);
+
+    double single = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < size; i++)
+        positions[i] = geometry::WindingNumberPointInPolygon(points[i],
+                                                             polygon);
+    }, options.repetitions);
+
+    double prepared = MeasureSeconds([]() { }, [&]() {
+      positions = geometry::PreparedPolygon<double>(polygon).Classify(points,
+                                                                      1);
+    }, options.repetitions);
+
+    double parallel = MeasureSeconds([]() { }, [&]() {
+      positions = geometry::PreparedPolygon<double>(polygon).Classify(points);
+    }, options.repetitions);
+
+    PrintRow(size, {single, prepared, parallel, single / parallel});
+  }
+}
+
+/**
+ * @brief Сравнение geometry::PreparedPolygon для выпуклых многоугольников
+ * с geometry::WindingNumberPointInPolygon().
+ *
+ * @param options Параметры запуска.
+ *
+ * Многоугольник --- правильный с \f$ n \f$ вершинами, точки равномерно
+ * распределены в его ограничивающем квадрате. Время одного запроса в
+ * наносекундах (в одном потоке), mismatches --- количество точек, для
+ * которых результаты различаются.
+ */
+void ConvexPointInPolygonBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("convex_point_in_polygon: nanoseconds per point, regular "
+              "polygon",
+              {"vertices", "winding", "convex", "speedup", "mismatches"});
+
+  const std::size_t totalEdges = 10000000;
+  const std::size_t numQueries = 1000000;
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+
+  for (std::size_t size = 16; size <= std::min<std::size_t>(options.maxSize,
+                                                            65536);
+       size *= 16) {
+    CyclicVector<Point<double>> vertices;
+
+    for (std::size_t i = 0; i < size; i++) {
+      const double angle = -2.0 * M_PI * i / size;
+
+      vertices.emplace_back(1000.0 * std::cos(angle),
+                            1000.0 * std::sin(angle));
+    }
+
+    geometry::Polygon<double, CyclicVector<Point<double>>> polygon(
+        std::move(vertices));
+    std::vector<Point<double>> points(numQueries);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    const std::size_t numWindingQueries = std::clamp<std::size_t>(
+        totalEdges / size, 1, numQueries);
+    const geometry::PreparedPolygon<double> prepared(polygon);
+    std::vector<geometry::PointPosition> windingResults(numWindingQueries);
+    std::vector<geometry::PointPosition> convexResults;
+
+    double winding = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < numWindingQueries; i++)
+        windingResults[i] = geometry::WindingNumberPointInPolygon(points[i],
+                                                                  polygon);
+    }, options.repetitions) / numWindingQueries;
+
+    double convex = MeasureSeconds([]() { }, [&]() {
+      convexResults = prepared.Classify(points, 1);
+    }, options.repetitions) / numQueries;
+
+    std::size_t mismatches = !prepared.IsConvex();
+
+    for (std::size_t i = 0; i < numWindingQueries; i++)
+      mismatches += windingResults[i] != convexResults[i];
+
+    PrintRow(size, {winding * 1e9, convex * 1e9, winding / convex,
+                    static_cast<double>(mismatches)});
+  }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file benchmarks/point_sort_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры поразрядной сортировки точек.
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <point_sort.hpp>
+#include <graham_scan.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+using geometry::PointSort;
+
+/**
+ * @brief Сравнение geometry::RadixSort() с std::sort().
+ *
+ * @param options Параметры запуска.
+ *
+ * Точки равномерно распределены в квадрате. Замеряется время сортировки
+ * и время geometry::GrahamScan() с каждым способом сортировки. Для
+ * \f$ 10^8 \f$ точек требуется около 5 ГБ памяти.
+ */
+void PointSortBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("point_sort: seconds, uniform points in a square",
+              {"points", "std::sort", "radix", "speedup",
+               "graham", "graham radix", "speedup"});
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+
+  for (std::size_t size : options.Sizes()) {
+    std::vector<Point<double>> points(size);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    std::vector<Point<double>> work;
+    auto prepare = [&]() { work = points; };
+
+    double comparison = MeasureSeconds(prepare, [&]() {
+      std::sort(work.begin(), work.end());
+    }, options.repetitions);
+
+    double radix = MeasureSeconds(prepare, [&]() {
+      geometry::RadixSort(work.begin(), work.end());
+    }, options.repetitions);
+
+    geometry::GrahamScanOptions scanOptions;
+    geometry::ToleranceOrientationPolicy<double> orientation;
+
+    double graham = MeasureSeconds(prepare, [&]() {
+      geometry::GrahamScan(std::move(work), scanOptions, orientation);
+    }, options.repetitions);
+
+    scanOptions.sort = PointSort::Radix;
+
+    double grahamRadix = MeasureSeconds(prepare, [&]() {
+      geometry::GrahamScan(std::move(work), scanOptions, orientation);
+    }, options.repetitions);
+
+    PrintRow(size, {comparison, radix, comparison / radix,
+                    graham, grahamRadix, graham / grahamRadix});
+  }
+}
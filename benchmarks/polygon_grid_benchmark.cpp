@@ -0,0 +1,109 @@
+/**
+ * @file benchmarks/polygon_grid_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры сетки geometry::PolygonGrid.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <point_in_polygon.hpp>
+#include <polygon_grid.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+using geometry::CyclicVector;
+
+/**
+ * @brief Сравнение geometry::PolygonGrid с geometry::PreparedPolygon.
+ *
+ * @param options Параметры запуска.
+ *
+ * Многоугольник --- звёздный с \f$ n \f$ вершинами, точки равномерно
+ * распределены в его ограничивающем квадрате. Столбец build --- время
+ * построения сетки в миллисекундах, prepared и grid --- время одного
+ * запроса в наносекундах (в одном потоке), memory --- размер сетки в
+ * килобайтах, mixed --- доля ячеек, которых касаются рёбра,
+ * mismatches --- количество точек, для которых результаты различаются.
+ */
+void PolygonGridBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("polygon_grid: star polygon",
+              {"vertices", "build", "prepared", "grid", "memory", "mixed",
+               "mismatches"});
+
+  const std::size_t totalEdges = 10000000;
+  const std::size_t numQueries = 1000000;
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
+  std::uniform_real_distribution<double> radiusDist(500.0, 1000.0);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+
+  for (std::size_t size = 16; size <= std::min<std::size_t>(options.maxSize,
+                                                            65536);
+       size *= 16) {
+    std::vector<double> angles(size);
+
+    for (double& angle : angles)
+      angle = angleDist(gen);
+
+    std::sort(angles.rbegin(), angles.rend());
+
+    CyclicVector<Point<double>> vertices;
+
+    for (double angle : angles) {
+      double radius = radiusDist(gen);
+
+      vertices.emplace_back(radius * std::cos(angle),
+                            radius * std::sin(angle));
+    }
+
+    geometry::Polygon<double, CyclicVector<Point<double>>> polygon(
+        std::move(vertices));
+    std::vector<Point<double>> points(numQueries);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    // Перебор всех рёбер замеряется на меньшем количестве точек.
+    const std::vector<Point<double>> prefix(
+        points.begin(),
+        points.begin() + std::clamp<std::size_t>(totalEdges / size, 1,
+                                                 numQueries));
+    const geometry::PreparedPolygon<double> prepared(polygon);
+    std::vector<geometry::PointPosition> preparedResults;
+    std::vector<geometry::PointPosition> gridResults;
+    geometry::PolygonGrid<double> grid;
+
+    double build = MeasureSeconds([]() { }, [&]() {
+      grid = geometry::PolygonGrid<double>(polygon);
+    }, options.repetitions);
+
+    double preparedTime = MeasureSeconds([]() { }, [&]() {
+      preparedResults = prepared.Classify(prefix, 1);
+    }, options.repetitions) / prefix.size();
+
+    double gridTime = MeasureSeconds([]() { }, [&]() {
+      gridResults = grid.Classify(points, 1);
+    }, options.repetitions) / points.size();
+
+    std::size_t mismatches = 0;
+
+    for (std::size_t i = 0; i < prefix.size(); i++)
+      mismatches += preparedResults[i] != gridResults[i];
+
+    const double cells = static_cast<double>(grid.NumColumns() *
+                                             grid.NumRows());
+
+    PrintRow(size, {build * 1e3, preparedTime * 1e9, gridTime * 1e9,
+                    grid.MemoryUsage() / 1024.0, grid.NumMixedCells() / cells,
+                    static_cast<double>(mismatches)});
+  }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file benchmarks/polygon_locator_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры индекса geometry::PolygonLocator.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <angle_point_in_polygon.hpp>
+#include <point_in_polygon.hpp>
+#include <polygon_locator.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+using geometry::CyclicVector;
+
+/**
+ * @brief Сравнение geometry::PolygonLocator с
+ * geometry::AnglePointInPolygon().
+ *
+ * @param options Параметры запуска.
+ *
+ * Многоугольник --- звёздный с \f$ n \f$ вершинами, точки равномерно
+ * распределены в его ограничивающем квадрате. Столбец build --- время
+ * построения индекса в миллисекундах, angle и locator --- время одного
+ * запроса в наносекундах, break_even --- количество запросов, после
+ * которого построение индекса окупается, mismatches --- количество точек,
+ * для которых результаты различаются.
+ */
+void PolygonLocatorBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("polygon_locator: star polygon",
+              {"vertices", "build", "angle", "locator", "break_even",
+               "mismatches"});
+
+  const std::size_t totalEdges = 10000000;
+  const std::size_t numQueries = 100000;
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
+  std::uniform_real_distribution<double> radiusDist(500.0, 1000.0);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+
+  for (std::size_t size = 16; size <= std::min<std::size_t>(options.maxSize,
+                                                            65536);
+       size *= 16) {
+    std::vector<double> angles(size);
+
+    for (double& angle : angles)
+      angle = angleDist(gen);
+
+    std::sort(angles.rbegin(), angles.rend());
+
+    CyclicVector<Point<double>> vertices;
+
+    for (double angle : angles) {
+      double radius = radiusDist(gen);
+
+      vertices.emplace_back(radius * std::cos(angle),
+                            radius * std::sin(angle));
+    }
+
+    geometry::Polygon<double, CyclicVector<Point<double>>> polygon(
+        std::move(vertices));
+
+    // Линейный проход замеряется на меньшем количестве точек, чтобы
+    // всего обрабатывалось около totalEdges рёбер.
+    std::vector<Point<double>> points(numQueries);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    const std::size_t numAngleQueries = std::clamp<std::size_t>(
+        totalEdges / size, 1, numQueries);
+
+    std::vector<geometry::PointPosition> angleResults(numAngleQueries);
+    std::vector<geometry::PointPosition> locatorResults(numQueries);
+    geometry::PolygonLocator<double> locator;
+
+    double build = MeasureSeconds([]() { }, [&]() {
+      locator = geometry::PolygonLocator<double>(polygon);
+    }, options.repetitions);
+
+    double angle = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < numAngleQueries; i++)
+        angleResults[i] = geometry::AnglePointInPolygon(points[i], polygon);
+    }, options.repetitions) / numAngleQueries;
+
+    double located = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < numQueries; i++)
+        locatorResults[i] = locator.Locate(points[i]);
+    }, options.repetitions) / numQueries;
+
+    std::size_t mismatches = 0;
+
+    for (std::size_t i = 0; i < numAngleQueries; i++)
+      mismatches += angleResults[i] != locatorResults[i];
+
+    const double breakEven = angle > located ?
+                             std::ceil(build / (angle - located)) :
+                             std::nan("");
+
+    PrintRow(size, {build * 1e3, angle * 1e9, located * 1e9, breakEven,
+                    static_cast<double>(mismatches)});
+  }
+}
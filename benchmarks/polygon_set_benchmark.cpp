@@ -0,0 +1,134 @@
+/**
+ * @file benchmarks/polygon_set_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры индекса geometry::PolygonSet.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <point_in_polygon.hpp>
+#include <polygon_set.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+using geometry::CyclicVector;
+
+/**
+ * @brief Сравнение geometry::PolygonSet с перебором многоугольников.
+ *
+ * @param options Параметры запуска.
+ *
+ * Квадрат разбит на \f$ m \f$ многоугольников (ячейки решётки со
+ * сдвинутыми узлами и дополнительной вершиной на каждой стороне), точки
+ * равномерно распределены в квадрате. Столбец build --- время построения
+ * индекса в миллисекундах, brute --- время одного запроса в наносекундах
+ * при переборе всех многоугольников с отсечением по ограничивающему
+ * прямоугольнику, tree и tree_mt --- время одного запроса по R-дереву в
+ * одном потоке и во всех аппаратных потоках, mismatches --- количество
+ * точек, для которых результаты различаются.
+ */
+void PolygonSetBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("polygon_set: jittered grid",
+              {"polygons", "build", "brute", "tree", "tree_mt",
+               "mismatches"});
+
+  const std::size_t totalPolygons = 100000000;
+  const std::size_t numQueries = 1000000;
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> shiftDist(-0.3, 0.3);
+
+  for (std::size_t side = 4; side * side <= std::min<std::size_t>(
+           options.maxSize, 1000000); side *= 4) {
+    std::vector<std::vector<Point<double>>> nodes(side + 1);
+
+    for (std::size_t i = 0; i <= side; i++) {
+      for (std::size_t j = 0; j <= side; j++) {
+        const double dx = (i == 0 || i == side) ? 0.0 : shiftDist(gen);
+        const double dy = (j == 0 || j == side) ? 0.0 : shiftDist(gen);
+
+        nodes[i].emplace_back(i + dx, j + dy);
+      }
+    }
+
+    auto middle = [](const Point<double>& a, const Point<double>& b) {
+      return Point<double>((a.X() + b.X()) / 2, (a.Y() + b.Y()) / 2);
+    };
+
+    std::vector<geometry::Polygon<double, CyclicVector<Point<double>>>>
+        polygons;
+
+    for (std::size_t i = 0; i < side; i++) {
+      for (std::size_t j = 0; j < side; j++) {
+        const Point<double>& a = nodes[i][j];
+        const Point<double>& b = nodes[i][j + 1];
+        const Point<double>& c = nodes[i + 1][j + 1];
+        const Point<double>& d = nodes[i + 1][j];
+
+        polygons.emplace_back(CyclicVector<Point<double>>{
+          a, middle(a, b), b, middle(b, c), c, middle(c, d), d, middle(d, a)
+        });
+      }
+    }
+
+    std::uniform_real_distribution<double> coordDist(
+        0.0, static_cast<double>(side));
+    std::vector<Point<double>> points(numQueries);
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    // Перебор замеряется на меньшем количестве точек.
+    const std::size_t numBrute = std::clamp<std::size_t>(
+        totalPolygons / polygons.size(), 1, numQueries);
+    std::vector<std::size_t> bruteResults(numBrute);
+    std::vector<std::size_t> treeResults;
+    std::vector<std::size_t> parallelResults;
+    geometry::PolygonSet<double> set(polygons);
+
+    double build = MeasureSeconds([]() { }, [&]() {
+      set = geometry::PolygonSet<double>(polygons);
+    }, options.repetitions);
+
+    double bruteTime = MeasureSeconds([]() { }, [&]() {
+      for (std::size_t i = 0; i < numBrute; i++) {
+        bruteResults[i] = geometry::PolygonSet<double>::npos;
+
+        for (std::size_t j = 0; j < set.Size(); j++) {
+          if (set[j].Classify(points[i]) != geometry::PointPosition::OUTSIDE) {
+            bruteResults[i] = j;
+            break;
+          }
+        }
+      }
+    }, options.repetitions) / numBrute;
+
+    double treeTime = MeasureSeconds([]() { }, [&]() {
+      treeResults = set.Find(points, 1);
+    }, options.repetitions) / points.size();
+
+    double parallelTime = MeasureSeconds([]() { }, [&]() {
+      parallelResults = set.Find(points,
+                                 std::thread::hardware_concurrency());
+    }, options.repetitions) / points.size();
+
+    std::size_t mismatches = 0;
+
+    for (std::size_t i = 0; i < numBrute; i++)
+      mismatches += bruteResults[i] != treeResults[i];
+
+    for (std::size_t i = 0; i < points.size(); i++)
+      mismatches += parallelResults[i] != treeResults[i];
+
+    PrintRow(polygons.size(), {build * 1e3, bruteTime * 1e9, treeTime * 1e9,
+                               parallelTime * 1e9,
+                               static_cast<double>(mismatches)});
+  }
+}
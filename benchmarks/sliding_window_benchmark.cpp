@@ -0,0 +1,83 @@
+/**
+ * @file benchmarks/sliding_window_benchmark.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Замеры выпуклой оболочки скользящего окна.
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <sliding_window_convex_hull.hpp>
+#include "benchmark.hpp"
+
+using geometry::Point;
+
+/**
+ * @brief Стоимость обновления geometry::SlidingWindowConvexHull.
+ *
+ * @param options Параметры запуска.
+ *
+ * Окно из \f$ N \f$ последних точек случайного блуждания. После
+ * заполнения окна замеряется среднее время добавления точки (вместе с
+ * удалением самой старой), сумма этого времени и времени построения
+ * оболочки окна и время geometry::GrahamScan() всего окна, т.е.
+ * стоимость обновления без скользящего окна. Время в микросекундах.
+ */
+void SlidingWindowBenchmark(const BenchmarkOptions& options) {
+  PrintHeader("sliding_window: microseconds per update, random walk",
+              {"window", "push", "push+hull", "graham", "speedup"});
+
+  const std::size_t numUpdates = 100000;
+
+  std::mt19937 gen(1);
+  std::normal_distribution<double> stepDist(0.0, 1.0);
+
+  for (std::size_t size = 1000; size <= options.maxSize; size *= 10) {
+    std::vector<Point<double>> points(size + numUpdates);
+    Point<double> position;
+
+    for (auto& point : points) {
+      position = position + Point<double>(stepDist(gen), stepDist(gen));
+      point = position;
+    }
+
+    geometry::SlidingWindowConvexHull<double> window(size);
+
+    auto fill = [&]() {
+      window = geometry::SlidingWindowConvexHull<double>(size);
+
+      for (std::size_t i = 0; i < size; i++)
+        window.Push(points[i]);
+    };
+
+    double push = MeasureSeconds(fill, [&]() {
+      for (std::size_t i = size; i < points.size(); i++)
+        window.Push(points[i]);
+    }, options.repetitions);
+
+    // Время построения оболочки заполненного окна усредняется по
+    // numHulls вызовам.
+    const std::size_t numHulls = 1000;
+
+    double hull = MeasureSeconds(fill, [&]() {
+      for (std::size_t i = 0; i < numHulls; i++)
+        window.Hull();
+    }, options.repetitions);
+
+    std::vector<Point<double>> last(points.end() - size, points.end());
+
+    double graham = MeasureSeconds([]() { }, [&]() {
+      geometry::GrahamScan(last, geometry::AdaptiveOrientationPolicy());
+    }, options.repetitions);
+
+    const double perPush = push / numUpdates * 1e6;
+    const double perHull = hull / numHulls * 1e6;
+
+    PrintRow(size, {perPush, perPush + perHull, graham * 1e6,
+                    graham * 1e6 / (perPush + perHull)});
+  }
+}
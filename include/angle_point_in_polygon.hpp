@@ -59,20 +59,22 @@ double SignedAngle(const Point<T>& a, const Point<T>& b, \
  * @brief Determine if a point is inside, outside or on the boundary of a polygon using angle summation
  * 
  * @tparam T point coordinate type
+ * @tparam Container polygon vertex container type
  * @param point the point to test
  * @param polygon the polygon to test against
  * @param precision precision for calculations
  * @return PointPosition position of the point relative to polygon
+ *
+ * The polygon is traversed in place with Polygon::Edges(), so a query does
+ * not copy the vertices or allocate memory.
  */
-template<typename T>
+template<typename T, typename Container>
 PointPosition AnglePointInPolygon(const Point<T>& point,
-    const Polygon<T>& polygon, T precision = T(1e-9)) {
+    const Polygon<T, Container>& polygon, T precision = T(1e-9)) {
     double total_angle = 0.0;
     bool is_boundary = false;
-    Polygon<T> temp_polygon = polygon;
-    for (size_t i = 0; i < temp_polygon.Size(); i++) {
-        Edge<T> edge = temp_polygon.GetEdge();
-        temp_polygon.Advance(Rotation::ClockWise);
+    const auto edges = polygon.Edges();
+    for (auto edge = edges.begin(); edge != edges.end(); ++edge) {
         double angle = SignedAngle(point, edge.Origin(),
                                  edge.Destination(), precision);
         if (angle == 180.0) {
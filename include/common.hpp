@@ -8,6 +8,10 @@
 #ifndef INCLUDE_COMMON_HPP_
 #define INCLUDE_COMMON_HPP_
 
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+
 namespace geometry {
 
 #define PI 3.14159265358979323846
@@ -44,6 +48,18 @@ enum class Rotation {
   CounterClockWise
 };
 
+/**
+ * @brief Наибольшее количество рабочих потоков одного вызова.
+ *
+ * @return Функция возвращает количество аппаратных потоков (не меньше 1).
+ *
+ * Параллельные алгоритмы запускают по потоку ОС на каждую часть данных,
+ * поэтому количество частей ограничивается машиной, а не вызывающим.
+ */
+inline std::size_t MaxWorkerThreads() {
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
 }  // namespace geometry
 
 #endif  // INCLUDE_COMMON_HPP_
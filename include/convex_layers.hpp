@@ -0,0 +1,162 @@
+/**
+ * @file include/convex_layers.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Разбиение множества точек на выпуклые слои.
+ */
+
+#ifndef INCLUDE_CONVEX_LAYERS_HPP_
+#define INCLUDE_CONVEX_LAYERS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Разбить точки на выпуклые слои ("очистка луковицы").
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @tparam OrientationPolicy Стратегия вычисления ориентации
+ * (см. predicates.hpp).
+ * @param points Точки.
+ * @param orientation Стратегия вычисления ориентации.
+ * @param contours Указатель, по которому записываются границы слоёв
+ * (может быть nullptr).
+ * @return Функция возвращает номер слоя для каждой точки: 0 --- точки на
+ * границе выпуклой оболочки, 1 --- на границе оболочки оставшихся точек
+ * и т.д.
+ *
+ * Точки сортируются один раз. Каждый слой находится проходом монотонной
+ * цепочки по оставшимся точкам в уже отсортированном порядке, после чего
+ * точки слоя удаляются из списка с сохранением порядка. Время работы
+ * \f$ O(n \log n + n L) \f$, где \f$ L \f$ --- количество слоёв, вместо
+ * \f$ O(L n \log n) \f$ при повторном вызове GrahamScan().
+ *
+ * Слою принадлежат все точки на границе оболочки, включая лежащие на
+ * рёбрах и совпадающие точки. Если contours не nullptr, то (*contours)[k]
+ * содержит индексы вершин выпуклой оболочки слоя k в том же порядке, что и
+ * GrahamScan().
+ */
+template<typename T, typename OrientationPolicy>
+std::vector<std::size_t> ConvexLayers(
+    const std::vector<Point<T>>& points,
+    const OrientationPolicy& orientation,
+    std::vector<std::vector<std::size_t>>* contours = nullptr) {
+  const std::size_t n = points.size();
+  std::vector<std::size_t> layers(n, 0);
+  std::vector<std::size_t> remaining(n);
+
+  std::iota(remaining.begin(), remaining.end(), 0);
+  std::sort(remaining.begin(), remaining.end(),
+            [&points](std::size_t a, std::size_t b) {
+              return points[a] < points[b];
+            });
+
+  if (contours)
+    contours->clear();
+
+  std::vector<std::size_t> unique;
+  std::vector<std::size_t> chain;
+  std::vector<bool> marked(n, false);
+
+  for (std::size_t layer = 0; !remaining.empty(); layer++) {
+    const std::size_t m = remaining.size();
+    auto at = [&](std::size_t i) -> const Point<T>& {
+      return points[remaining[i]];
+    };
+
+    // Совпадающие точки обрабатываются как одна: ориентация с двумя
+    // совпадающими точками равна 0 и не позволила бы удалить вершину.
+    unique.clear();
+
+    for (std::size_t i = 0; i < m; i++) {
+      if (i == 0 || at(unique.back()) < at(i))
+        unique.push_back(i);
+    }
+
+    const std::size_t u = unique.size();
+    auto uniqueAt = [&](std::size_t k) -> const Point<T>& {
+      return at(unique[k]);
+    };
+
+    // Монотонная цепочка, в которой удаляются только вершины со строго
+    // правым поворотом, поэтому точки на рёбрах остаются в цепочке.
+    chain.clear();
+
+    for (std::size_t k = 0; k < u; k++) {
+      while (chain.size() >= 2 &&
+             orientation(uniqueAt(chain[chain.size() - 2]),
+                         uniqueAt(chain.back()), uniqueAt(k)) < 0)
+        chain.pop_back();
+
+      chain.push_back(k);
+    }
+
+    std::size_t lowerSize = chain.size();
+
+    for (std::size_t k = u - 1; k > 0; k--) {
+      while (chain.size() > lowerSize &&
+             orientation(uniqueAt(chain[chain.size() - 2]),
+                         uniqueAt(chain.back()), uniqueAt(k - 1)) < 0)
+        chain.pop_back();
+
+      chain.push_back(k - 1);
+    }
+
+    for (std::size_t k : chain) {
+      std::size_t last = k + 1 < u ? unique[k + 1] : m;
+
+      for (std::size_t i = unique[k]; i < last; i++) {
+        marked[remaining[i]] = true;
+        layers[remaining[i]] = layer;
+      }
+    }
+
+    if (contours) {
+      std::vector<std::size_t> vertices = MonotoneChainPositions(m, at,
+                                                                 orientation);
+
+      for (std::size_t& vertex : vertices)
+        vertex = remaining[vertex];
+
+      contours->push_back(std::move(vertices));
+    }
+
+    remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                   [&marked](std::size_t i) {
+                                     return marked[i];
+                                   }),
+                    remaining.end());
+  }
+
+  return layers;
+}
+
+/**
+ * @brief Разбить точки на выпуклые слои с точным вычислением ориентации.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @param points Точки.
+ * @param contours Указатель, по которому записываются границы слоёв
+ * (может быть nullptr).
+ * @return Функция возвращает номер слоя для каждой точки.
+ *
+ * Используется AdaptiveOrientationPolicy: с абсолютной точностью точки
+ * вблизи рёбер могут попасть в соседний слой.
+ */
+template<typename T>
+std::vector<std::size_t> ConvexLayers(
+    const std::vector<Point<T>>& points,
+    std::vector<std::vector<std::size_t>>* contours = nullptr) {
+  return ConvexLayers(points, AdaptiveOrientationPolicy(), contours);
+}
+
+}  // namespace geometry
+
+#endif  // INCLUDE_CONVEX_LAYERS_HPP_
@@ -0,0 +1,444 @@
+/**
+ * @file include/cyclic_vector.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Определение и реализация непрерывного контейнера для вершин многоугольника.
+ */
+
+#ifndef INCLUDE_CYCLIC_VECTOR_HPP_
+#define INCLUDE_CYCLIC_VECTOR_HPP_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geometry {
+
+/**
+ * @brief Непрерывный контейнер с циклической навигацией.
+ *
+ * @tparam T Тип элементов.
+ *
+ * Элементы хранятся в одном непрерывном массиве, а итератор состоит из
+ * указателя на контейнер и номера элемента. Поэтому итераторы остаются
+ * действительными при перераспределении памяти, а переход к соседнему
+ * элементу по кругу сводится к сложению по модулю размера.
+ *
+ * Контейнер рекомендуется использовать в качестве параметра Container
+ * класса Polygon. Интерфейс повторяет соответствующую часть интерфейса
+ * std::vector, поэтому имена методов записаны в стиле стандартной
+ * библиотеки.
+ */
+template<typename T>
+class CyclicVector {
+ private:
+  //! Элементы контейнера.
+  std::vector<T> items;
+
+  /**
+   * @brief Итератор с произвольным доступом.
+   *
+   * @tparam IsConst Если true, то итератор константный.
+   */
+  template<bool IsConst>
+  class IteratorBase {
+   private:
+    //! Тип указателя на контейнер.
+    using Owner = std::conditional_t<IsConst,
+                                     const CyclicVector*,
+                                     CyclicVector*>;
+
+    //! Контейнер.
+    Owner owner = nullptr;
+    //! Номер элемента.
+    std::size_t index = 0;
+
+    friend class CyclicVector;
+    friend class IteratorBase<!IsConst>;
+
+   public:
+    //! Категория итератора.
+    using iterator_category = std::random_access_iterator_tag;
+    //! Тип элементов.
+    using value_type = T;
+    //! Тип разности итераторов.
+    using difference_type = std::ptrdiff_t;
+    //! Тип указателя на элемент.
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+    //! Тип ссылки на элемент.
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+
+    /**
+     * @brief Конструктор по-умолчанию.
+     *
+     * Создать итератор, не связанный с контейнером.
+     */
+    IteratorBase() = default;
+
+    /**
+     * @brief Создать итератор.
+     *
+     * @param owner Контейнер.
+     * @param index Номер элемента.
+     */
+    IteratorBase(Owner owner, std::size_t index) :
+      owner(owner),
+      index(index)
+    { }
+
+    /**
+     * @brief Преобразовать неконстантный итератор в константный.
+     *
+     * @param other Неконстантный итератор.
+     */
+    template<bool OtherIsConst,
+             typename = std::enable_if_t<IsConst && !OtherIsConst>>
+    IteratorBase(const IteratorBase<OtherIsConst>& other) :  // NOLINT
+      owner(other.owner),
+      index(other.index)
+    { }
+
+    /**
+     * @brief Получить номер элемента.
+     * @return Функция возвращает номер элемента в контейнере.
+     */
+    std::size_t Index() const { return index; }
+
+    //! Получить ссылку на элемент.
+    reference operator*() const { return owner->items[index]; }
+    //! Получить указатель на элемент.
+    pointer operator->() const { return &owner->items[index]; }
+
+    //! Получить ссылку на элемент со смещением offset.
+    reference operator[](difference_type offset) const {
+      return owner->items[index + offset];
+    }
+
+    //! Перейти к следующему элементу.
+    IteratorBase& operator++() {
+      index++;
+      return *this;
+    }
+
+    //! Перейти к следующему элементу и вернуть прежний итератор.
+    IteratorBase operator++(int) {
+      IteratorBase result = *this;
+      index++;
+      return result;
+    }
+
+    //! Перейти к предыдущему элементу.
+    IteratorBase& operator--() {
+      index--;
+      return *this;
+    }
+
+    //! Перейти к предыдущему элементу и вернуть прежний итератор.
+    IteratorBase operator--(int) {
+      IteratorBase result = *this;
+      index--;
+      return result;
+    }
+
+    //! Сместить итератор вперёд.
+    IteratorBase& operator+=(difference_type offset) {
+      index += offset;
+      return *this;
+    }
+
+    //! Сместить итератор назад.
+    IteratorBase& operator-=(difference_type offset) {
+      index -= offset;
+      return *this;
+    }
+
+    //! Получить итератор, смещённый вперёд.
+    IteratorBase operator+(difference_type offset) const {
+      return IteratorBase(owner, index + offset);
+    }
+
+    //! Получить итератор, смещённый вперёд.
+    friend IteratorBase operator+(difference_type offset,
+                                  const IteratorBase& it) {
+      return it + offset;
+    }
+
+    //! Получить итератор, смещённый назад.
+    IteratorBase operator-(difference_type offset) const {
+      return IteratorBase(owner, index - offset);
+    }
+
+    //! Получить расстояние между итераторами.
+    template<bool OtherIsConst>
+    difference_type operator-(
+        const IteratorBase<OtherIsConst>& other) const {
+      return static_cast<difference_type>(index) -
+             static_cast<difference_type>(other.index);
+    }
+
+    //! Проверить итераторы на равенство.
+    template<bool OtherIsConst>
+    bool operator==(const IteratorBase<OtherIsConst>& other) const {
+      return index == other.index && owner == other.owner;
+    }
+
+    //! Проверить итераторы на неравенство.
+    template<bool OtherIsConst>
+    bool operator!=(const IteratorBase<OtherIsConst>& other) const {
+      return !(*this == other);
+    }
+
+    //! Сравнить номера элементов.
+    template<bool OtherIsConst>
+    bool operator<(const IteratorBase<OtherIsConst>& other) const {
+      return index < other.index;
+    }
+
+    //! Сравнить номера элементов.
+    template<bool OtherIsConst>
+    bool operator>(const IteratorBase<OtherIsConst>& other) const {
+      return index > other.index;
+    }
+
+    //! Сравнить номера элементов.
+    template<bool OtherIsConst>
+    bool operator<=(const IteratorBase<OtherIsConst>& other) const {
+      return index <= other.index;
+    }
+
+    //! Сравнить номера элементов.
+    template<bool OtherIsConst>
+    bool operator>=(const IteratorBase<OtherIsConst>& other) const {
+      return index >= other.index;
+    }
+  };
+
+ public:
+  //! Тип элементов.
+  using value_type = T;
+  //! Тип размера контейнера.
+  using size_type = std::size_t;
+  //! Тип разности итераторов.
+  using difference_type = std::ptrdiff_t;
+  //! Тип ссылки на элемент.
+  using reference = T&;
+  //! Тип константной ссылки на элемент.
+  using const_reference = const T&;
+  //! Тип итератора.
+  using iterator = IteratorBase<false>;
+  //! Тип константного итератора.
+  using const_iterator = IteratorBase<true>;
+
+  /**
+   * @brief Конструктор по-умолчанию.
+   *
+   * Создать пустой контейнер.
+   */
+  CyclicVector() = default;
+
+  /**
+   * @brief Создать контейнер из списка инициализации.
+   *
+   * @param items Элементы.
+   */
+  CyclicVector(std::initializer_list<T> items) :
+    items(items)
+  { }
+
+  /**
+   * @brief Создать контейнер из массива.
+   *
+   * @param items Элементы.
+   */
+  explicit CyclicVector(std::vector<T> items) :
+    items(std::move(items))
+  { }
+
+  /**
+   * @brief Создать контейнер из диапазона.
+   *
+   * @tparam InputIt Тип итератора.
+   *
+   * @param first Начало диапазона.
+   * @param last Конец диапазона.
+   */
+  template<typename InputIt>
+  CyclicVector(InputIt first, InputIt last) :
+    items(first, last)
+  { }
+
+  //! Получить итератор на первый элемент.
+  iterator begin() { return iterator(this, 0); }
+  //! Получить итератор на конец контейнера.
+  iterator end() { return iterator(this, items.size()); }
+  //! Получить константный итератор на первый элемент.
+  const_iterator begin() const { return const_iterator(this, 0); }
+  //! Получить константный итератор на конец контейнера.
+  const_iterator end() const { return const_iterator(this, items.size()); }
+  //! Получить константный итератор на первый элемент.
+  const_iterator cbegin() const { return begin(); }
+  //! Получить константный итератор на конец контейнера.
+  const_iterator cend() const { return end(); }
+
+  /**
+   * @brief Получить количество элементов.
+   * @return Функция возвращает количество элементов в контейнере.
+   */
+  std::size_t size() const { return items.size(); }
+
+  /**
+   * @brief Проверить, пуст ли контейнер.
+   * @return Функция возвращает true, если контейнер не содержит элементов.
+   */
+  bool empty() const { return items.empty(); }
+
+  //! Получить ссылку на элемент с номером index.
+  T& operator[](std::size_t index) { return items[index]; }
+  //! Получить константную ссылку на элемент с номером index.
+  const T& operator[](std::size_t index) const { return items[index]; }
+
+  //! Получить ссылку на первый элемент.
+  T& front() { return items.front(); }
+  //! Получить константную ссылку на первый элемент.
+  const T& front() const { return items.front(); }
+  //! Получить ссылку на последний элемент.
+  T& back() { return items.back(); }
+  //! Получить константную ссылку на последний элемент.
+  const T& back() const { return items.back(); }
+
+  /**
+   * @brief Получить указатель на массив элементов.
+   * @return Указатель на первый элемент массива.
+   */
+  T* data() { return items.data(); }
+
+  /**
+   * @brief Получить указатель на массив элементов.
+   * @return Указатель на первый элемент массива.
+   */
+  const T* data() const { return items.data(); }
+
+  /**
+   * @brief Зарезервировать память.
+   *
+   * @param capacity Количество элементов, для которых резервируется память.
+   */
+  void reserve(std::size_t capacity) { items.reserve(capacity); }
+
+  /**
+   * @brief Удалить все элементы.
+   */
+  void clear() { items.clear(); }
+
+  /**
+   * @brief Добавить элемент в конец контейнера.
+   *
+   * @param value Добавляемый элемент.
+   */
+  void push_back(const T& value) { items.push_back(value); }
+
+  /**
+   * @brief Создать элемент в конце контейнера.
+   *
+   * @tparam Args Типы аргументов конструктора.
+   *
+   * @param args Аргументы конструктора.
+   * @return Функция возвращает ссылку на созданный элемент.
+   */
+  template<typename... Args>
+  T& emplace_back(Args&&... args) {
+    return items.emplace_back(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Удалить последний элемент.
+   */
+  void pop_back() { items.pop_back(); }
+
+  /**
+   * @brief Вставить элемент.
+   *
+   * @param position Позиция, перед которой вставляется элемент.
+   * @param value Вставляемый элемент.
+   * @return Функция возвращает итератор на вставленный элемент.
+   */
+  iterator insert(const_iterator position, const T& value) {
+    items.insert(items.begin() + position.index, value);
+
+    return iterator(this, position.index);
+  }
+
+  /**
+   * @brief Вставить диапазон элементов.
+   *
+   * @tparam InputIt Тип итератора.
+   *
+   * @param position Позиция, перед которой вставляются элементы.
+   * @param first Начало диапазона.
+   * @param last Конец диапазона.
+   * @return Функция возвращает итератор на первый вставленный элемент.
+   */
+  template<typename InputIt>
+  iterator insert(const_iterator position, InputIt first, InputIt last) {
+    items.insert(items.begin() + position.index, first, last);
+
+    return iterator(this, position.index);
+  }
+
+  /**
+   * @brief Удалить элемент.
+   *
+   * @param position Удаляемый элемент.
+   * @return Функция возвращает итератор на элемент, следующий за удалённым.
+   */
+  iterator erase(const_iterator position) {
+    items.erase(items.begin() + position.index);
+
+    return iterator(this, position.index);
+  }
+
+  /**
+   * @brief Удалить диапазон элементов.
+   *
+   * @param first Начало диапазона.
+   * @param last Конец диапазона.
+   * @return Функция возвращает итератор на элемент, следующий за последним
+   * удалённым.
+   */
+  iterator erase(const_iterator first, const_iterator last) {
+    items.erase(items.begin() + first.index, items.begin() + last.index);
+
+    return iterator(this, first.index);
+  }
+
+  /**
+   * @brief Получить номер следующего элемента по кругу.
+   *
+   * @param index Номер элемента.
+   * @return Функция возвращает номер следующего элемента. После последнего
+   * элемента (и после конца контейнера) следует первый элемент.
+   */
+  std::size_t NextIndex(std::size_t index) const {
+    std::size_t next = index + 1;
+
+    return next < items.size() ? next : 0;
+  }
+
+  /**
+   * @brief Получить номер предыдущего элемента по кругу.
+   *
+   * @param index Номер элемента.
+   * @return Функция возвращает номер предыдущего элемента. Перед первым
+   * элементом следует последний элемент.
+   */
+  std::size_t PrevIndex(std::size_t index) const {
+    return (index == 0 ? items.size() : index) - 1;
+  }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_CYCLIC_VECTOR_HPP_
@@ -0,0 +1,431 @@
+/**
+ * @file include/dynamic_convex_hull.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Определение и реализация выпуклой оболочки с добавлением точек.
+ */
+
+#ifndef INCLUDE_DYNAMIC_CONVEX_HULL_HPP_
+#define INCLUDE_DYNAMIC_CONVEX_HULL_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Выпуклая оболочка, в которую можно добавлять точки.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @tparam OrientationPolicy Стратегия вычисления ориентации
+ * (см. predicates.hpp).
+ *
+ * Оболочка хранится в виде верхней и нижней цепочек. Каждая цепочка ---
+ * сбалансированное дерево поиска (std::map), в котором вершины
+ * упорядочены по \f$ X \f$. Добавление точки стоит \f$ O(\log n) \f$
+ * амортизированно: точка проверяется за \f$ O(\log n) \f$, а каждая
+ * вершина удаляется из цепочки не более одного раза. Проверка
+ * принадлежности точки оболочке стоит \f$ O(\log n) \f$.
+ *
+ * Коллинеарные точки на рёбрах оболочки в вершины не входят, поэтому с
+ * точной стратегией (по-умолчанию AdaptiveOrientationPolicy) Hull()
+ * совпадает с результатом GrahamScan() для тех же точек.
+ */
+template<typename T, typename OrientationPolicy = AdaptiveOrientationPolicy>
+class DynamicConvexHull {
+ private:
+  /**
+   * @brief Верхняя или нижняя цепочка оболочки.
+   *
+   * Нижняя цепочка обрабатывается как верхняя цепочка точек, отражённых
+   * относительно оси \f$ X \f$: знаки ориентаций и сравнений \f$ Y \f$
+   * умножаются на side.
+   */
+  class Chain {
+   private:
+    /**
+     * @brief Запись журнала об одном вызове Insert().
+     */
+    struct Change {
+      //! Начало вершин, удалённых этим вызовом, в журнале erased.
+      std::size_t erased;
+      //! \f$ X \f$ добавленной или изменённой вершины.
+      T x;
+      //! Прежнее значение \f$ Y \f$ изменённой вершины.
+      T y;
+      //! 0 --- цепочка не изменилась, 1 --- вершина добавлена,
+      //! 2 --- у вершины изменилась \f$ Y \f$.
+      int kind;
+    };
+
+    //! Вершины цепочки: \f$ X \to Y \f$.
+    std::map<T, T> vertices;
+    //! 1 для верхней цепочки, -1 для нижней.
+    int side;
+    //! Журнал вызовов Insert() (ведётся, если journal равен true).
+    std::vector<Change> changes;
+    //! Вершины, удалённые записанными в журнал вызовами Insert().
+    std::vector<std::pair<T, T>> erased;
+    //! Вести ли журнал.
+    bool journal = false;
+
+    /**
+     * @brief Удалить вершину, сохранив её в журнале.
+     *
+     * @param it Итератор на вершину.
+     * @return Функция возвращает итератор на следующую вершину.
+     */
+    typename std::map<T, T>::iterator Erase(
+        typename std::map<T, T>::iterator it) {
+      if (journal)
+        erased.emplace_back(it->first, it->second);
+
+      return vertices.erase(it);
+    }
+
+    /**
+     * @brief Получить точку по итератору на вершину.
+     *
+     * @param it Итератор на вершину.
+     * @return Функция возвращает вершину цепочки.
+     */
+    static Point<T> At(typename std::map<T, T>::const_iterator it) {
+      return Point<T>(it->first, it->second);
+    }
+
+   public:
+    /**
+     * @brief Создать пустую цепочку.
+     *
+     * @param side 1 для верхней цепочки, -1 для нижней.
+     */
+    explicit Chain(int side) : side(side) { }
+
+    //! Получить вершины цепочки.
+    const std::map<T, T>& Vertices() const { return vertices; }
+
+    //! Удалить все вершины и журнал.
+    void Clear() {
+      vertices.clear();
+      changes.clear();
+      erased.clear();
+    }
+
+    /**
+     * @brief Включить или выключить журнал.
+     *
+     * @param enable true, если нужно вести журнал.
+     */
+    void SetJournal(bool enable) {
+      journal = enable;
+      changes.clear();
+      erased.clear();
+    }
+
+    /**
+     * @brief Отменить последний записанный в журнал вызов Insert().
+     *
+     * Удалённые вершины возвращаются в цепочку, поэтому отмена стоит
+     * столько же, сколько отменяемое добавление.
+     */
+    void Undo() {
+      Change change = changes.back();
+
+      changes.pop_back();
+
+      if (change.kind == 1)
+        vertices.erase(change.x);
+      else if (change.kind == 2)
+        vertices[change.x] = change.y;
+
+      for (std::size_t i = change.erased; i < erased.size(); i++)
+        vertices.emplace(erased[i].first, erased[i].second);
+
+      erased.resize(change.erased);
+    }
+
+    /**
+     * @brief Добавить точку в цепочку.
+     *
+     * @param point Точка.
+     * @param orientation Стратегия вычисления ориентации.
+     * @return Функция возвращает true, если точка стала вершиной цепочки.
+     *
+     * Если точка лежит снаружи, то она добавляется, а соседние вершины,
+     * нарушающие выпуклость, удаляются.
+     */
+    bool Insert(const Point<T>& point, const OrientationPolicy& orientation) {
+      Change change{erased.size(), point.X(), T(0), 0};
+      auto it = vertices.lower_bound(point.X());
+
+      if (it != vertices.end() && it->first == point.X()) {
+        if (side * (point.Y() - it->second) <= T(0)) {
+          if (journal)
+            changes.push_back(change);
+
+          return false;
+        }
+
+        change.y = it->second;
+        change.kind = 2;
+        it->second = point.Y();
+      } else {
+        if (it != vertices.end() && it != vertices.begin() &&
+            side * orientation(At(std::prev(it)), At(it), point) <= 0) {
+          if (journal)
+            changes.push_back(change);
+
+          return false;
+        }
+
+        change.kind = 1;
+        it = vertices.emplace_hint(it, point.X(), point.Y());
+      }
+
+      if (journal)
+        changes.push_back(change);
+
+      auto next = std::next(it);
+
+      while (next != vertices.end() && std::next(next) != vertices.end() &&
+             side * orientation(point, At(next), At(std::next(next))) >= 0)
+        next = Erase(next);
+
+      while (it != vertices.begin() && std::prev(it) != vertices.begin()) {
+        auto prev = std::prev(it);
+
+        if (side * orientation(At(std::prev(prev)), At(prev), point) < 0)
+          break;
+
+        Erase(prev);
+      }
+
+      return true;
+    }
+
+    /**
+     * @brief Проверить, что точка лежит не снаружи цепочки.
+     *
+     * @param point Точка.
+     * @param orientation Стратегия вычисления ориентации.
+     * @return Функция возвращает true, если точка лежит в полосе цепочки
+     * под верхней (над нижней) цепочкой или на ней.
+     */
+    bool Covers(const Point<T>& point,
+                const OrientationPolicy& orientation) const {
+      if (vertices.empty() ||
+          point.X() < vertices.begin()->first ||
+          point.X() > vertices.rbegin()->first)
+        return false;
+
+      auto it = vertices.lower_bound(point.X());
+
+      if (it->first == point.X())
+        return side * (point.Y() - it->second) <= T(0);
+
+      return side * orientation(At(std::prev(it)), At(it), point) <= 0;
+    }
+  };
+
+  //! Стратегия вычисления ориентации.
+  OrientationPolicy orientation;
+  //! Верхняя цепочка.
+  Chain upper;
+  //! Нижняя цепочка.
+  Chain lower;
+  //! Количество добавленных точек.
+  std::size_t numPoints;
+  //! Ведётся ли журнал добавлений.
+  bool undo = false;
+  //! Количество добавлений, записанных в журнал.
+  std::size_t numChanges = 0;
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Создать пустую оболочку.
+   *
+   * @param orientation Стратегия вычисления ориентации.
+   */
+  explicit DynamicConvexHull(
+      const OrientationPolicy& orientation = OrientationPolicy()) :
+    orientation(orientation),
+    upper(1),
+    lower(-1),
+    numPoints(0)
+  { }
+
+  /**
+   * @brief Добавить точку.
+   *
+   * @param point Точка.
+   * @return Функция возвращает true, если оболочка изменилась, т.е. точка
+   * стала вершиной оболочки.
+   */
+  bool Insert(const Point<T>& point) {
+    numPoints++;
+
+    if (undo)
+      numChanges++;
+
+    bool changedUpper = upper.Insert(point, orientation);
+    bool changedLower = lower.Insert(point, orientation);
+
+    return changedUpper || changedLower;
+  }
+
+  /**
+   * @brief Добавить точки.
+   *
+   * @tparam InputIt Тип итератора на Point<T>.
+   * @param first Начало последовательности точек.
+   * @param last Конец последовательности точек.
+   * @return Функция возвращает количество точек, изменивших оболочку.
+   */
+  template<typename InputIt>
+  std::size_t Insert(InputIt first, InputIt last) {
+    std::size_t changed = 0;
+
+    for (; first != last; ++first)
+      changed += Insert(*first);
+
+    return changed;
+  }
+
+  /**
+   * @brief Проверить принадлежность точки оболочке.
+   *
+   * @param point Точка.
+   * @return Функция возвращает true, если точка лежит внутри оболочки или
+   * на её границе.
+   */
+  bool Contains(const Point<T>& point) const {
+    return upper.Covers(point, orientation) &&
+           lower.Covers(point, orientation);
+  }
+
+  /**
+   * @brief Получить вершины оболочки.
+   *
+   * @return Функция возвращает вершины оболочки против часовой стрелки,
+   * начиная с лексикографически наименьшей, в том же порядке, что и
+   * GrahamScan().
+   */
+  std::vector<Point<T>> Hull() const {
+    std::vector<Point<T>> hull;
+
+    if (Empty())
+      return hull;
+
+    const std::map<T, T>& bottom = lower.Vertices();
+    const std::map<T, T>& top = upper.Vertices();
+
+    hull.reserve(Size());
+
+    for (const auto& [x, y] : bottom)
+      hull.emplace_back(x, y);
+
+    // Крайние левая и правая вершины могут принадлежать обеим цепочкам.
+    auto first = top.rbegin();
+    auto last = top.rend();
+
+    if (first->second == bottom.rbegin()->second)
+      ++first;
+
+    if (first != last && std::prev(last)->second == bottom.begin()->second)
+      --last;
+
+    for (; first != last; ++first)
+      hull.emplace_back(first->first, first->second);
+
+    return hull;
+  }
+
+  /**
+   * @brief Получить количество вершин оболочки.
+   * @return Функция возвращает количество вершин оболочки.
+   */
+  std::size_t Size() const {
+    if (Empty())
+      return 0;
+
+    const std::map<T, T>& bottom = lower.Vertices();
+    const std::map<T, T>& top = upper.Vertices();
+
+    if (bottom.size() == 1)
+      return top.begin()->second == bottom.begin()->second ? 1 : 2;
+
+    return bottom.size() + top.size() -
+           (top.rbegin()->second == bottom.rbegin()->second) -
+           (top.begin()->second == bottom.begin()->second);
+  }
+
+  /**
+   * @brief Получить количество добавленных точек.
+   * @return Функция возвращает количество вызовов Insert() для одной точки.
+   */
+  std::size_t NumPoints() const { return numPoints; }
+
+  /**
+   * @brief Проверить, что оболочка пуста.
+   * @return Функция возвращает true, если точки не добавлялись.
+   */
+  bool Empty() const { return lower.Vertices().empty(); }
+
+  /**
+   * @brief Включить или выключить журнал добавлений для Undo().
+   *
+   * @param enable true, если нужно вести журнал.
+   *
+   * Журнал хранит одну запись на каждый вызов Insert() и вершины,
+   * удалённые из оболочки, поэтому его размер не превосходит удвоенного
+   * количества добавленных точек. Вызов очищает журнал.
+   */
+  void EnableUndo(bool enable) {
+    upper.SetJournal(enable);
+    lower.SetJournal(enable);
+    undo = enable;
+    numChanges = 0;
+  }
+
+  /**
+   * @brief Отменить последнее добавление точки, записанное в журнал.
+   *
+   * Оболочка возвращается в состояние до последнего вызова Insert() для
+   * одной точки. Отмена стоит столько же, сколько отменяемое добавление,
+   * т.е. \f$ O(\log n) \f$ амортизированно.
+   *
+   * @throw std::logic_error если журнал пуст.
+   */
+  void Undo() {
+    if (numChanges == 0)
+      throw std::logic_error("DynamicConvexHull: nothing to undo");
+
+    upper.Undo();
+    lower.Undo();
+    numChanges--;
+    numPoints--;
+  }
+
+  /**
+   * @brief Удалить все точки и журнал.
+   */
+  void Clear() {
+    upper.Clear();
+    lower.Clear();
+    numPoints = 0;
+    numChanges = 0;
+  }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_DYNAMIC_CONVEX_HULL_HPP_
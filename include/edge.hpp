@@ -8,6 +8,7 @@
 #ifndef INCLUDE_EDGE_HPP_
 #define INCLUDE_EDGE_HPP_
 
+#include <type_traits>
 #include <common.hpp>
 
 namespace geometry {
@@ -132,6 +133,44 @@ class Edge {
    */
   Intersection Cross(const Edge& edge, T* t, T precision);
 
+  /**
+   * @brief Определить, пересекаются ли две прямые, содержащие рёбра.
+   *
+   * @tparam OrientationPolicy Тип стратегии вычисления ориентации.
+   *
+   * @param edge Второе ребро.
+   * @param t В эту переменную запишется значение параметра, соответствующего
+   * точке пересечения.
+   * @param orientation Стратегия вычисления ориентации
+   * (см. predicates.hpp).
+   * @return Тип пересечения.
+   *
+   * Функция аналогична предыдущей, но параллельность и коллинеарность
+   * определяются с помощью стратегии. При использовании
+   * AdaptiveOrientationPolicy эти случаи распознаются точно.
+   */
+  template<typename OrientationPolicy, typename = std::enable_if_t<
+      !std::is_arithmetic_v<OrientationPolicy>>>
+  Intersection Intersect(const Edge& edge, T* t,
+                         const OrientationPolicy& orientation) const;
+
+  /**
+   * @brief Определить, пересекаются ли два ребра.
+   *
+   * @tparam OrientationPolicy Тип стратегии вычисления ориентации.
+   *
+   * @param edge Второе ребро.
+   * @param t В эту переменную запишется значение параметра, соответствующего
+   * точке пересечения.
+   * @param orientation Стратегия вычисления ориентации
+   * (см. predicates.hpp).
+   * @return Тип пересечения.
+   */
+  template<typename OrientationPolicy, typename = std::enable_if_t<
+      !std::is_arithmetic_v<OrientationPolicy>>>
+  Intersection Cross(const Edge& edge, T* t,
+                     const OrientationPolicy& orientation);
+
   /**
    * @brief Функция проверяет, является ли ребро вертикальным.
    * @return Булево значение, которое показывает, является ли ребро
@@ -98,6 +98,53 @@ Intersection Edge<T>::Cross(const Edge& edge, T* t, T precision) {
   return Intersection::SkewNoCross;
 }
 
+template<typename T>
+template<typename OrientationPolicy, typename>
+Intersection Edge<T>::Intersect(const Edge& edge, T* t,
+    const OrientationPolicy& orientation) const {
+  if (orientation.CrossSign(origin, destination,
+                            edge.origin, edge.destination) == 0) {
+    if (orientation(edge.origin, edge.destination, origin) != 0)
+      return Intersection::Parallel;
+    else
+      return Intersection::Collinear;
+  }
+
+  Point<T> direction = destination - origin;
+  Point<T> otherDirection = edge.destination - edge.origin;
+
+  Point<T> otherNormal = Point(otherDirection.Y(),
+      -otherDirection.X());
+
+  T denominator = otherNormal * direction;
+  T numerator = otherNormal * (origin - edge.origin);
+  *t = - numerator / denominator;
+
+  return Intersection::Skew;
+}
+
+template<typename T>
+template<typename OrientationPolicy, typename>
+Intersection Edge<T>::Cross(const Edge& edge, T* t,
+    const OrientationPolicy& orientation) {
+  T s;
+  Intersection crossType = edge.Intersect(*this, &s, orientation);
+
+  if (crossType == Intersection::Collinear ||
+      crossType == Intersection::Parallel)
+    return crossType;
+
+  if (s < T(0) || s > T(1))
+    return Intersection::SkewNoCross;
+
+  Intersect(edge, t, orientation);
+
+  if (T(0) <= *t && *t <= T(1))
+    return Intersection::SkewCross;
+
+  return Intersection::SkewNoCross;
+}
+
 template<typename T>
 bool Edge<T>::IsVertical(T precision) const {
   return std::fabs(origin.X() - destination.X()) <=
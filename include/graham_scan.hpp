@@ -10,7 +10,18 @@
 
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include "point.hpp"
+#include "point_sort.hpp"
+#include "predicates.hpp"
 
 namespace geometry {
 
@@ -30,48 +41,1019 @@ namespace geometry {
   }
 
   /**
-   * @brief Graham scan algorithm.
-   * 
+   * @brief Options of GrahamScan().
+   */
+  struct GrahamScanOptions {
+    //! Discard points inside the Akl-Toussaint octagon before sorting.
+    bool prefilter = false;
+    //! Sorting method (see point_sort.hpp).
+    PointSort sort = PointSort::Comparison;
+  };
+
+  /**
+   * @brief Convex hull algorithms available through ConvexHull().
+   */
+  enum class HullAlgorithm {
+    Auto,       ///< Choose the algorithm with SelectHullAlgorithm()
+    Graham,     ///< GrahamScan(), O(n log n)
+    Chan,       ///< ChanHull(), O(n log h)
+    Quickhull   ///< Quickhull(), O(n log n) expected, O(n^2) worst case
+  };
+
+  /**
+   * @brief Statistics collected by GrahamScan() and ConvexHull().
+   */
+  struct GrahamScanStatistics {
+    //! Number of points discarded by the prefilter.
+    size_t eliminated = 0;
+    //! Algorithm that was actually used.
+    HullAlgorithm algorithm = HullAlgorithm::Graham;
+  };
+
+  /**
+   * @brief Akl-Toussaint prefilter.
+   *
    * @tparam T point coordinate type
-   * @param points vector of points for processing
-   * @return std::vector<Point<T>> convex hull points in traversal order
+   * @param points vector of points, the survivors are kept in place
+   * @return size_t number of discarded points
+   *
+   * The function finds the extreme points in 8 directions (x, y, x + y,
+   * x - y and their opposites) and removes every point that lies strictly
+   * inside the octagon formed by them. Such points are strictly inside
+   * the convex hull, so the hull does not change.
+   *
+   * The inside test does not branch on the point: all edges are checked
+   * and the survivors are compacted with an unconditional store. For
+   * floating point types a point is discarded only if every cross product
+   * exceeds its rounding error bound, so rounding can only keep extra
+   * points, never drop a hull vertex.
    */
   template<typename T>
-  std::vector<Point<T>> GrahamScan(std::vector<Point<T>> points) {
-    size_t n = points.size();
-    if (n <= 1) return points;
+  size_t AklToussaintFilter(std::vector<Point<T>>* points) {
+    size_t n = points->size();
+    if (n < 9) return 0;
 
-    std::sort(points.begin(), points.end());
+    const Point<T>* data = points->data();
+    // Extreme points in counterclockwise order: max x, max x + y, max y,
+    // max y - x, min x, min x + y, min y, max x - y.
+    size_t extreme[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
-    std::vector<Point<T>> hull;
+    for (size_t i = 1; i < n; i++) {
+      T x = data[i].X();
+      T y = data[i].Y();
+
+      if (x > data[extreme[0]].X()) extreme[0] = i;
+      if (x + y > data[extreme[1]].X() + data[extreme[1]].Y()) extreme[1] = i;
+      if (y > data[extreme[2]].Y()) extreme[2] = i;
+      if (y - x > data[extreme[3]].Y() - data[extreme[3]].X()) extreme[3] = i;
+      if (x < data[extreme[4]].X()) extreme[4] = i;
+      if (x + y < data[extreme[5]].X() + data[extreme[5]].Y()) extreme[5] = i;
+      if (y < data[extreme[6]].Y()) extreme[6] = i;
+      if (x - y > data[extreme[7]].X() - data[extreme[7]].Y()) extreme[7] = i;
+    }
+
+    // Drop repeated corners, so that every edge has a non-zero length.
+    auto same = [](const Point<T>& a, const Point<T>& b) {
+      return a.X() == b.X() && a.Y() == b.Y();
+    };
+
+    Point<T> corners[8];
+    size_t size = 0;
+
+    for (size_t i = 0; i < 8; i++) {
+      const Point<T>& corner = data[extreme[i]];
+
+      if (size == 0 || !same(corner, corners[size - 1]))
+        corners[size++] = corner;
+    }
+
+    while (size > 1 && same(corners[size - 1], corners[0]))
+      size--;
+
+    if (size < 3) return 0;
+
+    T ax[8], ay[8], dx[8], dy[8];
+
+    for (size_t i = 0; i < size; i++) {
+      const Point<T>& next = corners[i + 1 < size ? i + 1 : 0];
+
+      ax[i] = corners[i].X();
+      ay[i] = corners[i].Y();
+      dx[i] = next.X() - ax[i];
+      dy[i] = next.Y() - ay[i];
+    }
+
+    T error_bound = T(0);
+
+    if constexpr (std::is_floating_point_v<T>) {
+      // The edge vectors are computed once and reused, so their rounding
+      // errors are not covered by the usual orientation bound. A relative
+      // bound of 8 eps covers both the edge and the product errors.
+      error_bound = T(8) * std::numeric_limits<T>::epsilon();
+    }
+
+    std::vector<Point<T>>& result = *points;
+    size_t kept = 0;
+
+    for (size_t i = 0; i < n; i++) {
+      Point<T> point = result[i];
+      bool inside = true;
+
+      for (size_t j = 0; j < size; j++) {
+        T left = dx[j] * (point.Y() - ay[j]);
+        T right = dy[j] * (point.X() - ax[j]);
+        T bound = error_bound * (std::abs(left) + std::abs(right));
+
+        inside &= left - right > bound;
+      }
+
+      result[kept] = point;
+      kept += !inside;
+    }
+
+    result.resize(kept);
+
+    return n - kept;
+  }
+
+  /**
+   * @brief Monotone chain pass over sorted points given by an accessor.
+   *
+   * @tparam PointAt accessor type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param n number of points
+   * @param point_at accessor, point_at(i) returns the i-th point in
+   * lexicographic order
+   * @param orientation orientation predicate
+   * @return std::vector<size_t> positions of the hull vertices (in sorted
+   * order) in traversal order
+   *
+   * The accessor lets the same pass run over sorted points, over a sorted
+   * permutation of indices and over a range sorted in place.
+   */
+  template<typename PointAt, typename OrientationPolicy>
+  std::vector<size_t> MonotoneChainPositions(
+      size_t n, const PointAt& point_at,
+      const OrientationPolicy& orientation) {
+    std::vector<size_t> hull;
+
+    if (n <= 1) {
+      if (n == 1) hull.push_back(0);
+      return hull;
+    }
 
     for (size_t i = 0; i < n; i++) {
       while (hull.size() >= 2 &&
-             CrossProduct(
-               hull[hull.size() - 2],
-               hull.back(),
-               points[i]) <= 0) {
+             orientation(
+               point_at(hull[hull.size() - 2]),
+               point_at(hull.back()),
+               point_at(i)) <= 0) {
         hull.pop_back();
       }
-      hull.push_back(points[i]);
+      hull.push_back(i);
     }
 
     size_t lower_hull_size = hull.size();
     for (size_t i = n - 1; i > 0; i--) {
       while (hull.size() > lower_hull_size &&
-             CrossProduct(
-               hull[hull.size() - 2],
-               hull.back(),
-               points[i - 1]) <= 0) {
+             orientation(
+               point_at(hull[hull.size() - 2]),
+               point_at(hull.back()),
+               point_at(i - 1)) <= 0) {
         hull.pop_back();
       }
-      hull.push_back(points[i - 1]);
+      hull.push_back(i - 1);
     }
 
     hull.pop_back();
 
     return hull;
   }
+
+  /**
+   * @brief Build the convex hull of lexicographically sorted points.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points pointer to the sorted points
+   * @param n number of points
+   * @param orientation orientation predicate
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * This is the monotone chain pass of GrahamScan() without the sort.
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> MonotoneChain(const Point<T>* points, size_t n,
+                                      const OrientationPolicy& orientation) {
+    std::vector<size_t> positions = MonotoneChainPositions(n,
+        [points](size_t i) -> const Point<T>& { return points[i]; },
+        orientation);
+    std::vector<Point<T>> hull;
+
+    hull.reserve(positions.size());
+
+    for (size_t position : positions)
+      hull.push_back(points[position]);
+
+    return hull;
+  }
+
+  /**
+   * @brief Graham scan algorithm with a custom orientation predicate.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param orientation orientation predicate
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * A point is removed from the hull whenever orientation(a, b, c) <= 0,
+   * so collinear points are not included in the result.
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> GrahamScan(std::vector<Point<T>> points,
+                                   const OrientationPolicy& orientation) {
+    return GrahamScan(std::move(points), GrahamScanOptions(), orientation);
+  }
+
+  /**
+   * @brief Graham scan algorithm with options.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param options algorithm options
+   * @param orientation orientation predicate
+   * @param statistics pointer to statistics (may be nullptr)
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * If options.prefilter is set, AklToussaintFilter() runs before the sort.
+   * options.sort selects std::sort() or RadixSort(); the hull is the same.
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> GrahamScan(std::vector<Point<T>> points,
+                                   const GrahamScanOptions& options,
+                                   const OrientationPolicy& orientation,
+                                   GrahamScanStatistics* statistics = nullptr) {
+    size_t eliminated = 0;
+
+    if (options.prefilter)
+      eliminated = AklToussaintFilter(&points);
+
+    if (statistics)
+      statistics->eliminated = eliminated;
+
+    size_t n = points.size();
+    if (n <= 1) return points;
+
+    SortPoints(points.begin(), points.end(), options.sort);
+
+    return MonotoneChain(points.data(), n, orientation);
+  }
+
+  /**
+   * @brief Graham scan algorithm.
+   *
+   * @tparam T point coordinate type
+   * @param points vector of points for processing
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * The sign of CrossProduct() is used as is, without any tolerance.
+   */
+  template<typename T>
+  std::vector<Point<T>> GrahamScan(std::vector<Point<T>> points) {
+    return GrahamScan(std::move(points), ToleranceOrientationPolicy<T>(T(0)));
+  }
+
+  /**
+   * @brief Parallel divide-and-conquer version of GrahamScan().
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param threads number of worker threads (0 - one per hardware thread)
+   * @param orientation orientation predicate
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * The points are split into equal chunks. Every chunk is sorted and
+   * reduced to its sub-hull in a separate thread. The sub-hulls are sorted,
+   * merged pairwise in linear time and the monotone chain pass runs once
+   * more over the merged points. Every vertex of the final hull is a vertex
+   * of some sub-hull, so with an exact predicate (e.g.
+   * AdaptiveOrientationPolicy) the result is identical to GrahamScan().
+   *
+   * The predicate is called from several threads at once. Policies that
+   * count calls (AdaptiveOrientationPolicy with statistics) must not be
+   * used here because the counters are not synchronized.
+   *
+   * With threads == 0 small inputs are processed sequentially, since the
+   * thread start-up cost outweighs the gain.
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> ParallelGrahamScan(
+      std::vector<Point<T>> points, size_t threads,
+      const OrientationPolicy& orientation) {
+    return ParallelGrahamScan(std::move(points), threads,
+                              GrahamScanOptions(), orientation);
+  }
+
+  /**
+   * @brief Parallel divide-and-conquer version of GrahamScan() with options.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param threads number of worker threads (0 - one per hardware thread)
+   * @param options algorithm options
+   * @param orientation orientation predicate
+   * @param statistics pointer to statistics (may be nullptr)
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * If options.prefilter is set, AklToussaintFilter() runs before the
+   * points are split into chunks. Every chunk is sorted with options.sort.
+   * At most MaxWorkerThreads() threads are started whatever the value of
+   * threads.
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> ParallelGrahamScan(
+      std::vector<Point<T>> points, size_t threads,
+      const GrahamScanOptions& options,
+      const OrientationPolicy& orientation,
+      GrahamScanStatistics* statistics = nullptr) {
+    const size_t min_chunk_size = 1 << 16;
+    size_t eliminated = 0;
+
+    if (options.prefilter)
+      eliminated = AklToussaintFilter(&points);
+
+    if (statistics)
+      statistics->eliminated = eliminated;
+
+    GrahamScanOptions sort_options;
+    sort_options.sort = options.sort;
+
+    size_t n = points.size();
+
+    if (threads == 0)
+      threads = std::max<size_t>(n / min_chunk_size, 1);
+
+    threads = std::min({threads, n, MaxWorkerThreads()});
+
+    if (threads <= 1)
+      return GrahamScan(std::move(points), sort_options, orientation);
+
+    std::vector<std::future<std::vector<Point<T>>>> tasks;
+
+    for (size_t i = 0; i < threads; i++) {
+      size_t first = n * i / threads;
+      size_t last = n * (i + 1) / threads;
+
+      tasks.push_back(std::async(std::launch::async,
+          [&points, &options, &orientation, first, last]() {
+            SortPoints(points.begin() + first, points.begin() + last,
+                       options.sort);
+
+            std::vector<Point<T>> hull = MonotoneChain(
+                points.data() + first, last - first, orientation);
+
+            std::sort(hull.begin(), hull.end());
+
+            return hull;
+          }));
+    }
+
+    std::vector<Point<T>> merged;
+    std::vector<size_t> bounds = {0};
+
+    for (auto& task : tasks) {
+      std::vector<Point<T>> hull = task.get();
+
+      merged.insert(merged.end(), hull.begin(), hull.end());
+      bounds.push_back(merged.size());
+    }
+
+    // Merge neighbouring sorted runs until a single run remains.
+    for (size_t step = 1; step < threads; step *= 2) {
+      for (size_t i = 0; i + step < threads; i += 2 * step) {
+        size_t last = std::min(i + 2 * step, threads);
+
+        std::inplace_merge(merged.begin() + bounds[i],
+                           merged.begin() + bounds[i + step],
+                           merged.begin() + bounds[last]);
+      }
+    }
+
+    return MonotoneChain(merged.data(), merged.size(), orientation);
+  }
+
+  /**
+   * @brief Parallel divide-and-conquer version of GrahamScan().
+   *
+   * @tparam T point coordinate type
+   * @param points vector of points for processing
+   * @param threads number of worker threads (0 - one per hardware thread)
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * Uses AdaptiveOrientationPolicy, so the result does not depend on the
+   * number of threads and is the same as
+   * GrahamScan(points, AdaptiveOrientationPolicy()).
+   */
+  template<typename T>
+  std::vector<Point<T>> ParallelGrahamScan(std::vector<Point<T>> points,
+                                           size_t threads = 0) {
+    return ParallelGrahamScan(std::move(points), threads,
+                              AdaptiveOrientationPolicy());
+  }
+
+  /**
+   * @brief Check whether point a is a better next hull vertex than b.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * @param p current hull vertex
+   * @param a first candidate
+   * @param b second candidate
+   * @param orientation orientation predicate
+   * @return bool true if a is strictly better than b
+   *
+   * A candidate is better if it lies to the right of the ray from p to the
+   * other one. Collinear candidates are compared by the distance from p
+   * using coordinate comparisons only, and copies of p are the worst
+   * candidates.
+   */
+  template<typename T, typename OrientationPolicy>
+  bool IsBetterHullCandidate(const Point<T>& p, const Point<T>& a,
+                             const Point<T>& b,
+                             const OrientationPolicy& orientation) {
+    bool a_is_p = a.X() == p.X() && a.Y() == p.Y();
+    bool b_is_p = b.X() == p.X() && b.Y() == p.Y();
+
+    if (a_is_p || b_is_p)
+      return !a_is_p;
+
+    int turn = orientation(p, b, a);
+
+    if (turn != 0)
+      return turn < 0;
+
+    // Both candidates lie on the same ray from p.
+    if (a.X() != p.X())
+      return a.X() > p.X() ? a.X() > b.X() : a.X() < b.X();
+
+    return a.Y() > p.Y() ? a.Y() > b.Y() : a.Y() < b.Y();
+  }
+
+  /**
+   * @brief Find the tangent from a point to a convex polygon.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * @param hull convex polygon in counterclockwise order
+   * @param p point outside the polygon or equal to one of its vertices
+   * @param start vertex to start the search from
+   * @param orientation orientation predicate
+   * @return size_t index of the vertex q such that no vertex lies to the
+   * right of the ray from p to q (the farthest one if there are several)
+   *
+   * Seen from p, the candidates along a convex polygon form a unimodal
+   * cyclic sequence, so walking towards a better neighbour ends at the
+   * tangent. The tangent moves monotonically while p goes around the hull,
+   * so when start is the previous tangent the walks over a whole wrap cost
+   * O(|hull|) in total.
+   */
+  template<typename T, typename OrientationPolicy>
+  size_t HullTangent(const std::vector<Point<T>>& hull, const Point<T>& p,
+                     size_t start, const OrientationPolicy& orientation) {
+    size_t k = hull.size();
+    size_t index = start;
+
+    // The limit only matters for an inexact predicate.
+    for (size_t step = 0; step < 2 * k; step++) {
+      size_t next = index + 1 < k ? index + 1 : 0;
+
+      if (IsBetterHullCandidate(p, hull[next], hull[index], orientation)) {
+        index = next;
+        continue;
+      }
+
+      size_t prev = index > 0 ? index - 1 : k - 1;
+
+      if (IsBetterHullCandidate(p, hull[prev], hull[index], orientation)) {
+        index = prev;
+        continue;
+      }
+
+      break;
+    }
+
+    return index;
+  }
+
+  /**
+   * @brief Chan's output-sensitive convex hull algorithm.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param orientation orientation predicate
+   * @param hull_size_hint expected hull size (0 if unknown)
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * For m = 4, 16, 256, ... the points are split into groups of m points,
+   * the hull of every group is built with the monotone chain, and at most
+   * m steps of the Jarvis march are made over the group hulls. The round
+   * succeeds as soon as the hull has at most m vertices, which gives
+   * O(n log h) time in total. If hull_size_hint is given, the first round
+   * starts with m not less than the hint, which skips the rounds that are
+   * likely to fail.
+   *
+   * The result has the same form as GrahamScan(): it starts at the
+   * lexicographically smallest point and goes counterclockwise without
+   * collinear points. With an exact predicate it is identical to
+   * GrahamScan().
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> ChanHull(std::vector<Point<T>> points,
+                                 const OrientationPolicy& orientation,
+                                 size_t hull_size_hint = 0) {
+    size_t n = points.size();
+    if (n <= 1) return points;
+
+    const Point<T> start = *std::min_element(points.begin(), points.end());
+    size_t log_m = 2;
+
+    while (log_m + 1 < 8 * sizeof(size_t) &&
+           (size_t(1) << log_m) < hull_size_hint)
+      log_m++;
+
+    for (; ; log_m *= 2) {
+      size_t m = log_m < 8 * sizeof(size_t) ? size_t(1) << log_m : n;
+
+      if (m >= n)
+        return GrahamScan(std::move(points), orientation);
+
+      size_t groups = (n + m - 1) / m;
+      std::vector<std::vector<Point<T>>> hulls(groups);
+
+      for (size_t g = 0; g < groups; g++) {
+        size_t first = g * m;
+        size_t last = std::min(first + m, n);
+
+        std::sort(points.begin() + first, points.begin() + last);
+        hulls[g] = MonotoneChain(points.data() + first, last - first,
+                                 orientation);
+      }
+
+      std::vector<size_t> tangents(groups, 0);
+      std::vector<Point<T>> hull = {start};
+      Point<T> current = start;
+
+      for (size_t step = 0; step < m; step++) {
+        Point<T> best = current;
+
+        for (size_t g = 0; g < groups; g++) {
+          tangents[g] = HullTangent(hulls[g], current, tangents[g],
+                                    orientation);
+
+          const Point<T>& candidate = hulls[g][tangents[g]];
+
+          if (IsBetterHullCandidate(current, candidate, best, orientation))
+            best = candidate;
+        }
+
+        // All points coincide; GrahamScan() defines the answer for this
+        // degenerate input.
+        if (best.X() == current.X() && best.Y() == current.Y())
+          return GrahamScan(std::move(points), orientation);
+
+        if (best.X() == start.X() && best.Y() == start.Y())
+          return hull;
+
+        hull.push_back(best);
+        current = best;
+      }
+    }
+  }
+
+  /**
+   * @brief Quickhull algorithm.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param orientation orientation predicate
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * The segment between the lexicographically smallest and largest points
+   * splits the points into the lower and the upper part. Every part is
+   * processed with an explicit stack: the point farthest from the current
+   * segment is a hull vertex, and only the points outside the two new
+   * segments are kept. Distances are compared with the orientation
+   * predicate (orientation.CrossSign()), so with an exact predicate the
+   * result is identical to GrahamScan().
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> Quickhull(std::vector<Point<T>> points,
+                                  const OrientationPolicy& orientation) {
+    size_t n = points.size();
+    if (n <= 1) return points;
+
+    auto bounds = std::minmax_element(points.begin(), points.end());
+    const Point<T> a = *bounds.first;
+    const Point<T> b = *bounds.second;
+
+    if (a.X() == b.X() && a.Y() == b.Y())
+      return GrahamScan(std::move(points), orientation);
+
+    // The lower part is moved to the front, the upper part follows it.
+    auto lower_end = std::partition(points.begin(), points.end(),
+        [&](const Point<T>& p) { return orientation(a, b, p) < 0; });
+    auto upper_end = std::partition(lower_end, points.end(),
+        [&](const Point<T>& p) { return orientation(a, b, p) > 0; });
+
+    struct Task {
+      Point<T> from;
+      Point<T> to;
+      size_t first;
+      size_t last;
+    };
+
+    size_t lower_size = lower_end - points.begin();
+    size_t upper_size = upper_end - points.begin();
+
+    std::vector<Task> stack = {
+      {b, a, lower_size, upper_size},
+      {a, b, 0, lower_size}
+    };
+    std::vector<Point<T>> hull;
+
+    // The points of a task lie strictly to the right of from -> to.
+    while (!stack.empty()) {
+      Task task = stack.back();
+      stack.pop_back();
+
+      if (task.first == task.last) {
+        hull.push_back(task.from);
+        continue;
+      }
+
+      size_t farthest = task.first;
+
+      for (size_t i = task.first + 1; i < task.last; i++) {
+        // The sign of (to - from) x (farthest - i) tells which point is
+        // farther to the right; ties go to the smaller point, which is an
+        // end of the tied segment and thus a hull vertex.
+        int sign = orientation.CrossSign(task.from, task.to,
+                                         points[farthest], points[i]);
+
+        if (sign < 0 || (sign == 0 && points[i] < points[farthest]))
+          farthest = i;
+      }
+
+      const Point<T> c = points[farthest];
+
+      auto middle = std::partition(points.begin() + task.first,
+                                   points.begin() + task.last,
+          [&](const Point<T>& p) { return orientation(task.from, c, p) < 0; });
+      auto end = std::partition(middle, points.begin() + task.last,
+          [&](const Point<T>& p) { return orientation(c, task.to, p) < 0; });
+
+      size_t middle_index = middle - points.begin();
+      size_t end_index = end - points.begin();
+
+      stack.push_back({c, task.to, middle_index, end_index});
+      stack.push_back({task.from, c, task.first, middle_index});
+    }
+
+    return hull;
+  }
+
+  /**
+   * @brief Choose a convex hull algorithm for the given points.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points points for processing
+   * @param orientation orientation predicate
+   * @param hull_size_estimate pointer to the estimated hull size
+   * (may be nullptr)
+   * @return HullAlgorithm the algorithm expected to be the fastest
+   *
+   * The hull of an evenly spaced sample is used to estimate the share of
+   * hull vertices. Small inputs and inputs with a large share go to
+   * GrahamScan(), whose sort is cheap and independent of h. A tiny share
+   * goes to Quickhull(), which then discards almost all points in the
+   * first passes. The rest goes to ChanHull().
+   *
+   * The hull size is extrapolated as h_s (n / s)^(1/3), which is the growth
+   * rate for points uniformly distributed in a disk.
+   */
+  template<typename T, typename OrientationPolicy>
+  HullAlgorithm SelectHullAlgorithm(const std::vector<Point<T>>& points,
+                                    const OrientationPolicy& orientation,
+                                    size_t* hull_size_estimate = nullptr) {
+    const size_t min_size = 1 << 12;
+    const size_t sample_size = 1 << 10;
+
+    size_t n = points.size();
+
+    if (hull_size_estimate)
+      *hull_size_estimate = 0;
+
+    if (n < min_size)
+      return HullAlgorithm::Graham;
+
+    std::vector<Point<T>> sample;
+    sample.reserve(sample_size);
+
+    for (size_t i = 0; i < sample_size; i++)
+      sample.push_back(points[i * n / sample_size]);
+
+    size_t hull_size = GrahamScan(std::move(sample), orientation).size();
+
+    if (hull_size_estimate) {
+      *hull_size_estimate = static_cast<size_t>(hull_size *
+          std::cbrt(static_cast<double>(n) / sample_size));
+    }
+
+    if (hull_size * 8 >= sample_size)
+      return HullAlgorithm::Graham;
+
+    if (hull_size * 64 <= sample_size)
+      return HullAlgorithm::Quickhull;
+
+    return HullAlgorithm::Chan;
+  }
+
+  /**
+   * @brief Build the convex hull with the chosen algorithm.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param algorithm algorithm (HullAlgorithm::Auto - choose automatically)
+   * @param options algorithm options
+   * @param orientation orientation predicate
+   * @param statistics pointer to statistics (may be nullptr)
+   * @return std::vector<Point<T>> convex hull points in traversal order
+   *
+   * The prefilter (if enabled) runs before the automatic choice, so the
+   * choice is made for the remaining points.
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> ConvexHull(std::vector<Point<T>> points,
+                                   HullAlgorithm algorithm,
+                                   const GrahamScanOptions& options,
+                                   const OrientationPolicy& orientation,
+                                   GrahamScanStatistics* statistics = nullptr) {
+    size_t eliminated = 0;
+
+    if (options.prefilter)
+      eliminated = AklToussaintFilter(&points);
+
+    size_t hull_size_estimate = 0;
+
+    if (algorithm == HullAlgorithm::Auto)
+      algorithm = SelectHullAlgorithm(points, orientation,
+                                      &hull_size_estimate);
+
+    if (statistics) {
+      statistics->eliminated = eliminated;
+      statistics->algorithm = algorithm;
+    }
+
+    switch (algorithm) {
+    case HullAlgorithm::Chan:
+      return ChanHull(std::move(points), orientation, hull_size_estimate);
+    case HullAlgorithm::Quickhull:
+      return Quickhull(std::move(points), orientation);
+    default:
+      GrahamScanOptions sort_options;
+      sort_options.sort = options.sort;
+
+      return GrahamScan(std::move(points), sort_options, orientation);
+    }
+  }
+
+  /**
+   * @brief Graham scan returning indices of the hull vertices.
+   *
+   * @tparam RandomIt random access iterator over Point<T>
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param first beginning of the points
+   * @param last end of the points
+   * @param orientation orientation predicate
+   * @return std::vector<uint32_t> indices (relative to first) of the hull
+   * vertices in traversal order
+   *
+   * The points are neither copied nor modified: a permutation of 32-bit
+   * indices is sorted instead. The hull is the same as GrahamScan() returns
+   * for these points; if a hull vertex occurs several times, the index of
+   * one of its copies is returned.
+   *
+   * @throw std::length_error if there are more than 2^32 - 1 points.
+   */
+  template<typename RandomIt, typename OrientationPolicy>
+  std::vector<uint32_t> GrahamScanIndices(
+      RandomIt first, RandomIt last, const OrientationPolicy& orientation) {
+    size_t n = last - first;
+
+    if (n > std::numeric_limits<uint32_t>::max())
+      throw std::length_error("GrahamScanIndices: too many points");
+
+    std::vector<uint32_t> order(n);
+
+    std::iota(order.begin(), order.end(), uint32_t(0));
+    std::sort(order.begin(), order.end(),
+        [first](uint32_t a, uint32_t b) { return first[a] < first[b]; });
+
+    std::vector<size_t> positions = MonotoneChainPositions(n,
+        [first, &order](size_t i) -> decltype(auto) {
+          return first[order[i]];
+        },
+        orientation);
+    std::vector<uint32_t> hull;
+
+    hull.reserve(positions.size());
+
+    for (size_t position : positions)
+      hull.push_back(order[position]);
+
+    return hull;
+  }
+
+  /**
+   * @brief Graham scan returning indices of the hull vertices.
+   *
+   * @tparam RandomIt random access iterator over Point<T>
+   * @param first beginning of the points
+   * @param last end of the points
+   * @return std::vector<uint32_t> indices (relative to first) of the hull
+   * vertices in traversal order
+   *
+   * Uses the same predicate as GrahamScan(points).
+   */
+  template<typename RandomIt>
+  std::vector<uint32_t> GrahamScanIndices(RandomIt first, RandomIt last) {
+    using T = typename std::iterator_traits<RandomIt>::value_type::ValueType;
+
+    return GrahamScanIndices(first, last, ToleranceOrientationPolicy<T>(T(0)));
+  }
+
+  /**
+   * @brief Graham scan that sorts the points in place.
+   *
+   * @tparam RandomIt random access iterator over Point<T>
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param first beginning of the points
+   * @param last end of the points
+   * @param orientation orientation predicate
+   * @return std::vector<uint32_t> indices (relative to first) of the hull
+   * vertices in the sorted range in traversal order
+   *
+   * Use this version when the caller does not need the original order:
+   * the range is sorted lexicographically and no extra memory apart from
+   * the hull is allocated.
+   *
+   * @throw std::length_error if there are more than 2^32 - 1 points.
+   */
+  template<typename RandomIt, typename OrientationPolicy>
+  std::vector<uint32_t> GrahamScanInPlace(
+      RandomIt first, RandomIt last, const OrientationPolicy& orientation) {
+    size_t n = last - first;
+
+    if (n > std::numeric_limits<uint32_t>::max())
+      throw std::length_error("GrahamScanInPlace: too many points");
+
+    std::sort(first, last);
+
+    std::vector<size_t> positions = MonotoneChainPositions(n,
+        [first](size_t i) -> decltype(auto) { return first[i]; },
+        orientation);
+
+    return std::vector<uint32_t>(positions.begin(), positions.end());
+  }
+
+  /**
+   * @brief Number of strips that guarantees a relative error.
+   *
+   * @param epsilon relative error, 0 < epsilon <= 1
+   * @return size_t number of strips for ApproximateConvexHull()
+   *
+   * @throw std::invalid_argument if epsilon is not in (0, 1].
+   * @throw std::out_of_range if 1 / epsilon does not fit into size_t.
+   */
+  inline size_t ApproximateHullStrips(double epsilon) {
+    if (!(epsilon > 0.0 && epsilon <= 1.0))
+      throw std::invalid_argument("ApproximateHullStrips: invalid epsilon");
+
+    const double strips = std::ceil(1.0 / epsilon);
+
+    // 2^64 is the first double that does not fit, the cast would be UB.
+    if (!(strips < std::ldexp(1.0, std::numeric_limits<size_t>::digits)))
+      throw std::out_of_range("ApproximateHullStrips: epsilon is too small");
+
+    return static_cast<size_t>(strips);
+  }
+
+  /**
+   * @brief Approximate convex hull in O(n + k) time.
+   *
+   * @tparam T point coordinate type
+   * @tparam OrientationPolicy orientation predicate type
+   * (see predicates.hpp)
+   * @param points vector of points for processing
+   * @param strips number of vertical strips k
+   * @param orientation orientation predicate
+   * @param errorBound pointer to the error bound (may be nullptr)
+   * @return std::vector<Point<T>> hull of a subset of the points in the same
+   * order as GrahamScan()
+   *
+   * Bentley-Faust-Preparata approximation. The x range of the points is
+   * split into k strips of equal width and only the lowest and the highest
+   * point of every strip are kept; the exact hull of at most 2k points is
+   * then built by GrahamScan(). The points are read twice (extents, then
+   * strips) and are neither copied nor sorted.
+   *
+   * The result is inside the exact hull, and every point lies within
+   * distance (max x - min x) / k of it, which is written to *errorBound.
+   * Relative to the diameter of the points the error is at most 1 / k, see
+   * ApproximateHullStrips().
+   *
+   * @throw std::invalid_argument if strips is 0.
+   */
+  template<typename T, typename OrientationPolicy>
+  std::vector<Point<T>> ApproximateConvexHull(
+      const std::vector<Point<T>>& points, size_t strips,
+      const OrientationPolicy& orientation, double* errorBound = nullptr) {
+    if (strips == 0)
+      throw std::invalid_argument("ApproximateConvexHull: strips must be "
+                                  "positive");
+
+    if (errorBound)
+      *errorBound = 0.0;
+
+    if (points.empty())
+      return {};
+
+    T minX = points[0].X();
+    T maxX = minX;
+
+    for (const Point<T>& point : points) {
+      minX = std::min(minX, point.X());
+      maxX = std::max(maxX, point.X());
+    }
+
+    const double width = static_cast<double>(maxX) - static_cast<double>(minX);
+    const double scale = width > 0.0 ? strips / width : 0.0;
+
+    // The lowest and the highest point of every strip. An empty strip
+    // keeps low above high, so no separate flag is needed in the loop.
+    std::vector<Point<T>> low(strips, Point<T>(T(0),
+                                  std::numeric_limits<T>::max()));
+    std::vector<Point<T>> high(strips, Point<T>(T(0),
+                                   std::numeric_limits<T>::lowest()));
+
+    for (const Point<T>& point : points) {
+      size_t strip = static_cast<size_t>(
+          (static_cast<double>(point.X()) - static_cast<double>(minX)) *
+          scale);
+
+      strip = std::min(strip, strips - 1);
+
+      if (point.Y() <= low[strip].Y())
+        low[strip] = point;
+
+      if (point.Y() >= high[strip].Y())
+        high[strip] = point;
+    }
+
+    std::vector<Point<T>> candidates;
+
+    for (size_t strip = 0; strip < strips; strip++) {
+      if (low[strip].Y() <= high[strip].Y()) {
+        candidates.push_back(low[strip]);
+        candidates.push_back(high[strip]);
+      }
+    }
+
+    if (errorBound)
+      *errorBound = width / strips;
+
+    return GrahamScan(std::move(candidates), orientation);
+  }
 }  // namespace geometry
 
 #endif  // INCLUDE_GRAHAM_SCAN_HPP_
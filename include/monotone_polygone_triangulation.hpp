@@ -8,163 +8,194 @@
 #ifndef INCLUDE_MONOTONE_POLYGONE_TRIANGULATION_HPP_
 #define INCLUDE_MONOTONE_POLYGONE_TRIANGULATION_HPP_
 
-#include <iostream>
-#include <vector>
-#include <stack>
-#include <algorithm>
-#include <cmath>
-#include <set>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <utility>
-struct Point {
-    double x, y;
-    int id;
-    explicit Point(double x = 0, double y = 0, int id = -1)
-        : x(x), y(y), id(id) {}
-    bool operator<(const Point& other) const {
-        if (y != other.y) return y > other.y;
-        return x < other.x;
-    }
-    bool operator==(const Point& other) const {
-        return id == other.id;
-    }
-};
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+
+namespace geometry {
 
 /**
- * @brief Calculate cross product to determine orientation
+ * @brief Sweep order of the triangulation
  *
  * @param a first point
  * @param b second point
- * @param c third point
  *
- * @return cross product
+ * @return true if a is above b, or at the same height and to the left
+ * of b; false otherwise
  */
-double CrossProduct(const Point& a, const Point& b, const Point& c) {
-    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+template<typename T>
+bool SweepPrecedes(const Point<T>& a, const Point<T>& b) {
+    if (a.Y() != b.Y()) return a.Y() > b.Y();
+    return a.X() < b.X();
 }
 
 /**
- * @brief Check if segment is polygon edge
+ * @brief Sweep a monotone polygon from top to bottom and report its
+ * triangles
  *
- * @param polygon polygon
- * @param id1 first end of segment
- * @param id2 second end of segment
+ * @tparam T coordinate type
+ * @tparam OrientationPolicy orientation predicate type
+ * (see predicates.hpp)
+ * @tparam Emit triangle callback type
+ * @param polygon input polygon vertices, y-monotone, in either order
+ * @param orientation orientation predicate used for the visibility checks
+ * @param emit callback called as emit(current, a, b) for each of the
+ * n - 2 triangles, with the positions of its vertices in the polygon;
+ * the side (current, b) is the one the triangle cuts off, i.e. a diagonal
+ * unless it is a polygon edge
  *
- * @return true, if segment is polygon edge; false, if not
- */
-bool IsPolygonEdge(const std::vector<Point>& polygon, int id1, int id2) {
-    for (size_t i = 0; i < polygon.size(); ++i) {
-        size_t next = (i + 1) % polygon.size();
-        if ((polygon[i].id == id1 && polygon[next].id == id2) ||
-            (polygon[i].id == id2 && polygon[next].id == id1)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-/**
- * @brief Triangulate a monotone polygon
+ * The vertices are addressed by their position in the polygon, so the
+ * predecessor and successor of a vertex are its neighbours and checking
+ * whether two vertices span an edge is O(1). Walking from the topmost
+ * vertex forward and backward gives the two chains, each already sorted
+ * from top to bottom; a linear merge of them replaces sorting, and every
+ * vertex is tagged with its chain. Together with the stack sweep the
+ * whole triangulation takes O(n) time.
  *
- * @param polygon input polygon vertices
- * @return vector of diagonals as vertex index pairs
+ * Vertices are ordered from top to bottom by SweepPrecedes(), i.e.
+ * vertices with equal y are ordered from left to right.
  */
-std::vector<std::pair<int, int>> TriangulateMonotonePolygon(
-    const std::vector<Point>& polygon) {
-    std::vector<std::pair<int, int>> diagonals;
-    if (polygon.size() < 3) return diagonals;
-
-    std::vector<Point> vertices = polygon;
-    sort(vertices.begin(), vertices.end());
-
-    int topIdx = 0, bottomIdx = 0;
-    for (size_t i = 1; i < polygon.size(); ++i) {
-        if (polygon[i].y > polygon[topIdx].y) topIdx = i;
-        if (polygon[i].y < polygon[bottomIdx].y) bottomIdx = i;
+template<typename T, typename OrientationPolicy, typename Emit>
+void SweepMonotonePolygon(const std::vector<Point<T>>& polygon,
+                          const OrientationPolicy& orientation, Emit emit) {
+    const size_t n = polygon.size();
+    if (n < 3) return;
+
+    auto next = [n](size_t i) { return i + 1 == n ? 0 : i + 1; };
+    auto prev = [n](size_t i) { return i == 0 ? n - 1 : i - 1; };
+
+    size_t topIdx = 0, bottomIdx = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (SweepPrecedes(polygon[i], polygon[topIdx])) topIdx = i;
+        if (SweepPrecedes(polygon[bottomIdx], polygon[i])) bottomIdx = i;
     }
 
-    std::vector<Point> leftChain, rightChain;
-
-    int current = topIdx;
-    do {
-        leftChain.push_back(polygon[current]);
-        current = (current + 1) % polygon.size();
-    } while (current != (bottomIdx + 1) % polygon.size());
-
-    current = topIdx;
-    while (current != bottomIdx) {
-        rightChain.push_back(polygon[current]);
-        current = (current == 0) ? polygon.size() - 1 : current - 1;
-    }
-    rightChain.push_back(polygon[bottomIdx]);
-
-    std::vector<Point> merged;
-    size_t leftPtr = 0, rightPtr = 0;
-    while (leftPtr < leftChain.size() && rightPtr < rightChain.size()) {
-        if (leftChain[leftPtr].y >= rightChain[rightPtr].y) {
-            merged.push_back(leftChain[leftPtr++]);
+    // Vertices reached from the top by successors form the forward chain,
+    // the others (by predecessors) the backward one.
+    std::vector<char> forward(n, 0);
+    for (size_t i = next(topIdx); i != bottomIdx; i = next(i))
+        forward[i] = 1;
+
+    std::vector<size_t> merged;
+    merged.reserve(n);
+    merged.push_back(topIdx);
+    size_t forwardPtr = next(topIdx), backwardPtr = prev(topIdx);
+    while (forwardPtr != bottomIdx || backwardPtr != bottomIdx) {
+        if (backwardPtr == bottomIdx || (forwardPtr != bottomIdx &&
+            SweepPrecedes(polygon[forwardPtr], polygon[backwardPtr]))) {
+            merged.push_back(forwardPtr);
+            forwardPtr = next(forwardPtr);
         } else {
-            merged.push_back(rightChain[rightPtr++]);
+            merged.push_back(backwardPtr);
+            backwardPtr = prev(backwardPtr);
         }
     }
-    while (leftPtr < leftChain.size())
-        merged.push_back(leftChain[leftPtr++]);
-    while (rightPtr < rightChain.size())
-        merged.push_back(rightChain[rightPtr++]);
-    std::stack<Point> S;
-    S.push(merged[0]);
-    S.push(merged[1]);
-
-    for (size_t i = 2; i < merged.size(); ++i) {
-        Point current = merged[i];
-        Point top = S.top();
-
-        bool currentInLeft = find(leftChain.begin(), leftChain.end(), current)
-            != leftChain.end();
-        bool topInLeft = find(leftChain.begin(), leftChain.end(), top)
-            != leftChain.end();
-        bool sameChain = (currentInLeft && topInLeft) ||
-            (!currentInLeft && !topInLeft);
-
-        if (!sameChain) {
-            while (!S.empty()) {
-                Point next = S.top();
-                if (!IsPolygonEdge(polygon, current.id, next.id)) {
-                    diagonals.push_back(std::make_pair(current.id, next.id));
-                }
-                S.pop();
-            }
-            S.push(current);
+    merged.push_back(bottomIdx);
+
+    auto orient = [&](size_t a, size_t b, size_t c) {
+        return orientation(polygon[a], polygon[b], polygon[c]);
+    };
+
+    // The top vertex is extreme, hence convex, so the turn at it gives the
+    // direction of the boundary. The interior is on the left of a
+    // counterclockwise boundary, so going down the forward chain of such
+    // a polygon the interior is on the left.
+    const int turn =
+        orient(prev(topIdx), topIdx, next(topIdx)) >= 0 ? 1 : -1;
+
+    std::vector<size_t> stack = {merged[0], merged[1]};
+
+    for (size_t j = 2; j + 1 < n; ++j) {
+        const size_t current = merged[j];
+
+        if (forward[current] != forward[stack.back()]) {
+            // The stack is a reflex chain on the other side: every vertex
+            // of it is visible, and the bottom one is adjacent.
+            for (size_t k = 0; k + 1 < stack.size(); ++k)
+                emit(current, stack[k], stack[k + 1]);
+            stack.assign({merged[j - 1], current});
         } else {
-            while (!S.empty()) {
-                Point next = S.top();
-                double cross = CrossProduct(top, next, current);
-                if ((currentInLeft && cross > 0) ||
-                    (!currentInLeft && cross < 0)) {
-                    if (!IsPolygonEdge(polygon, current.id, next.id)) {
-                        diagonals.push_back
-                        (std::make_pair(current.id, next.id));
-                    }
-                    S.pop();
-                } else {
-                    break;
-                }
+            const int side = forward[current] ? turn : -turn;
+            size_t last = stack.back();
+            stack.pop_back();
+            while (!stack.empty() &&
+                   orient(stack.back(), last, current) * side > 0) {
+                emit(current, last, stack.back());
+                last = stack.back();
+                stack.pop_back();
             }
-            S.push(current);
+            stack.push_back(last);
+            stack.push_back(current);
         }
     }
 
-    if (!S.empty()) {
-        Point lastVertex = merged.back();
-        S.pop();
-        while (!S.empty()) {
-            if (S.size() != 1) {
-                diagonals.push_back(std::make_pair(lastVertex.id, S.top().id));
-            }
-            S.pop();
-        }
-    }
+    // The bottom vertex sees the whole stack, the ends of which are its
+    // neighbours.
+    for (size_t k = 0; k + 1 < stack.size(); ++k)
+        emit(merged[n - 1], stack[k], stack[k + 1]);
+}
+
+/**
+ * @brief Triangulate a monotone polygon
+ *
+ * @tparam T coordinate type
+ * @tparam OrientationPolicy orientation predicate type
+ * (see predicates.hpp)
+ * @param polygon input polygon vertices, y-monotone, in either order
+ * @param orientation orientation predicate used for the visibility checks
+ * @return flat buffer of 3 (n - 2) vertex positions in the polygon, three
+ * per triangle, every triangle in counterclockwise order
+ *
+ * See SweepMonotonePolygon(); the whole triangulation takes O(n) time.
+ * The buffer can be passed as is to a renderer as an index buffer.
+ *
+ * @throw std::length_error if there are more than 2^32 - 1 vertices.
+ */
+template<typename T, typename OrientationPolicy>
+std::vector<uint32_t> TriangulateMonotonePolygon(
+    const std::vector<Point<T>>& polygon,
+    const OrientationPolicy& orientation) {
+    std::vector<uint32_t> triangles;
+    const size_t n = polygon.size();
+    if (n < 3) return triangles;
+    if (n > std::numeric_limits<uint32_t>::max())
+        throw std::length_error("TriangulateMonotonePolygon: too many "
+                                "vertices");
+
+    triangles.reserve(3 * (n - 2));
+    SweepMonotonePolygon(polygon, orientation,
+        [&](size_t current, size_t a, size_t b) {
+            if (orientation(polygon[current], polygon[a], polygon[b]) < 0)
+                std::swap(a, b);
+            triangles.push_back(static_cast<uint32_t>(current));
+            triangles.push_back(static_cast<uint32_t>(a));
+            triangles.push_back(static_cast<uint32_t>(b));
+        });
+
+    return triangles;
+}
 
-    return diagonals;
+/**
+ * @brief Triangulate a monotone polygon
+ *
+ * @tparam T coordinate type
+ * @param polygon input polygon vertices
+ * @return flat buffer of vertex positions, three per triangle
+ *
+ * The sign of the cross product is used as is, without any tolerance.
+ */
+template<typename T>
+std::vector<uint32_t> TriangulateMonotonePolygon(
+    const std::vector<Point<T>>& polygon) {
+    return TriangulateMonotonePolygon(polygon,
+                                      ToleranceOrientationPolicy<T>());
 }
 
+}  // namespace geometry
+
 #endif  // INCLUDE_MONOTONE_POLYGONE_TRIANGULATION_HPP_
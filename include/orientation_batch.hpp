@@ -0,0 +1,397 @@
+/**
+ * @file include/orientation_batch.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Пакетное вычисление векторного произведения и ориентации точек.
+ */
+
+#ifndef INCLUDE_ORIENTATION_BATCH_HPP_
+#define INCLUDE_ORIENTATION_BATCH_HPP_
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <point.hpp>
+#include <point_buffer.hpp>
+#include <simd.hpp>
+
+#ifdef GEOMETRY_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace geometry {
+
+/**
+ * @brief Скалярное ядро вычисления векторного произведения.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * @param ax \f$ X \f$ координата первой точки прямой.
+ * @param ay \f$ Y \f$ координата первой точки прямой.
+ * @param dx \f$ X \f$ координата направляющего вектора прямой.
+ * @param dy \f$ Y \f$ координата направляющего вектора прямой.
+ * @param xs Массив \f$ X \f$ координат.
+ * @param ys Массив \f$ Y \f$ координат.
+ * @param begin Номер первой обрабатываемой точки.
+ * @param end Номер точки, следующей за последней обрабатываемой.
+ * @param result Массив результатов.
+ *
+ * Порядок операций совпадает с функциями CrossProduct() и Orientation(),
+ * поэтому, если компилятор не объединяет умножение и вычитание в FMA,
+ * результаты всех ядер побитово совпадают со скалярными функциями.
+ */
+template<typename T>
+void CrossProductKernel(T ax, T ay, T dx, T dy,
+                        const T* xs, const T* ys,
+                        std::size_t begin, std::size_t end, T* result) {
+  for (std::size_t i = begin; i < end; i++)
+    result[i] = dx * (ys[i] - ay) - dy * (xs[i] - ax);
+}
+
+/**
+ * @brief Скалярное ядро вычисления ориентации.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * @param ax \f$ X \f$ координата первой точки прямой.
+ * @param ay \f$ Y \f$ координата первой точки прямой.
+ * @param dx \f$ X \f$ координата направляющего вектора прямой.
+ * @param dy \f$ Y \f$ координата направляющего вектора прямой.
+ * @param xs Массив \f$ X \f$ координат.
+ * @param ys Массив \f$ Y \f$ координат.
+ * @param precision Абсолютная точность вычислений.
+ * @param begin Номер первой обрабатываемой точки.
+ * @param end Номер точки, следующей за последней обрабатываемой.
+ * @param result Массив результатов.
+ */
+template<typename T>
+void OrientationKernel(T ax, T ay, T dx, T dy,
+                       const T* xs, const T* ys, T precision,
+                       std::size_t begin, std::size_t end, int* result) {
+  for (std::size_t i = begin; i < end; i++) {
+    T sa = dx * (ys[i] - ay) - dy * (xs[i] - ax);
+
+    result[i] = sa > precision ? 1 : (sa < -precision ? -1 : 0);
+  }
+}
+
+#ifdef GEOMETRY_X86_SIMD
+
+/*
+ * Векторные ядра обрабатывают только полные регистры и возвращают количество
+ * обработанных точек. Остаток обрабатывается скалярным ядром. Умножение и
+ * вычитание выполняются раздельно (без FMA), чтобы округление совпадало со
+ * скалярным кодом.
+ */
+
+__attribute__((target("avx2")))
+inline std::size_t CrossProductAvx2(double ax, double ay, double dx, double dy,
+                                    const double* xs, const double* ys,
+                                    std::size_t size, double* result) {
+  const __m256d vax = _mm256_set1_pd(ax);
+  const __m256d vay = _mm256_set1_pd(ay);
+  const __m256d vdx = _mm256_set1_pd(dx);
+  const __m256d vdy = _mm256_set1_pd(dy);
+  std::size_t i = 0;
+
+  for (; i + 4 <= size; i += 4) {
+    __m256d x = _mm256_sub_pd(_mm256_loadu_pd(xs + i), vax);
+    __m256d y = _mm256_sub_pd(_mm256_loadu_pd(ys + i), vay);
+
+    _mm256_storeu_pd(result + i,
+        _mm256_sub_pd(_mm256_mul_pd(vdx, y), _mm256_mul_pd(vdy, x)));
+  }
+
+  return i;
+}
+
+__attribute__((target("avx2")))
+inline std::size_t CrossProductAvx2(float ax, float ay, float dx, float dy,
+                                    const float* xs, const float* ys,
+                                    std::size_t size, float* result) {
+  const __m256 vax = _mm256_set1_ps(ax);
+  const __m256 vay = _mm256_set1_ps(ay);
+  const __m256 vdx = _mm256_set1_ps(dx);
+  const __m256 vdy = _mm256_set1_ps(dy);
+  std::size_t i = 0;
+
+  for (; i + 8 <= size; i += 8) {
+    __m256 x = _mm256_sub_ps(_mm256_loadu_ps(xs + i), vax);
+    __m256 y = _mm256_sub_ps(_mm256_loadu_ps(ys + i), vay);
+
+    _mm256_storeu_ps(result + i,
+        _mm256_sub_ps(_mm256_mul_ps(vdx, y), _mm256_mul_ps(vdy, x)));
+  }
+
+  return i;
+}
+
+__attribute__((target("avx2")))
+inline std::size_t OrientationAvx2(double ax, double ay, double dx, double dy,
+                                   const double* xs, const double* ys,
+                                   double precision,
+                                   std::size_t size, int* result) {
+  const __m256d vax = _mm256_set1_pd(ax);
+  const __m256d vay = _mm256_set1_pd(ay);
+  const __m256d vdx = _mm256_set1_pd(dx);
+  const __m256d vdy = _mm256_set1_pd(dy);
+  const __m256d upper = _mm256_set1_pd(precision);
+  const __m256d lower = _mm256_set1_pd(-precision);
+  const __m256d one = _mm256_set1_pd(1.0);
+  std::size_t i = 0;
+
+  for (; i + 4 <= size; i += 4) {
+    __m256d x = _mm256_sub_pd(_mm256_loadu_pd(xs + i), vax);
+    __m256d y = _mm256_sub_pd(_mm256_loadu_pd(ys + i), vay);
+    __m256d sa = _mm256_sub_pd(_mm256_mul_pd(vdx, y), _mm256_mul_pd(vdy, x));
+    __m256d positive = _mm256_and_pd(_mm256_cmp_pd(sa, upper, _CMP_GT_OQ),
+                                     one);
+    __m256d negative = _mm256_and_pd(_mm256_cmp_pd(sa, lower, _CMP_LT_OQ),
+                                     one);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i),
+        _mm256_cvtpd_epi32(_mm256_sub_pd(positive, negative)));
+  }
+
+  return i;
+}
+
+__attribute__((target("avx2")))
+inline std::size_t OrientationAvx2(float ax, float ay, float dx, float dy,
+                                   const float* xs, const float* ys,
+                                   float precision,
+                                   std::size_t size, int* result) {
+  const __m256 vax = _mm256_set1_ps(ax);
+  const __m256 vay = _mm256_set1_ps(ay);
+  const __m256 vdx = _mm256_set1_ps(dx);
+  const __m256 vdy = _mm256_set1_ps(dy);
+  const __m256 upper = _mm256_set1_ps(precision);
+  const __m256 lower = _mm256_set1_ps(-precision);
+  const __m256 one = _mm256_set1_ps(1.0f);
+  std::size_t i = 0;
+
+  for (; i + 8 <= size; i += 8) {
+    __m256 x = _mm256_sub_ps(_mm256_loadu_ps(xs + i), vax);
+    __m256 y = _mm256_sub_ps(_mm256_loadu_ps(ys + i), vay);
+    __m256 sa = _mm256_sub_ps(_mm256_mul_ps(vdx, y), _mm256_mul_ps(vdy, x));
+    __m256 positive = _mm256_and_ps(_mm256_cmp_ps(sa, upper, _CMP_GT_OQ), one);
+    __m256 negative = _mm256_and_ps(_mm256_cmp_ps(sa, lower, _CMP_LT_OQ), one);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i),
+        _mm256_cvtps_epi32(_mm256_sub_ps(positive, negative)));
+  }
+
+  return i;
+}
+
+__attribute__((target("avx512f")))
+inline std::size_t CrossProductAvx512(double ax, double ay,
+                                      double dx, double dy,
+                                      const double* xs, const double* ys,
+                                      std::size_t size, double* result) {
+  const __m512d vax = _mm512_set1_pd(ax);
+  const __m512d vay = _mm512_set1_pd(ay);
+  const __m512d vdx = _mm512_set1_pd(dx);
+  const __m512d vdy = _mm512_set1_pd(dy);
+  std::size_t i = 0;
+
+  for (; i + 8 <= size; i += 8) {
+    __m512d x = _mm512_sub_pd(_mm512_loadu_pd(xs + i), vax);
+    __m512d y = _mm512_sub_pd(_mm512_loadu_pd(ys + i), vay);
+
+    _mm512_storeu_pd(result + i,
+        _mm512_sub_pd(_mm512_mul_pd(vdx, y), _mm512_mul_pd(vdy, x)));
+  }
+
+  return i;
+}
+
+__attribute__((target("avx512f")))
+inline std::size_t CrossProductAvx512(float ax, float ay, float dx, float dy,
+                                      const float* xs, const float* ys,
+                                      std::size_t size, float* result) {
+  const __m512 vax = _mm512_set1_ps(ax);
+  const __m512 vay = _mm512_set1_ps(ay);
+  const __m512 vdx = _mm512_set1_ps(dx);
+  const __m512 vdy = _mm512_set1_ps(dy);
+  std::size_t i = 0;
+
+  for (; i + 16 <= size; i += 16) {
+    __m512 x = _mm512_sub_ps(_mm512_loadu_ps(xs + i), vax);
+    __m512 y = _mm512_sub_ps(_mm512_loadu_ps(ys + i), vay);
+
+    _mm512_storeu_ps(result + i,
+        _mm512_sub_ps(_mm512_mul_ps(vdx, y), _mm512_mul_ps(vdy, x)));
+  }
+
+  return i;
+}
+
+__attribute__((target("avx512f")))
+inline std::size_t OrientationAvx512(double ax, double ay,
+                                     double dx, double dy,
+                                     const double* xs, const double* ys,
+                                     double precision,
+                                     std::size_t size, int* result) {
+  const __m512d vax = _mm512_set1_pd(ax);
+  const __m512d vay = _mm512_set1_pd(ay);
+  const __m512d vdx = _mm512_set1_pd(dx);
+  const __m512d vdy = _mm512_set1_pd(dy);
+  const __m512d upper = _mm512_set1_pd(precision);
+  const __m512d lower = _mm512_set1_pd(-precision);
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i minusOne = _mm512_set1_epi32(-1);
+  std::size_t i = 0;
+
+  for (; i + 8 <= size; i += 8) {
+    __m512d x = _mm512_sub_pd(_mm512_loadu_pd(xs + i), vax);
+    __m512d y = _mm512_sub_pd(_mm512_loadu_pd(ys + i), vay);
+    __m512d sa = _mm512_sub_pd(_mm512_mul_pd(vdx, y), _mm512_mul_pd(vdy, x));
+    // Знак собирается из масок сравнений в младших восьми 32-битных
+    // элементах; маска sa > precision применяется последней, как в
+    // скалярном ядре.
+    __m512i sign = _mm512_mask_mov_epi32(
+        _mm512_maskz_mov_epi32(
+            _mm512_cmp_pd_mask(sa, lower, _CMP_LT_OQ), minusOne),
+        _mm512_cmp_pd_mask(sa, upper, _CMP_GT_OQ), one);
+
+    _mm512_mask_storeu_epi32(result + i, 0xFF, sign);
+  }
+
+  return i;
+}
+
+__attribute__((target("avx512f")))
+inline std::size_t OrientationAvx512(float ax, float ay, float dx, float dy,
+                                     const float* xs, const float* ys,
+                                     float precision,
+                                     std::size_t size, int* result) {
+  const __m512 vax = _mm512_set1_ps(ax);
+  const __m512 vay = _mm512_set1_ps(ay);
+  const __m512 vdx = _mm512_set1_ps(dx);
+  const __m512 vdy = _mm512_set1_ps(dy);
+  const __m512 upper = _mm512_set1_ps(precision);
+  const __m512 lower = _mm512_set1_ps(-precision);
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i minusOne = _mm512_set1_epi32(-1);
+  std::size_t i = 0;
+
+  for (; i + 16 <= size; i += 16) {
+    __m512 x = _mm512_sub_ps(_mm512_loadu_ps(xs + i), vax);
+    __m512 y = _mm512_sub_ps(_mm512_loadu_ps(ys + i), vay);
+    __m512 sa = _mm512_sub_ps(_mm512_mul_ps(vdx, y), _mm512_mul_ps(vdy, x));
+    __m512i sign = _mm512_mask_mov_epi32(
+        _mm512_maskz_mov_epi32(
+            _mm512_cmp_ps_mask(sa, lower, _CMP_LT_OQ), minusOne),
+        _mm512_cmp_ps_mask(sa, upper, _CMP_GT_OQ), one);
+
+    _mm512_storeu_si512(result + i, sign);
+  }
+
+  return i;
+}
+
+#endif  // GEOMETRY_X86_SIMD
+
+/**
+ * @brief Вычислить векторные произведения для набора точек.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * @param a Первая точка прямой.
+ * @param b Вторая точка прямой.
+ * @param points Набор точек.
+ * @param result В этот массив запишутся значения векторных произведений.
+ * @param level Максимальный уровень векторных инструкций.
+ *
+ * Функция вычисляет CrossProduct(a, b, c) для каждой точки c из набора
+ * points. Для типов float и double используются ядра AVX2 или AVX-512,
+ * если они поддерживаются процессором, иначе используется скалярное ядро.
+ */
+template<typename T>
+void CrossProductBatch(const Point<T>& a, const Point<T>& b,
+                       const PointBuffer<T>& points, std::vector<T>* result,
+                       SimdLevel level = DetectSimdLevel()) {
+  const std::size_t size = points.Size();
+  const T dx = b.X() - a.X();
+  const T dy = b.Y() - a.Y();
+  std::size_t processed = 0;
+
+  result->resize(size);
+
+#ifdef GEOMETRY_X86_SIMD
+  if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+    switch (ClampSimdLevel(level)) {
+    case SimdLevel::Avx512:
+      processed = CrossProductAvx512(a.X(), a.Y(), dx, dy, points.XData(),
+          points.YData(), size, result->data());
+      break;
+    case SimdLevel::Avx2:
+      processed = CrossProductAvx2(a.X(), a.Y(), dx, dy, points.XData(),
+          points.YData(), size, result->data());
+      break;
+    default:
+      break;
+    }
+  }
+#else
+  (void) level;
+#endif
+
+  CrossProductKernel(a.X(), a.Y(), dx, dy, points.XData(), points.YData(),
+                     processed, size, result->data());
+}
+
+/**
+ * @brief Вычислить ориентацию для набора точек.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * @param pt0 Первая точка.
+ * @param pt1 Вторая точка.
+ * @param points Набор третьих точек.
+ * @param precision Абсолютная точность вычислений.
+ * @param result В этот массив запишутся значения ориентации.
+ * @param level Максимальный уровень векторных инструкций.
+ *
+ * Функция вычисляет Orientation(pt0, pt1, pt2, precision) для каждой точки
+ * pt2 из набора points.
+ */
+template<typename T>
+void OrientationBatch(const Point<T>& pt0, const Point<T>& pt1,
+                      const PointBuffer<T>& points, T precision,
+                      std::vector<int>* result,
+                      SimdLevel level = DetectSimdLevel()) {
+  const std::size_t size = points.Size();
+  const T dx = pt1.X() - pt0.X();
+  const T dy = pt1.Y() - pt0.Y();
+  std::size_t processed = 0;
+
+  result->resize(size);
+
+#ifdef GEOMETRY_X86_SIMD
+  if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+    switch (ClampSimdLevel(level)) {
+    case SimdLevel::Avx512:
+      processed = OrientationAvx512(pt0.X(), pt0.Y(), dx, dy, points.XData(),
+          points.YData(), precision, size, result->data());
+      break;
+    case SimdLevel::Avx2:
+      processed = OrientationAvx2(pt0.X(), pt0.Y(), dx, dy, points.XData(),
+          points.YData(), precision, size, result->data());
+      break;
+    default:
+      break;
+    }
+  }
+#else
+  (void) level;
+#endif
+
+  OrientationKernel(pt0.X(), pt0.Y(), dx, dy, points.XData(), points.YData(),
+                    precision, processed, size, result->data());
+}
+
+}  // namespace geometry
+
+#endif  // INCLUDE_ORIENTATION_BATCH_HPP_
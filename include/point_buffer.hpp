@@ -0,0 +1,205 @@
+/**
+ * @file include/point_buffer.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Определение и реализация контейнера точек с раздельным хранением координат.
+ */
+
+#ifndef INCLUDE_POINT_BUFFER_HPP_
+#define INCLUDE_POINT_BUFFER_HPP_
+
+#include <cstddef>
+#include <vector>
+#include <point.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Контейнер точек в формате "структура массивов".
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Координаты \f$ X \f$ и \f$ Y \f$ хранятся в двух отдельных непрерывных
+ * массивах. Такое расположение позволяет обрабатывать точки пакетами
+ * с помощью векторных инструкций (см. orientation_batch.hpp).
+ */
+template<typename T>
+class PointBuffer {
+ private:
+  //! Координаты \f$ X \f$.
+  std::vector<T> xs;
+  //! Координаты \f$ Y \f$.
+  std::vector<T> ys;
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Конструктор по-умолчанию.
+   *
+   * Создать пустой контейнер.
+   */
+  PointBuffer() = default;
+
+  /**
+   * @brief Создать контейнер заданного размера.
+   *
+   * @param size Количество точек.
+   *
+   * Все точки инициализируются нулями.
+   */
+  explicit PointBuffer(std::size_t size) :
+    xs(size),
+    ys(size)
+  { }
+
+  /**
+   * @brief Создать контейнер из массива точек.
+   *
+   * @param points Массив точек.
+   */
+  explicit PointBuffer(const std::vector<Point<T>>& points) :
+    xs(points.size()),
+    ys(points.size()) {
+    for (std::size_t i = 0; i < points.size(); i++) {
+      xs[i] = points[i].X();
+      ys[i] = points[i].Y();
+    }
+  }
+
+  /**
+   * @brief Преобразовать контейнер в массив точек.
+   * @return Функция возвращает массив точек в том же порядке.
+   */
+  std::vector<Point<T>> ToPoints() const {
+    std::vector<Point<T>> points;
+
+    points.reserve(xs.size());
+
+    for (std::size_t i = 0; i < xs.size(); i++)
+      points.emplace_back(xs[i], ys[i]);
+
+    return points;
+  }
+
+  /**
+   * @brief Получить количество точек.
+   * @return Функция возвращает количество точек в контейнере.
+   */
+  std::size_t Size() const { return xs.size(); }
+
+  /**
+   * @brief Проверить, пуст ли контейнер.
+   * @return Функция возвращает true, если контейнер не содержит точек.
+   */
+  bool Empty() const { return xs.empty(); }
+
+  /**
+   * @brief Зарезервировать память.
+   *
+   * @param capacity Количество точек, для которых резервируется память.
+   */
+  void Reserve(std::size_t capacity) {
+    xs.reserve(capacity);
+    ys.reserve(capacity);
+  }
+
+  /**
+   * @brief Изменить количество точек.
+   *
+   * @param size Новое количество точек.
+   */
+  void Resize(std::size_t size) {
+    xs.resize(size);
+    ys.resize(size);
+  }
+
+  /**
+   * @brief Удалить все точки.
+   */
+  void Clear() {
+    xs.clear();
+    ys.clear();
+  }
+
+  /**
+   * @brief Добавить точку в конец контейнера.
+   *
+   * @param point Добавляемая точка.
+   */
+  void PushBack(const Point<T>& point) {
+    xs.push_back(point.X());
+    ys.push_back(point.Y());
+  }
+
+  /**
+   * @brief Получить точку.
+   *
+   * @param index Номер точки.
+   * @return Функция возвращает копию точки с заданным номером.
+   */
+  Point<T> operator[](std::size_t index) const {
+    return Point<T>(xs[index], ys[index]);
+  }
+
+  /**
+   * @brief Получить значение \f$ X \f$ координаты точки.
+   *
+   * @param index Номер точки.
+   * @return \f$ X \f$ координата.
+   */
+  T X(std::size_t index) const { return xs[index]; }
+
+  /**
+   * @brief Изменить значение \f$ X \f$ координаты точки.
+   *
+   * @param index Номер точки.
+   * @return \f$ X \f$ координата.
+   */
+  T& X(std::size_t index) { return xs[index]; }
+
+  /**
+   * @brief Получить значение \f$ Y \f$ координаты точки.
+   *
+   * @param index Номер точки.
+   * @return \f$ Y \f$ координата.
+   */
+  T Y(std::size_t index) const { return ys[index]; }
+
+  /**
+   * @brief Изменить значение \f$ Y \f$ координаты точки.
+   *
+   * @param index Номер точки.
+   * @return \f$ Y \f$ координата.
+   */
+  T& Y(std::size_t index) { return ys[index]; }
+
+  /**
+   * @brief Получить указатель на массив \f$ X \f$ координат.
+   * @return Указатель на первый элемент массива.
+   */
+  const T* XData() const { return xs.data(); }
+
+  /**
+   * @brief Получить указатель на массив \f$ X \f$ координат.
+   * @return Указатель на первый элемент массива.
+   */
+  T* XData() { return xs.data(); }
+
+  /**
+   * @brief Получить указатель на массив \f$ Y \f$ координат.
+   * @return Указатель на первый элемент массива.
+   */
+  const T* YData() const { return ys.data(); }
+
+  /**
+   * @brief Получить указатель на массив \f$ Y \f$ координат.
+   * @return Указатель на первый элемент массива.
+   */
+  T* YData() { return ys.data(); }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POINT_BUFFER_HPP_
@@ -0,0 +1,547 @@
+/**
+ * @file include/point_in_polygon.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Определение положения точки относительно многоугольника по числу
+ * оборотов, в том числе для больших наборов точек.
+ */
+
+#ifndef INCLUDE_POINT_IN_POLYGON_HPP_
+#define INCLUDE_POINT_IN_POLYGON_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <orientation.hpp>
+#include <angle_point_in_polygon.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Проверить, что точка лежит на отрезке, если известно, что она
+ * лежит на его прямой.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @param point Точка.
+ * @param a Начало отрезка.
+ * @param b Конец отрезка.
+ * @param precision Абсолютная точность вычислений.
+ * @return Функция возвращает true, если точка лежит в ограничивающем
+ * прямоугольнике отрезка.
+ */
+template<typename T>
+bool InSegmentBox(const Point<T>& point, const Point<T>& a,
+                  const Point<T>& b, T precision) {
+  return point.X() >= std::min(a.X(), b.X()) - precision &&
+         point.X() <= std::max(a.X(), b.X()) + precision &&
+         point.Y() >= std::min(a.Y(), b.Y()) - precision &&
+         point.Y() <= std::max(a.Y(), b.Y()) + precision;
+}
+
+/**
+ * @brief Учесть ребро многоугольника в числе оборотов.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @param point Точка.
+ * @param a Начало ребра.
+ * @param b Конец ребра.
+ * @param precision Абсолютная точность вычислений.
+ * @param winding Указатель на число оборотов.
+ * @return Функция возвращает true, если точка лежит на ребре.
+ *
+ * Ребро, пересекающее горизонтальный луч из точки снизу вверх, и точка
+ * слева от него увеличивают число оборотов на 1, сверху вниз и точка
+ * справа --- уменьшают. Нижний конец ребра включается, а верхний нет,
+ * поэтому луч, проходящий через вершину, учитывается один раз. Рёбра,
+ * целиком лежащие выше или ниже горизонтали точки, отбрасываются без
+ * вычисления ориентации.
+ */
+template<typename T>
+bool WindingStep(const Point<T>& point, const Point<T>& a, const Point<T>& b,
+                 T precision, int* winding) {
+  const T y = point.Y();
+
+  // Большинство рёбер целиком выше или ниже горизонтали точки.
+  if ((a.Y() > y + precision && b.Y() > y + precision) ||
+      (a.Y() < y - precision && b.Y() < y - precision))
+    return false;
+
+  int orientation = Orientation(a, b, point, precision);
+
+  if (orientation == 0 && InSegmentBox(point, a, b, precision))
+    return true;
+
+  if (a.Y() <= y) {
+    if (b.Y() > y && orientation > 0)
+      (*winding)++;
+  } else if (b.Y() <= y && orientation < 0) {
+    (*winding)--;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Определить положение точки относительно многоугольника по числу
+ * оборотов.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @tparam Container Тип контейнера для хранения вершин.
+ * @param point Точка.
+ * @param polygon Многоугольник.
+ * @param precision Абсолютная точность вычисления ориентации.
+ * @return Функция возвращает положение точки.
+ *
+ * Для точек вне границы результат совпадает с AnglePointInPolygon(), но
+ * вместо двух вызовов Point::PolarAngle() на ребро используется одно
+ * векторное произведение (Orientation()) и только для рёбер, близких к
+ * горизонтали точки.
+ * Точка лежит на границе, если она коллинеарна ребру с точностью
+ * precision и лежит в его ограничивающем прямоугольнике. Рёбра обходятся
+ * с помощью Polygon::Edges() без копирования вершин и выделения памяти,
+ * направление обхода не важно.
+ */
+template<typename T, typename Container>
+PointPosition WindingNumberPointInPolygon(const Point<T>& point,
+    const Polygon<T, Container>& polygon, T precision = T(1e-9)) {
+  int winding = 0;
+  const auto edges = polygon.Edges();
+
+  for (auto edge = edges.begin(); edge != edges.end(); ++edge) {
+    if (WindingStep(point, edge.Origin(), edge.Destination(), precision,
+                    &winding))
+      return PointPosition::BOUNDARY;
+  }
+
+  return winding != 0 ? PointPosition::INSIDE : PointPosition::OUTSIDE;
+}
+
+/**
+ * @brief Проверить, что многоугольник строго выпуклый.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @tparam Container Тип контейнера для хранения вершин.
+ * @param polygon Многоугольник.
+ * @param precision Абсолютная точность вычисления ориентации.
+ * @return Функция возвращает 1, если вершины образуют строго выпуклый
+ * многоугольник с обходом против часовой стрелки, -1 --- по часовой
+ * стрелке, и 0, если многоугольник не выпуклый.
+ *
+ * Все повороты должны быть в одну сторону и отличаться от нуля с точностью
+ * precision, поэтому многоугольники с совпадающими или коллинеарными
+ * соседними вершинами, а также с меньше чем тремя вершинами считаются
+ * невыпуклыми. Знак \f$ X \f$-компоненты направления рёбер должен
+ * меняться ровно два раза, что отсекает звёздные многоугольники,
+ * обходящие точку несколько раз.
+ */
+template<typename T, typename Container>
+int IsConvex(const Polygon<T, Container>& polygon, T precision = T(1e-9)) {
+  if (polygon.Size() < 3)
+    return 0;
+
+  const auto edges = polygon.Edges();
+  auto first = edges.begin();
+  auto previous = first;
+  auto edge = first;
+  int turn = 0;
+  int firstDirection = 0;
+  int lastDirection = 0;
+  int flips = 0;
+
+  do {
+    previous = edge;
+    ++edge;
+
+    if (edge == edges.end())
+      edge = first;
+
+    const int current = Orientation(previous.Origin(), edge.Origin(),
+                                    edge.Destination(), precision);
+
+    if (current == 0 || (turn != 0 && current != turn))
+      return 0;
+
+    turn = current;
+
+    const T dx = previous.Destination().X() - previous.Origin().X();
+    const int direction = (dx > T(0)) - (dx < T(0));
+
+    if (direction != 0) {
+      if (firstDirection == 0)
+        firstDirection = direction;
+      else if (direction != lastDirection)
+        flips++;
+
+      lastDirection = direction;
+    }
+  } while (edge != first);
+
+  if (lastDirection != firstDirection)
+    flips++;
+
+  return flips == 2 ? turn : 0;
+}
+
+/**
+ * @brief Обработать диапазон индексов в нескольких потоках.
+ *
+ * @tparam Run Тип функции обработки части диапазона.
+ * @param n Размер диапазона.
+ * @param threads Количество потоков (0 --- по количеству аппаратных
+ * потоков).
+ * @param cost Оценка количества операций на один индекс.
+ * @param run Функция, вызываемая для частей [first, last).
+ *
+ * Диапазон \f$ [0, n) \f$ разбивается на непрерывные части, каждая из
+ * которых обрабатывается в отдельном потоке. При threads == 0 количество
+ * потоков подбирается так, чтобы на поток приходилось не меньше
+ * \f$ 2^{20} \f$ операций, поэтому небольшие диапазоны обрабатываются
+ * последовательно. Каждая часть получает свой поток ОС, поэтому их число
+ * ограничено MaxWorkerThreads() при любом значении threads.
+ */
+template<typename Run>
+void ParallelFor(std::size_t n, std::size_t threads, std::size_t cost,
+                 Run run) {
+  const std::size_t minWork = 1 << 20;
+
+  if (threads == 0) {
+    const std::size_t work = n * std::max<std::size_t>(cost, 1);
+
+    threads = std::max<std::size_t>(work / minWork, 1);
+  }
+
+  threads = std::min({threads, n, MaxWorkerThreads()});
+
+  if (threads <= 1) {
+    run(std::size_t(0), n);
+    return;
+  }
+
+  std::vector<std::future<void>> tasks;
+
+  for (std::size_t i = 0; i < threads; i++)
+    tasks.push_back(std::async(std::launch::async, run, n * i / threads,
+                               n * (i + 1) / threads));
+
+  for (auto& task : tasks)
+    task.get();
+}
+
+/**
+ * @brief Определить положение набора точек в нескольких потоках.
+ *
+ * @tparam Classifier Тип подготовленного многоугольника с функцией
+ * Classify(const Point<T>&).
+ * @tparam T Тип данных, используемый для арифметики.
+ * @param classifier Подготовленный многоугольник.
+ * @param points Точки.
+ * @param threads Количество потоков (0 --- по количеству аппаратных
+ * потоков).
+ * @param cost Оценка количества операций на одну точку.
+ * @return Функция возвращает положение каждой точки в порядке входа.
+ *
+ * Точки распределяются по потокам функцией ParallelFor().
+ */
+template<typename Classifier, typename T>
+std::vector<PointPosition> ClassifyInParallel(
+    const Classifier& classifier, const std::vector<Point<T>>& points,
+    std::size_t threads, std::size_t cost) {
+  std::vector<PointPosition> positions(points.size());
+
+  ParallelFor(points.size(), threads, cost,
+      [&classifier, &points, &positions](std::size_t first,
+                                         std::size_t last) {
+        for (std::size_t i = first; i < last; i++)
+          positions[i] = classifier.Classify(points[i]);
+      });
+
+  return positions;
+}
+
+/**
+ * @brief Многоугольник, подготовленный для проверки большого количества
+ * точек.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * При создании вычисляются ограничивающий прямоугольник и направления
+ * рёбер, а вершины копируются в непрерывные массивы координат. Результат
+ * Classify() совпадает с WindingNumberPointInPolygon() для того же
+ * многоугольника и той же точности, за исключением точек вне
+ * ограничивающего прямоугольника, расширенного на precision: они сразу
+ * считаются внешними.
+ *
+ * Если многоугольник строго выпуклый (см. IsConvex()), то Classify()
+ * находит двоичным поиском сектор между лучами из первой вершины,
+ * содержащий точку, и проверяет только ребро этого сектора и соседние с
+ * ним, т.е. работает за \f$ O(\log n) \f$. Результат отличается от
+ * WindingNumberPointInPolygon() только если точка попадает в окрестность
+ * несмежного ребра, что возможно лишь для рёбер короче precision.
+ *
+ * Объект не изменяется после создания, поэтому Classify() можно вызывать
+ * из нескольких потоков одновременно.
+ */
+template<typename T>
+class PreparedPolygon {
+ private:
+  //! Координаты \f$ X \f$ начал рёбер и, в конце, начала первого ребра.
+  std::vector<T> xs;
+  //! Координаты \f$ Y \f$ начал рёбер и, в конце, начала первого ребра.
+  std::vector<T> ys;
+  //! Приращения \f$ X \f$ вдоль рёбер.
+  std::vector<T> dxs;
+  //! Приращения \f$ Y \f$ вдоль рёбер.
+  std::vector<T> dys;
+  //! Левый нижний угол ограничивающего прямоугольника.
+  Point<T> lower;
+  //! Правый верхний угол ограничивающего прямоугольника.
+  Point<T> upper;
+  //! Абсолютная точность вычисления ориентации.
+  T precision;
+  //! Результат IsConvex() для многоугольника.
+  int convex;
+
+  /**
+   * @brief Проверить, лежит ли точка на ребре.
+   *
+   * @param i Номер ребра.
+   * @param px Координата \f$ X \f$ точки.
+   * @param py Координата \f$ Y \f$ точки.
+   * @return Функция возвращает true, если точка лежит на ребре с
+   * точностью precision.
+   */
+  bool OnEdge(std::size_t i, T px, T py) const {
+    const T ax = xs[i];
+    const T ay = ys[i];
+    const T cross = dxs[i] * (py - ay) - (px - ax) * dys[i];
+
+    if (cross < -precision || cross > precision)
+      return false;
+
+    const T bx = xs[i + 1];
+    const T by = ys[i + 1];
+
+    return px >= std::min(ax, bx) - precision &&
+           px <= std::max(ax, bx) + precision &&
+           py >= std::min(ay, by) - precision &&
+           py <= std::max(ay, by) + precision;
+  }
+
+  /**
+   * @brief Определить положение точки относительно выпуклого
+   * многоугольника.
+   *
+   * @param px Координата \f$ X \f$ точки.
+   * @param py Координата \f$ Y \f$ точки.
+   * @return Функция возвращает положение точки.
+   *
+   * Лучи из первой вершины ко всем остальным упорядочены по углу, поэтому
+   * сектор, содержащий точку, находится двоичным поиском. На границе
+   * точка может лежать только на ребре сектора, соседних с ним рёбрах или
+   * рёбрах, выходящих из первой вершины.
+   */
+  PointPosition ClassifyConvex(T px, T py) const {
+    const std::size_t n = dxs.size();
+    const T x0 = xs[0];
+    const T y0 = ys[0];
+
+    // Ориентация луча из первой вершины в вершину i и точки, с учётом
+    // направления обхода.
+    auto side = [&](std::size_t i) {
+      return convex * ((xs[i] - x0) * (py - y0) - (ys[i] - y0) * (px - x0));
+    };
+
+    if (side(1) < T(0) || side(n - 1) > T(0)) {
+      for (std::size_t i : {std::size_t(0), std::size_t(1), n - 2, n - 1}) {
+        if (OnEdge(i, px, py))
+          return PointPosition::BOUNDARY;
+      }
+
+      return PointPosition::OUTSIDE;
+    }
+
+    std::size_t low = 2;
+    std::size_t high = n;
+
+    while (low < high) {
+      const std::size_t middle = low + (high - low) / 2;
+
+      if (side(middle) >= T(0))
+        low = middle + 1;
+      else
+        high = middle;
+    }
+
+    const std::size_t wedge = std::min(low - 1, n - 2);
+
+    for (std::size_t i : {wedge, wedge - 1, wedge + 1, std::size_t(0),
+                          n - 1}) {
+      if (OnEdge(i, px, py))
+        return PointPosition::BOUNDARY;
+    }
+
+    const T cross = dxs[wedge] * (py - ys[wedge]) -
+                    (px - xs[wedge]) * dys[wedge];
+
+    return convex * cross > T(0) ? PointPosition::INSIDE :
+                                   PointPosition::OUTSIDE;
+  }
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Подготовить многоугольник.
+   *
+   * @tparam Container Тип контейнера для хранения вершин.
+   * @param polygon Многоугольник.
+   * @param precision Абсолютная точность вычисления ориентации.
+   */
+  template<typename Container>
+  explicit PreparedPolygon(const Polygon<T, Container>& polygon,
+                           T precision = T(1e-9)) :
+    lower(std::numeric_limits<T>::max(), std::numeric_limits<T>::max()),
+    upper(std::numeric_limits<T>::lowest(),
+          std::numeric_limits<T>::lowest()),
+    precision(precision),
+    convex(geometry::IsConvex(polygon, precision)) {
+    const auto edges = polygon.Edges();
+
+    xs.reserve(polygon.Size() + 1);
+    ys.reserve(polygon.Size() + 1);
+    dxs.reserve(polygon.Size());
+    dys.reserve(polygon.Size());
+
+    for (auto edge = edges.begin(); edge != edges.end(); ++edge) {
+      const Point<T>& a = edge.Origin();
+      const Point<T> d = edge.Destination() - a;
+
+      xs.push_back(a.X());
+      ys.push_back(a.Y());
+      dxs.push_back(d.X());
+      dys.push_back(d.Y());
+
+      lower = Point<T>(std::min(lower.X(), a.X()), std::min(lower.Y(), a.Y()));
+      upper = Point<T>(std::max(upper.X(), a.X()), std::max(upper.Y(), a.Y()));
+    }
+
+    if (!xs.empty()) {
+      xs.push_back(xs.front());
+      ys.push_back(ys.front());
+    }
+  }
+
+  /**
+   * @brief Определить положение точки.
+   *
+   * @param point Точка.
+   * @return Функция возвращает положение точки относительно многоугольника.
+   *
+   * Вычисления те же, что и в WindingStep(), но ориентация считается по
+   * заранее вычисленным приращениям вдоль рёбер. Для выпуклого
+   * многоугольника проверяется \f$ O(\log n) \f$ рёбер.
+   */
+  PointPosition Classify(const Point<T>& point) const {
+    const T px = point.X();
+    const T py = point.Y();
+
+    if (dxs.empty() || px < lower.X() - precision ||
+        px > upper.X() + precision || py < lower.Y() - precision ||
+        py > upper.Y() + precision)
+      return PointPosition::OUTSIDE;
+
+    if (convex != 0)
+      return ClassifyConvex(px, py);
+
+    int winding = 0;
+
+    for (std::size_t i = 0; i < dxs.size(); i++) {
+      const T ay = ys[i];
+      const T by = ys[i + 1];
+
+      if ((ay > py + precision && by > py + precision) ||
+          (ay < py - precision && by < py - precision))
+        continue;
+
+      const T ax = xs[i];
+      const T cross = dxs[i] * (py - ay) - (px - ax) * dys[i];
+
+      if (cross >= -precision && cross <= precision) {
+        const T bx = xs[i + 1];
+
+        if (px >= std::min(ax, bx) - precision &&
+            px <= std::max(ax, bx) + precision &&
+            py >= std::min(ay, by) - precision &&
+            py <= std::max(ay, by) + precision)
+          return PointPosition::BOUNDARY;
+
+        continue;
+      }
+
+      if (ay <= py) {
+        if (by > py && cross > precision)
+          winding++;
+      } else if (by <= py && cross < -precision) {
+        winding--;
+      }
+    }
+
+    return winding != 0 ? PointPosition::INSIDE : PointPosition::OUTSIDE;
+  }
+
+  /**
+   * @brief Определить положение набора точек.
+   *
+   * @param points Точки.
+   * @param threads Количество потоков (0 --- по количеству аппаратных
+   * потоков).
+   * @return Функция возвращает положение каждой точки в порядке входа.
+   *
+   * Точки разбиваются на непрерывные части, каждая из которых
+   * обрабатывается в отдельном потоке. При threads == 0 количество потоков
+   * подбирается так, чтобы на поток приходилось не меньше \f$ 2^{20} \f$
+   * пар "точка-ребро", поэтому небольшие наборы обрабатываются
+   * последовательно.
+   */
+  std::vector<PointPosition> Classify(const std::vector<Point<T>>& points,
+                                      std::size_t threads = 0) const {
+    const std::size_t cost = convex != 0 ? 1 : dxs.size();
+
+    return ClassifyInParallel(*this, points, threads, cost);
+  }
+
+  /**
+   * @brief Получить количество рёбер.
+   * @return Функция возвращает количество рёбер многоугольника.
+   */
+  std::size_t Size() const { return dxs.size(); }
+
+  /**
+   * @brief Проверить, используется ли проверка для выпуклых
+   * многоугольников.
+   * @return Функция возвращает true, если многоугольник строго выпуклый.
+   */
+  bool IsConvex() const { return convex != 0; }
+
+  /**
+   * @brief Получить левый нижний угол ограничивающего прямоугольника.
+   * @return Функция возвращает точку с наименьшими координатами.
+   */
+  const Point<T>& Lower() const { return lower; }
+
+  /**
+   * @brief Получить правый верхний угол ограничивающего прямоугольника.
+   * @return Функция возвращает точку с наибольшими координатами.
+   */
+  const Point<T>& Upper() const { return upper; }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POINT_IN_POLYGON_HPP_
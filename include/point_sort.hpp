@@ -0,0 +1,261 @@
+/**
+ * @file include/point_sort.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Лексикографическая сортировка точек поразрядной сортировкой.
+ */
+
+#ifndef INCLUDE_POINT_SORT_HPP_
+#define INCLUDE_POINT_SORT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <point.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Способ упорядочивания точек.
+ */
+enum class PointSort {
+  Comparison,  ///< std::sort() с Point::operator<()
+  Radix        ///< RadixSort()
+};
+
+/**
+ * @brief Можно ли сортировать координаты данного типа функцией RadixSort().
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Поддерживаются float, double и целые типы. Для остальных типов
+ * (например, long double) SortPoints() использует std::sort().
+ */
+template<typename T>
+constexpr bool radixSortable =
+    std::is_same_v<T, float> || std::is_same_v<T, double> ||
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>);
+
+/**
+ * @brief Получить беззнаковый ключ, сохраняющий порядок чисел.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @param value Число.
+ * @return Функция возвращает беззнаковое целое того же размера, что и T.
+ *
+ * Для любых a и b из a < b следует OrderedKey(a) < OrderedKey(b), а из
+ * a == b следует OrderedKey(a) == OrderedKey(b). Для чисел с плавающей
+ * точкой у отрицательных чисел инвертируются все биты, а у остальных
+ * только знаковый бит; -0.0 предварительно заменяется на +0.0.
+ * Порядок чисел NaN не определён.
+ */
+template<typename T>
+auto OrderedKey(T value) {
+  static_assert(radixSortable<T>, "OrderedKey: unsupported type");
+
+  if constexpr (std::is_floating_point_v<T>) {
+    using Key = std::conditional_t<sizeof(T) == 4, std::uint32_t,
+                                   std::uint64_t>;
+    const Key sign = Key(1) << (sizeof(Key) * 8 - 1);
+    Key bits;
+
+    value += T(0);
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    return (bits & sign) ? Key(~bits) : Key(bits | sign);
+  } else {
+    using Key = std::make_unsigned_t<T>;
+    Key key = static_cast<Key>(value);
+
+    if constexpr (std::is_signed_v<T>)
+      key ^= Key(1) << (sizeof(Key) * 8 - 1);
+
+    return key;
+  }
+}
+
+/**
+ * @brief Поразрядная сортировка точек по одной координате.
+ *
+ * @tparam RandomIt Итератор произвольного доступа на Point<T>.
+ * @param first Начало последовательности.
+ * @param last Конец последовательности.
+ * @param byX Если true, то точки сортируются по \f$ X \f$, иначе по
+ * \f$ Y \f$.
+ * @param counts Память для гистограмм, которую можно передавать в
+ * несколько вызовов подряд.
+ *
+ * Устойчивая LSD сортировка по ключам OrderedKey() по 13 бит за проход.
+ * Гистограммы всех проходов строятся за один просмотр точек; проходы, в
+ * которых все точки попадают в одну корзину, пропускаются. Дополнительная
+ * память --- буфер на \f$ n \f$ точек и гистограммы по 8192 счётчика на
+ * проход (320 КБ для double), которые обнуляются при каждом вызове.
+ */
+template<typename RandomIt>
+void RadixSortByCoordinate(RandomIt first, RandomIt last, bool byX,
+                           std::vector<std::size_t>* counts) {
+  using PointType = typename std::iterator_traits<RandomIt>::value_type;
+  using T = typename PointType::ValueType;
+  using Key = decltype(OrderedKey(T()));
+
+  const int digitBits = 13;
+  const std::size_t radix = std::size_t(1) << digitBits;
+  const int passes = (sizeof(Key) * 8 + digitBits - 1) / digitBits;
+
+  std::size_t n = last - first;
+
+  auto key = [byX](const PointType& point) {
+    return OrderedKey(byX ? point.X() : point.Y());
+  };
+
+  counts->assign(passes * radix, 0);
+
+  for (RandomIt it = first; it != last; ++it) {
+    Key value = key(*it);
+
+    for (int pass = 0; pass < passes; pass++) {
+      (*counts)[pass * radix +
+                ((value >> (pass * digitBits)) & (radix - 1))]++;
+    }
+  }
+
+  std::vector<int> active;
+
+  for (int pass = 0; pass < passes; pass++) {
+    std::size_t* count = counts->data() + pass * radix;
+
+    if (*std::max_element(count, count + radix) == n)
+      continue;
+
+    active.push_back(pass);
+
+    std::size_t offset = 0;
+
+    for (std::size_t i = 0; i < radix; i++) {
+      std::size_t size = count[i];
+
+      count[i] = offset;
+      offset += size;
+    }
+  }
+
+  if (active.empty())
+    return;
+
+  auto scatter = [&](auto source, auto destination, int pass) {
+    std::size_t* offset = counts->data() + pass * radix;
+    const int shift = pass * digitBits;
+
+    for (std::size_t i = 0; i < n; i++) {
+      const PointType& point = source[i];
+      std::size_t digit = (key(point) >> shift) & (radix - 1);
+
+      destination[offset[digit]++] = point;
+    }
+  };
+
+  std::vector<PointType> buffer(n);
+
+  // Проходы переносят точки из последовательности в буфер и обратно.
+  for (std::size_t i = 0; i < active.size(); i++) {
+    if (i % 2 == 0)
+      scatter(first, buffer.begin(), active[i]);
+    else
+      scatter(buffer.begin(), first, active[i]);
+  }
+
+  if (active.size() % 2 == 1)
+    std::copy(buffer.begin(), buffer.end(), first);
+}
+
+/**
+ * @brief Поразрядная сортировка точек в лексикографическом порядке.
+ *
+ * @tparam RandomIt Итератор произвольного доступа на Point<T>.
+ * @param first Начало последовательности.
+ * @param last Конец последовательности.
+ *
+ * Функция упорядочивает точки так же, как std::sort() с
+ * Point::operator<(), т.е. по \f$ X \f$, а при равных \f$ X \f$ по
+ * \f$ Y \f$. Координаты переводятся функцией OrderedKey() в беззнаковые
+ * ключи. Сначала точки сортируются RadixSortByCoordinate() по \f$ X \f$,
+ * затем каждая группа точек с равными \f$ X \f$ сортируется по
+ * \f$ Y \f$. У точек общего положения все \f$ X \f$ различны, поэтому
+ * проходы по \f$ Y \f$ почти никогда не нужны.
+ *
+ * Время работы \f$ O(n) \f$. Гистограммы выделяются один раз на все
+ * вызовы RadixSortByCoordinate(). Короткие последовательности и группы
+ * сортируются std::sort(), поэтому порядок равных точек не гарантируется.
+ */
+template<typename RandomIt>
+void RadixSort(RandomIt first, RandomIt last) {
+  using PointType = typename std::iterator_traits<RandomIt>::value_type;
+  using T = typename PointType::ValueType;
+
+  static_assert(radixSortable<T>, "RadixSort: unsupported coordinate type");
+
+  // Каждый вызов RadixSortByCoordinate() обнуляет и просматривает
+  // гистограммы из десятков тысяч счётчиков; std::sort() обходится
+  // дешевле примерно до 4096 точек.
+  const std::size_t minSize = 4096;
+
+  if (static_cast<std::size_t>(last - first) < minSize) {
+    std::sort(first, last);
+    return;
+  }
+
+  std::vector<std::size_t> counts;
+
+  RadixSortByCoordinate(first, last, true, &counts);
+
+  auto sameX = [](const PointType& a, const PointType& b) {
+    return OrderedKey(a.X()) == OrderedKey(b.X());
+  };
+
+  for (RandomIt begin = first; begin != last; ) {
+    RandomIt end = begin + 1;
+
+    while (end != last && sameX(*begin, *end))
+      ++end;
+
+    if (static_cast<std::size_t>(end - begin) >= minSize)
+      RadixSortByCoordinate(begin, end, false, &counts);
+    else if (end - begin > 1)
+      std::sort(begin, end);
+
+    begin = end;
+  }
+}
+
+/**
+ * @brief Упорядочить точки в лексикографическом порядке.
+ *
+ * @tparam RandomIt Итератор произвольного доступа на Point<T>.
+ * @param first Начало последовательности.
+ * @param last Конец последовательности.
+ * @param method Способ сортировки.
+ *
+ * Для типов, не поддерживаемых RadixSort(), всегда используется
+ * std::sort().
+ */
+template<typename RandomIt>
+void SortPoints(RandomIt first, RandomIt last, PointSort method) {
+  using PointType = typename std::iterator_traits<RandomIt>::value_type;
+
+  if constexpr (radixSortable<typename PointType::ValueType>) {
+    if (method == PointSort::Radix) {
+      RadixSort(first, last);
+      return;
+    }
+  }
+
+  std::sort(first, last);
+}
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POINT_SORT_HPP_
@@ -0,0 +1,305 @@
+/**
+ * @file include/point_stream.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Чтение точек из потока данных по частям.
+ */
+
+#ifndef INCLUDE_POINT_STREAM_HPP_
+#define INCLUDE_POINT_STREAM_HPP_
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <point.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Формат потока точек.
+ */
+enum class PointFormat {
+  Csv,    ///< Текст, по точке "x,y" в строке
+  Binary  ///< Пары чисел типа T (x, y) в порядке байтов машины
+};
+
+/**
+ * @brief Разбор потока точек, поступающего частями произвольного размера.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Данные передаются функции Feed() в том виде, в каком они приходят
+ * (блоками файла или частями HTTP запроса); строка или запись, разрезанная
+ * между частями, сохраняется до следующего вызова. Парсер хранит не больше
+ * одной незавершённой строки длиной не больше maxLineLength, поэтому объём
+ * памяти не зависит от размера потока.
+ *
+ * В формате CSV координаты разделяются запятой, точкой с запятой или
+ * пробелами. Пустые строки и строки, начинающиеся с '#', пропускаются.
+ * Первая непустая строка, не начинающаяся с числа, считается заголовком.
+ */
+template<typename T>
+class PointStreamParser {
+ private:
+  static_assert(std::is_floating_point_v<T>,
+                "PointStreamParser: T must be a floating point type");
+
+  //! Размер записи в двоичном формате.
+  static constexpr std::size_t recordSize = 2 * sizeof(T);
+
+  /**
+   * @brief Проверить, что незавершённая строка не длиннее maxLineLength.
+   *
+   * @param size Длина строки.
+   *
+   * @throw std::invalid_argument если строка слишком длинная.
+   */
+  void CheckLineLength(std::size_t size) const {
+    if (size > maxLineLength)
+      throw std::invalid_argument("PointStreamParser: CSV line " +
+                                  std::to_string(line + 1) +
+                                  " is longer than " +
+                                  std::to_string(maxLineLength) + " bytes");
+  }
+
+  //! Формат потока.
+  PointFormat format;
+  //! Незавершённая строка или запись.
+  std::string pending;
+  //! Номер текущей строки (для сообщений об ошибках).
+  std::size_t line = 0;
+  //! Количество разобранных непустых строк.
+  std::size_t numRecords = 0;
+
+  /**
+   * @brief Прочитать число.
+   *
+   * @param begin Начало строки.
+   * @param end Указатель, по которому записывается конец числа.
+   * @return Функция возвращает прочитанное число.
+   */
+  static T Parse(const char* begin, char** end) {
+    if constexpr (std::is_same_v<T, float>)
+      return std::strtof(begin, end);
+    else if constexpr (std::is_same_v<T, double>)
+      return std::strtod(begin, end);
+    else
+      return std::strtold(begin, end);
+  }
+
+  /**
+   * @brief Разобрать строку CSV.
+   *
+   * @param text Строка без символа конца строки.
+   * @param consume Функция, которой передаётся точка.
+   */
+  template<typename Consumer>
+  void ParseLine(const std::string& text, Consumer& consume) {
+    line++;
+
+    const char* begin = text.c_str();
+
+    while (std::isspace(static_cast<unsigned char>(*begin)))
+      begin++;
+
+    if (*begin == '\0' || *begin == '#')
+      return;
+
+    char* end;
+    T x = Parse(begin, &end);
+    bool valid = end != begin;
+
+    const char* next = end;
+
+    while (std::isspace(static_cast<unsigned char>(*next)))
+      next++;
+
+    if (*next == ',' || *next == ';')
+      next++;
+
+    T y = Parse(next, &end);
+    valid = valid && end != next;
+
+    while (valid && std::isspace(static_cast<unsigned char>(*end)))
+      end++;
+
+    valid = valid && *end == '\0';
+
+    if (!valid) {
+      if (numRecords++ == 0 &&
+          !std::isdigit(static_cast<unsigned char>(*begin)) &&
+          *begin != '-' && *begin != '+' && *begin != '.')
+        return;
+
+      throw std::invalid_argument("PointStreamParser: invalid CSV line " +
+                                  std::to_string(line));
+    }
+
+    numRecords++;
+
+    if (!std::isfinite(x) || !std::isfinite(y))
+      throw std::invalid_argument("PointStreamParser: non-finite coordinate"
+                                  " in CSV line " + std::to_string(line));
+
+    consume(Point<T>(x, y));
+  }
+
+  /**
+   * @brief Прочитать точку из двоичной записи.
+   *
+   * @param data Указатель на запись.
+   * @return Функция возвращает точку.
+   *
+   * @throw std::invalid_argument если координата равна NaN или
+   * бесконечности.
+   */
+  static Point<T> Record(const char* data) {
+    T coords[2];
+
+    std::memcpy(coords, data, recordSize);
+
+    if (!std::isfinite(coords[0]) || !std::isfinite(coords[1]))
+      throw std::invalid_argument(
+          "PointStreamParser: non-finite coordinate in binary record");
+
+    return Point<T>(coords[0], coords[1]);
+  }
+
+ public:
+  //! Наибольшая длина строки CSV (строка "x,y" занимает меньше 100 байт).
+  static constexpr std::size_t maxLineLength = 1024;
+
+  /**
+   * @brief Создать парсер.
+   *
+   * @param format Формат потока.
+   */
+  explicit PointStreamParser(PointFormat format) : format(format) { }
+
+  /**
+   * @brief Разобрать очередную часть потока.
+   *
+   * @tparam Consumer Тип функции, принимающей Point<T>.
+   * @param data Указатель на данные.
+   * @param size Размер данных в байтах.
+   * @param consume Функция, которой передаётся каждая прочитанная точка.
+   *
+   * @throw std::invalid_argument если строка CSV не является точкой,
+   * длиннее maxLineLength или координата точки равна NaN или бесконечности.
+   */
+  template<typename Consumer>
+  void Feed(const char* data, std::size_t size, Consumer&& consume) {
+    const char* end = data + size;
+
+    if (format == PointFormat::Binary) {
+      if (!pending.empty()) {
+        std::size_t missing = std::min(recordSize - pending.size(), size);
+
+        pending.append(data, missing);
+        data += missing;
+
+        if (pending.size() < recordSize)
+          return;
+
+        consume(Record(pending.data()));
+        pending.clear();
+      }
+
+      for (; static_cast<std::size_t>(end - data) >= recordSize;
+           data += recordSize)
+        consume(Record(data));
+
+      pending.assign(data, end);
+
+      return;
+    }
+
+    while (data != end) {
+      const char* newline = static_cast<const char*>(
+          std::memchr(data, '\n', end - data));
+
+      if (!newline) {
+        CheckLineLength(pending.size() + (end - data));
+        pending.append(data, end);
+        return;
+      }
+
+      CheckLineLength(pending.size() + (newline - data));
+      pending.append(data, newline);
+
+      if (!pending.empty() && pending.back() == '\r')
+        pending.pop_back();
+
+      ParseLine(pending, consume);
+      pending.clear();
+      data = newline + 1;
+    }
+  }
+
+  /**
+   * @brief Завершить разбор потока.
+   *
+   * @tparam Consumer Тип функции, принимающей Point<T>.
+   * @param consume Функция, которой передаётся последняя точка.
+   *
+   * Последняя строка CSV может не заканчиваться символом конца строки.
+   *
+   * @throw std::invalid_argument если поток обрывается посреди записи.
+   */
+  template<typename Consumer>
+  void Finish(Consumer&& consume) {
+    if (format == PointFormat::Binary) {
+      if (!pending.empty())
+        throw std::invalid_argument(
+            "PointStreamParser: truncated binary record");
+
+      return;
+    }
+
+    if (!pending.empty() && pending.back() == '\r')
+      pending.pop_back();
+
+    if (!pending.empty())
+      ParseLine(pending, consume);
+
+    pending.clear();
+  }
+};
+
+/**
+ * @brief Прочитать точки из потока блоками фиксированного размера.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @tparam Consumer Тип функции, принимающей Point<T>.
+ * @param stream Поток (для двоичного формата открытый в режиме binary).
+ * @param format Формат потока.
+ * @param consume Функция, которой передаётся каждая прочитанная точка.
+ * @param blockSize Размер блока чтения в байтах.
+ *
+ * @throw std::invalid_argument если данные не соответствуют формату.
+ */
+template<typename T, typename Consumer>
+void ReadPoints(std::istream& stream, PointFormat format, Consumer&& consume,
+                std::size_t blockSize = 1 << 20) {
+  PointStreamParser<T> parser(format);
+  std::vector<char> block(blockSize);
+
+  while (stream) {
+    stream.read(block.data(), block.size());
+    parser.Feed(block.data(), stream.gcount(), consume);
+  }
+
+  parser.Finish(consume);
+}
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POINT_STREAM_HPP_
@@ -8,7 +8,10 @@
 #ifndef INCLUDE_POLYGON_HPP_
 #define INCLUDE_POLYGON_HPP_
 
+#include <cstddef>
+#include <iterator>
 #include <list>
+#include <type_traits>
 #include <common.hpp>
 
 namespace geometry {
@@ -27,6 +30,11 @@ class Edge;
  *
  * Предполагается, что многоугольник хранит вершины в порядке обхода по часовой
  * стрелке.
+ *
+ * Рекомендуется использовать контейнер CyclicVector<Point<T>>
+ * (см. cyclic_vector.hpp). Для контейнеров с итераторами произвольного
+ * доступа переход к соседней вершине вычисляется по номеру вершины, а
+ * копирование и перемещение многоугольника не требуют обхода контейнера.
  */
 template<typename T, typename Container = std::list<Point<T>>>
 class Polygon {
@@ -36,12 +44,168 @@ class Polygon {
   //! Текущая вершина.
   typename Container::iterator current;
 
+  //! Если true, то итераторы контейнера поддерживают произвольный доступ.
+  static constexpr bool randomAccess = std::is_base_of_v<
+      std::random_access_iterator_tag,
+      typename std::iterator_traits<
+          typename Container::iterator>::iterator_category>;
+
  public:
   //! Тип данных, используемый для арифметики.
   using ValueType = T;
   //! Тип контейнера для хранения вершин.
   using ContainerType = Container;
 
+  /**
+   * @brief Константный итератор по рёбрам многоугольника.
+   *
+   * Итератор хранит итератор на начало ребра и при переходе за последнюю
+   * вершину контейнера возвращается к первой. Ни итератор, ни обход не
+   * копируют вершины и не выделяют память.
+   */
+  class EdgeIterator {
+   private:
+    //! Вершины многоугольника.
+    const Container* vertices;
+    //! Начало текущего ребра.
+    typename Container::const_iterator origin;
+    //! Конец текущего ребра.
+    typename Container::const_iterator destination;
+    //! Количество пройденных рёбер.
+    std::size_t index;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Edge<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Edge<T>;
+
+    /**
+     * @brief Создать итератор.
+     *
+     * @param vertices Вершины многоугольника.
+     * @param origin Начало ребра.
+     * @param index Номер ребра в обходе.
+     */
+    EdgeIterator(const Container* vertices,
+                 typename Container::const_iterator origin,
+                 std::size_t index) :
+      vertices(vertices),
+      origin(origin),
+      destination(origin),
+      index(index) {
+      if (origin != vertices->end() && ++destination == vertices->end())
+        destination = vertices->begin();
+    }
+
+    /**
+     * @brief Получить начало текущего ребра.
+     * @return Функция возвращает ссылку на вершину в контейнере.
+     */
+    const Point<T>& Origin() const { return *origin; }
+
+    /**
+     * @brief Получить конец текущего ребра.
+     * @return Функция возвращает ссылку на вершину в контейнере.
+     */
+    const Point<T>& Destination() const { return *destination; }
+
+    /**
+     * @brief Получить текущее ребро.
+     * @return Функция возвращает копию текущего ребра.
+     */
+    Edge<T> operator*() const { return Edge<T>(*origin, *destination); }
+
+    /**
+     * @brief Перейти к следующему ребру по часовой стрелке.
+     * @return Функция возвращает ссылку на текущий итератор.
+     */
+    EdgeIterator& operator++() {
+      origin = destination;
+
+      if (++destination == vertices->end())
+        destination = vertices->begin();
+
+      index++;
+
+      return *this;
+    }
+
+    /**
+     * @brief Перейти к следующему ребру по часовой стрелке.
+     * @return Функция возвращает итератор до перехода.
+     */
+    EdgeIterator operator++(int) {
+      EdgeIterator old = *this;
+
+      ++*this;
+
+      return old;
+    }
+
+    /**
+     * @brief Сравнить итераторы одного обхода.
+     *
+     * @param other Другой итератор.
+     * @return Функция возвращает true, если итераторы указывают на одно
+     * и то же ребро обхода.
+     */
+    bool operator==(const EdgeIterator& other) const {
+      return index == other.index;
+    }
+
+    /**
+     * @brief Сравнить итераторы одного обхода.
+     *
+     * @param other Другой итератор.
+     * @return Функция возвращает false, если итераторы указывают на одно
+     * и то же ребро обхода.
+     */
+    bool operator!=(const EdgeIterator& other) const {
+      return index != other.index;
+    }
+  };
+
+  /**
+   * @brief Диапазон рёбер многоугольника.
+   *
+   * Обход начинается с ребра, выходящего из текущей вершины, и идёт по
+   * часовой стрелке, т.е. в том же порядке, что и вызовы GetEdge() и
+   * Advance(Rotation::ClockWise). Диапазон действителен, пока не изменяется
+   * контейнер вершин.
+   */
+  class EdgeRange {
+   private:
+    //! Вершины многоугольника.
+    const Container* vertices;
+    //! Начало первого ребра.
+    typename Container::const_iterator first;
+    //! Количество рёбер.
+    std::size_t size;
+
+   public:
+    /**
+     * @brief Создать диапазон.
+     *
+     * @param vertices Вершины многоугольника.
+     * @param first Начало первого ребра.
+     * @param size Количество рёбер.
+     */
+    EdgeRange(const Container* vertices,
+              typename Container::const_iterator first, std::size_t size) :
+      vertices(vertices),
+      first(first),
+      size(size)
+    { }
+
+    //! Получить итератор на первое ребро.
+    EdgeIterator begin() const { return EdgeIterator(vertices, first, 0); }
+
+    //! Получить итератор за последним ребром.
+    EdgeIterator end() const { return EdgeIterator(vertices, first, size); }
+  };
+
   /**
    * @brief Конструктор по-умолчанию.
    *
@@ -60,6 +224,17 @@ class Polygon {
    */
   explicit Polygon(const Container& vertices);
 
+  /**
+   * @brief Создать многоугольник из заданного набора вершин.
+   *
+   * @param vertices Вершины.
+   *
+   * Функция перемещает вершины в многоугольник без копирования.
+   * Первая вершина в контейнере становится текущей. Предполагается,
+   * что вершины лежат в контейнере в порядке обхода по часовой стрелке.
+   */
+  explicit Polygon(Container&& vertices);
+
   /**
    * @brief Создать многоугольник из заданного набора вершин.
    *
@@ -137,6 +312,15 @@ class Polygon {
    */
   Edge<T> GetEdge() const;
 
+  /**
+   * @brief Получить рёбра многоугольника.
+   * @return Функция возвращает диапазон всех рёбер, начиная с текущего.
+   *
+   * В отличие от обхода с помощью GetEdge() и Advance() многоугольник не
+   * нужно копировать, чтобы обойти его в константном методе.
+   */
+  EdgeRange Edges() const;
+
   /**
    * @brief Получить итератор на соседнюю вершину по часовой стрелке.
    * @return Функция возвращает итератор на следующую вершину.
@@ -0,0 +1,609 @@
+/**
+ * @file include/polygon_grid.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Равномерная сетка для быстрого определения положения точки относительно
+ * многоугольника.
+ */
+
+#ifndef INCLUDE_POLYGON_GRID_HPP_
+#define INCLUDE_POLYGON_GRID_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <orientation.hpp>
+#include <angle_point_in_polygon.hpp>
+#include <point_in_polygon.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Многоугольник, покрытый равномерной сеткой.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * Ограничивающий прямоугольник многоугольника делится на ячейки, число
+ * которых пропорционально числу рёбер. Ячейка, которой не касается ни
+ * одно ребро (с учётом точности precision), целиком лежит внутри или
+ * снаружи, и запрос в ней выполняется за \f$ O(1) \f$. Для остальных
+ * ячеек хранятся список касающихся рёбер и опорная точка с известным
+ * числом оборотов. Запрос в такой ячейке проверяет только её рёбра: сначала
+ * на границу, затем считает пересечения отрезка от опорной точки до
+ * точки запроса с рёбрами ячейки.
+ *
+ * Число оборотов в опорных точках вычисляется при построении проходом по
+ * каждой строке сетки слева направо, поэтому построение занимает
+ * \f$ O(n + C + K) \f$, где \f$ C \f$ --- количество ячеек, а
+ * \f$ K \f$ --- суммарная длина списков рёбер.
+ *
+ * Результат Classify() совпадает с WindingNumberPointInPolygon() для той
+ * же точности. Объект не изменяется после создания, поэтому Classify()
+ * можно вызывать из нескольких потоков одновременно.
+ */
+template<typename T>
+class PolygonGrid {
+ private:
+  static_assert(std::is_floating_point_v<T>,
+                "PolygonGrid: T must be a floating point type");
+
+  /**
+   * @brief Ячейка, которой касаются рёбра.
+   */
+  struct MixedCell {
+    //! Опорная точка.
+    Point<T> reference;
+    //! Число оборотов в опорной точке.
+    int winding;
+    //! Найдена ли опорная точка, не лежащая на прямых рёбер ячейки.
+    bool hasReference;
+  };
+
+  //! Код ячейки, целиком лежащей снаружи.
+  static constexpr std::uint32_t outsideCell = 0;
+  //! Код ячейки, целиком лежащей внутри.
+  static constexpr std::uint32_t insideCell = 1;
+  //! Код первой ячейки, которой касаются рёбра.
+  static constexpr std::uint32_t firstMixedCell = 2;
+
+  //! Абсолютная точность вычисления ориентации.
+  T precision = T(1e-9);
+  //! Левый нижний угол ограничивающего прямоугольника.
+  Point<T> lower;
+  //! Правый верхний угол ограничивающего прямоугольника.
+  Point<T> upper;
+  //! Количество столбцов сетки.
+  std::size_t numColumns = 0;
+  //! Количество строк сетки.
+  std::size_t numRows = 0;
+  //! Ширина ячейки.
+  T cellWidth = T(1);
+  //! Высота ячейки.
+  T cellHeight = T(1);
+  //! Вершины многоугольника и, в конце, первая вершина.
+  std::vector<Point<T>> vertices;
+  //! Коды ячеек по строкам снизу вверх.
+  std::vector<std::uint32_t> cells;
+  //! Ячейки, которым касаются рёбра.
+  std::vector<MixedCell> mixed;
+  //! Начала списков рёбер ячеек в mixedEdges (на 1 больше mixed).
+  std::vector<std::uint32_t> mixedStarts;
+  //! Номера рёбер ячеек по возрастанию.
+  std::vector<std::uint32_t> mixedEdges;
+
+  /**
+   * @brief Найти столбец, содержащий координату.
+   *
+   * @param x Координата \f$ X \f$.
+   * @return Функция возвращает номер столбца от 0 до numColumns - 1.
+   */
+  std::size_t Column(T x) const {
+    const T column = std::floor((x - lower.X()) / cellWidth);
+
+    if (!(column > T(0)))
+      return 0;
+
+    return std::min(static_cast<std::size_t>(column), numColumns - 1);
+  }
+
+  /**
+   * @brief Найти строку, содержащую координату.
+   *
+   * @param y Координата \f$ Y \f$.
+   * @return Функция возвращает номер строки от 0 до numRows - 1.
+   */
+  std::size_t Row(T y) const {
+    const T row = std::floor((y - lower.Y()) / cellHeight);
+
+    if (!(row > T(0)))
+      return 0;
+
+    return std::min(static_cast<std::size_t>(row), numRows - 1);
+  }
+
+  /**
+   * @brief Обойти ячейки, которых касается окрестность ребра.
+   *
+   * @tparam Visit Тип функции обработки ячейки.
+   * @param a Начало ребра.
+   * @param b Конец ребра.
+   * @param slack Расширение окрестности.
+   * @param visit Функция, вызываемая для номера каждой ячейки.
+   *
+   * Окрестность --- точки, для которых Orientation() равна 0 и которые
+   * лежат в ограничивающем прямоугольнике ребра, расширенном на precision.
+   * В каждой строке она заключена между двумя прямыми, параллельными
+   * ребру, поэтому обходится отрезок столбцов.
+   */
+  template<typename Visit>
+  void ForEachCell(const Point<T>& a, const Point<T>& b, T slack,
+                   Visit visit) const {
+    const T minX = std::min(a.X(), b.X()) - slack;
+    const T maxX = std::max(a.X(), b.X()) + slack;
+    const T minY = std::min(a.Y(), b.Y()) - slack;
+    const T maxY = std::max(a.Y(), b.Y()) + slack;
+    const T dx = b.X() - a.X();
+    const T dy = b.Y() - a.Y();
+
+    const std::size_t lastRow = Row(maxY);
+
+    for (std::size_t row = Row(minY); row <= lastRow; row++) {
+      T left = minX;
+      T right = maxX;
+
+      if (dy != T(0)) {
+        const T low = std::max(minY, lower.Y() + cellHeight * row - slack);
+        const T high = std::min(maxY,
+                                lower.Y() + cellHeight * (row + 1) + slack);
+        const T x0 = a.X() + dx * (low - a.Y()) / dy;
+        const T x1 = a.X() + dx * (high - a.Y()) / dy;
+        const T width = precision / std::abs(dy) + slack;
+
+        left = std::max(left, std::min(x0, x1) - width);
+        right = std::min(right, std::max(x0, x1) + width);
+      }
+
+      if (left > right)
+        continue;
+
+      const std::size_t lastColumn = Column(right);
+
+      for (std::size_t column = Column(left); column <= lastColumn; column++)
+        visit(row * numColumns + column);
+    }
+  }
+
+  /**
+   * @brief Изменение числа оборотов вдоль отрезка.
+   *
+   * @param p Начало отрезка.
+   * @param q Конец отрезка.
+   * @param a Начало ребра.
+   * @param b Конец ребра.
+   * @return Функция возвращает 1, если отрезок пересекает ребро справа
+   * налево, -1, если слева направо, и 0, если не пересекает.
+   *
+   * Концы отрезка не должны лежать на ребре. Вершина, лежащая на отрезке,
+   * считается лежащей слева от него, поэтому отрезок, проходящий через
+   * вершину, учитывается один раз, как луч в WindingStep().
+   */
+  static int Crossing(const Point<T>& p, const Point<T>& q,
+                      const Point<T>& a, const Point<T>& b) {
+    const Point<T> d = q - p;
+    const bool leftA = d.X() * (a.Y() - p.Y()) - d.Y() * (a.X() - p.X()) >=
+                       T(0);
+    const bool leftB = d.X() * (b.Y() - p.Y()) - d.Y() * (b.X() - p.X()) >=
+                       T(0);
+
+    if (leftA == leftB)
+      return 0;
+
+    const int fromP = Orientation(a, b, p, T(0));
+    const int fromQ = Orientation(a, b, q, T(0));
+
+    if (fromP == 0 || fromQ == 0 || fromP == fromQ)
+      return 0;
+
+    return fromQ;
+  }
+
+  /**
+   * @brief Изменение числа оборотов вдоль отрезка через две соседние
+   * ячейки.
+   *
+   * @param p Начало отрезка.
+   * @param q Конец отрезка.
+   * @param first Код первой ячейки.
+   * @param second Код второй ячейки.
+   * @return Функция возвращает сумму Crossing() по рёбрам обеих ячеек,
+   * каждое ребро учитывается один раз.
+   */
+  int Crossings(const Point<T>& p, const Point<T>& q, std::uint32_t first,
+                std::uint32_t second) const {
+    const std::uint32_t* i = nullptr;
+    const std::uint32_t* iEnd = nullptr;
+    const std::uint32_t* j = nullptr;
+    const std::uint32_t* jEnd = nullptr;
+
+    if (first >= firstMixedCell) {
+      i = mixedEdges.data() + mixedStarts[first - firstMixedCell];
+      iEnd = mixedEdges.data() + mixedStarts[first - firstMixedCell + 1];
+    }
+
+    if (second >= firstMixedCell) {
+      j = mixedEdges.data() + mixedStarts[second - firstMixedCell];
+      jEnd = mixedEdges.data() + mixedStarts[second - firstMixedCell + 1];
+    }
+
+    int winding = 0;
+
+    // Списки упорядочены, поэтому общие рёбра пропускаются слиянием.
+    while (i != iEnd || j != jEnd) {
+      std::uint32_t edge;
+
+      if (j == jEnd || (i != iEnd && *i < *j)) {
+        edge = *i++;
+      } else if (i == iEnd || *j < *i) {
+        edge = *j++;
+      } else {
+        edge = *i++;
+        j++;
+      }
+
+      winding += Crossing(p, q, vertices[edge], vertices[edge + 1]);
+    }
+
+    return winding;
+  }
+
+  /**
+   * @brief Вычислить число оборотов перебором всех рёбер.
+   *
+   * @param point Точка.
+   * @param winding Указатель на число оборотов.
+   * @return Функция возвращает true, если точка лежит на границе.
+   */
+  bool FullWinding(const Point<T>& point, int* winding) const {
+    *winding = 0;
+
+    for (std::size_t i = 0; i + 1 < vertices.size(); i++) {
+      if (WindingStep(point, vertices[i], vertices[i + 1], precision,
+                      winding))
+        return true;
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Найти опорную точку ячейки.
+   *
+   * @param cell Номер ячейки.
+   * @param code Код ячейки.
+   * @param reference Указатель, по которому записывается опорная точка.
+   * @return Функция возвращает true, если найдена точка, не лежащая на
+   * прямых рёбер ячейки.
+   *
+   * Перебираются центр ячейки и узлы всё более мелких сеток внутри неё.
+   */
+  bool FindReference(std::size_t cell, std::uint32_t code,
+                     Point<T>* reference) const {
+    const T left = lower.X() + cellWidth * (cell % numColumns);
+    const T bottom = lower.Y() + cellHeight * (cell / numColumns);
+    const std::uint32_t* first = mixedEdges.data() +
+                                 mixedStarts[code - firstMixedCell];
+    const std::uint32_t* last = mixedEdges.data() +
+                                mixedStarts[code - firstMixedCell + 1];
+
+    for (int steps = 2; steps <= 16; steps *= 2) {
+      for (int i = 1; i < steps; i += 2) {
+        for (int j = 1; j < steps; j += 2) {
+          const Point<T> candidate(left + cellWidth * i / steps,
+                                   bottom + cellHeight * j / steps);
+
+          bool valid = true;
+
+          for (const std::uint32_t* edge = first; valid && edge != last;
+               ++edge)
+            valid = Orientation(vertices[*edge], vertices[*edge + 1],
+                                candidate, precision) != 0;
+
+          if (valid) {
+            *reference = candidate;
+            return true;
+          }
+        }
+      }
+    }
+
+    return false;
+  }
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Создать пустую сетку.
+   *
+   * Все точки находятся вне пустого многоугольника.
+   */
+  PolygonGrid() = default;
+
+  /**
+   * @brief Построить сетку для многоугольника.
+   *
+   * @tparam Container Тип контейнера для хранения вершин.
+   * @param polygon Многоугольник.
+   * @param precision Абсолютная точность вычисления ориентации.
+   * @param cellsPerEdge Количество ячеек на одно ребро.
+   *
+   * @throw std::invalid_argument если cellsPerEdge не положительно.
+   * @throw std::length_error если в списках ячеек больше
+   * \f$ 2^{32} - 1 \f$ рёбер.
+   */
+  template<typename Container>
+  explicit PolygonGrid(const Polygon<T, Container>& polygon,
+                       T precision = T(1e-9), double cellsPerEdge = 1.0) :
+    precision(precision),
+    lower(std::numeric_limits<T>::max(), std::numeric_limits<T>::max()),
+    upper(std::numeric_limits<T>::lowest(),
+          std::numeric_limits<T>::lowest()) {
+    if (!(cellsPerEdge > 0.0))
+      throw std::invalid_argument("PolygonGrid: cellsPerEdge must be "
+                                  "positive");
+
+    const auto edges = polygon.Edges();
+
+    vertices.reserve(polygon.Size() + 1);
+
+    for (auto edge = edges.begin(); edge != edges.end(); ++edge) {
+      const Point<T>& a = edge.Origin();
+
+      vertices.push_back(a);
+      lower = Point<T>(std::min(lower.X(), a.X()), std::min(lower.Y(), a.Y()));
+      upper = Point<T>(std::max(upper.X(), a.X()), std::max(upper.Y(), a.Y()));
+    }
+
+    if (vertices.empty())
+      return;
+
+    vertices.push_back(vertices.front());
+
+    const std::size_t numEdges = vertices.size() - 1;
+
+    if (numEdges > std::numeric_limits<std::uint32_t>::max())
+      throw std::length_error("PolygonGrid: too many edges");
+
+    // Не больше 2^24 ячеек: коды ячеек занимают 4 байта.
+    const double numCells = std::clamp(cellsPerEdge * numEdges, 1.0,
+                                       double(1 << 24));
+    const T width = upper.X() - lower.X();
+    const T height = upper.Y() - lower.Y();
+
+    if (width > T(0) && height > T(0)) {
+      const double aspect = static_cast<double>(width / height);
+
+      numColumns = static_cast<std::size_t>(std::clamp(
+          std::round(std::sqrt(numCells * aspect)), 1.0, numCells));
+      numRows = std::max<std::size_t>(
+          static_cast<std::size_t>(std::round(numCells / numColumns)), 1);
+    } else {
+      numColumns = width > T(0) ? static_cast<std::size_t>(numCells) : 1;
+      numRows = height > T(0) ? static_cast<std::size_t>(numCells) : 1;
+    }
+
+    cellWidth = width > T(0) ? width / numColumns : T(1);
+    cellHeight = height > T(0) ? height / numRows : T(1);
+
+    // Расширение окрестности рёбер покрывает ошибки округления при
+    // вычислении номеров ячеек.
+    const T scale = std::max({std::abs(lower.X()), std::abs(lower.Y()),
+                              std::abs(upper.X()), std::abs(upper.Y()),
+                              cellWidth, cellHeight});
+    const T slack = precision + 64 * std::numeric_limits<T>::epsilon() *
+                                scale;
+
+    cells.assign(numColumns * numRows, outsideCell);
+
+    std::vector<std::uint32_t> counts(cells.size(), 0);
+
+    for (std::size_t i = 0; i < numEdges; i++) {
+      ForEachCell(vertices[i], vertices[i + 1], slack,
+                  [&counts](std::size_t cell) { counts[cell]++; });
+    }
+
+    std::uint64_t total = 0;
+
+    mixedStarts.push_back(0);
+
+    for (std::size_t cell = 0; cell < cells.size(); cell++) {
+      if (counts[cell] == 0)
+        continue;
+
+      total += counts[cell];
+
+      if (total > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("PolygonGrid: too many cell entries");
+
+      cells[cell] = static_cast<std::uint32_t>(firstMixedCell + mixed.size());
+      mixed.push_back(MixedCell{Point<T>(), 0, false});
+      mixedStarts.push_back(static_cast<std::uint32_t>(total));
+    }
+
+    mixedEdges.resize(total);
+
+    std::vector<std::uint32_t> fill(mixedStarts.begin(),
+                                    mixedStarts.end() - 1);
+
+    for (std::size_t i = 0; i < numEdges; i++) {
+      ForEachCell(vertices[i], vertices[i + 1], slack,
+          [this, &fill, i](std::size_t cell) {
+            mixedEdges[fill[cells[cell] - firstMixedCell]++] =
+                static_cast<std::uint32_t>(i);
+          });
+    }
+
+    // Проход по строке слева направо: отрезок между точками соседних ячеек
+    // лежит в их объединении, поэтому пересекает только их рёбра.
+    for (std::size_t row = 0; row < numRows; row++) {
+      Point<T> current(lower.X() - cellWidth / 2,
+                       lower.Y() + cellHeight * (T(row) + T(0.5)));
+      std::uint32_t previous = outsideCell;
+      int winding = 0;
+      bool known = true;
+
+      for (std::size_t column = 0; column < numColumns; column++) {
+        const std::size_t cell = row * numColumns + column;
+        const std::uint32_t code = cells[cell];
+        Point<T> target(lower.X() + cellWidth * (T(column) + T(0.5)),
+                        current.Y());
+
+        if (code >= firstMixedCell) {
+          MixedCell& info = mixed[code - firstMixedCell];
+
+          info.hasReference = FindReference(cell, code, &target);
+
+          if (!info.hasReference) {
+            known = false;
+            previous = code;
+            continue;
+          }
+
+          info.reference = target;
+        }
+
+        if (known)
+          winding += Crossings(current, target, previous, code);
+        else
+          FullWinding(target, &winding);
+
+        known = true;
+
+        if (code >= firstMixedCell)
+          mixed[code - firstMixedCell].winding = winding;
+        else
+          cells[cell] = winding != 0 ? insideCell : outsideCell;
+
+        current = target;
+        previous = code;
+      }
+    }
+  }
+
+  /**
+   * @brief Определить положение точки.
+   *
+   * @param point Точка.
+   * @return Функция возвращает положение точки относительно многоугольника.
+   */
+  PointPosition Classify(const Point<T>& point) const {
+    const T px = point.X();
+    const T py = point.Y();
+
+    if (cells.empty() || px < lower.X() - precision ||
+        px > upper.X() + precision || py < lower.Y() - precision ||
+        py > upper.Y() + precision)
+      return PointPosition::OUTSIDE;
+
+    const std::uint32_t code = cells[Row(py) * numColumns + Column(px)];
+
+    if (code == outsideCell)
+      return PointPosition::OUTSIDE;
+
+    if (code == insideCell)
+      return PointPosition::INSIDE;
+
+    const MixedCell& info = mixed[code - firstMixedCell];
+    const std::uint32_t* first = mixedEdges.data() +
+                                 mixedStarts[code - firstMixedCell];
+    const std::uint32_t* last = mixedEdges.data() +
+                                mixedStarts[code - firstMixedCell + 1];
+
+    for (const std::uint32_t* edge = first; edge != last; ++edge) {
+      const Point<T>& a = vertices[*edge];
+      const Point<T>& b = vertices[*edge + 1];
+
+      if (Orientation(a, b, point, precision) == 0 &&
+          InSegmentBox(point, a, b, precision))
+        return PointPosition::BOUNDARY;
+    }
+
+    int winding = info.winding;
+
+    if (!info.hasReference) {
+      FullWinding(point, &winding);
+    } else {
+      for (const std::uint32_t* edge = first; edge != last; ++edge)
+        winding += Crossing(info.reference, point, vertices[*edge],
+                            vertices[*edge + 1]);
+    }
+
+    return winding != 0 ? PointPosition::INSIDE : PointPosition::OUTSIDE;
+  }
+
+  /**
+   * @brief Определить положение набора точек.
+   *
+   * @param points Точки.
+   * @param threads Количество потоков (0 --- по количеству аппаратных
+   * потоков).
+   * @return Функция возвращает положение каждой точки в порядке входа.
+   */
+  std::vector<PointPosition> Classify(const std::vector<Point<T>>& points,
+                                      std::size_t threads = 0) const {
+    const std::size_t cost = mixed.empty() ? 1 :
+                             mixedEdges.size() / mixed.size() + 1;
+
+    return ClassifyInParallel(*this, points, threads, cost);
+  }
+
+  /**
+   * @brief Получить количество рёбер.
+   * @return Функция возвращает количество рёбер многоугольника.
+   */
+  std::size_t Size() const {
+    return vertices.empty() ? 0 : vertices.size() - 1;
+  }
+
+  /**
+   * @brief Получить количество столбцов сетки.
+   * @return Функция возвращает количество столбцов.
+   */
+  std::size_t NumColumns() const { return numColumns; }
+
+  /**
+   * @brief Получить количество строк сетки.
+   * @return Функция возвращает количество строк.
+   */
+  std::size_t NumRows() const { return numRows; }
+
+  /**
+   * @brief Получить количество ячеек, которых касаются рёбра.
+   * @return Функция возвращает количество неоднородных ячеек.
+   */
+  std::size_t NumMixedCells() const { return mixed.size(); }
+
+  /**
+   * @brief Получить объём памяти, занимаемый сеткой.
+   * @return Функция возвращает размер объекта и его массивов в байтах.
+   */
+  std::size_t MemoryUsage() const {
+    return sizeof(*this) + vertices.capacity() * sizeof(Point<T>) +
+           cells.capacity() * sizeof(std::uint32_t) +
+           mixed.capacity() * sizeof(MixedCell) +
+           mixedStarts.capacity() * sizeof(std::uint32_t) +
+           mixedEdges.capacity() * sizeof(std::uint32_t);
+  }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POLYGON_GRID_HPP_
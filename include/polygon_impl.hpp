@@ -27,6 +27,12 @@ Polygon<T, Container>::Polygon(const Container& vertices) :
   current(this->vertices.begin())
 { }
 
+template<typename T, typename Container>
+Polygon<T, Container>::Polygon(Container&& vertices) :
+  vertices(std::move(vertices)),
+  current(this->vertices.begin())
+{ }
+
 template<typename T, typename Container>
 Polygon<T, Container>::Polygon(const Container& vertices,
         typename Container::iterator position) :
@@ -81,11 +87,27 @@ Edge<T> Polygon<T, Container>::GetEdge() const {
   return Edge<T>(*current, *ClockWise());
 }
 
+template<typename T, typename Container>
+typename Polygon<T, Container>::EdgeRange Polygon<T, Container>::Edges() const {
+  typename Container::const_iterator first = current;
+
+  if (first == vertices.end())
+    first = vertices.begin();
+
+  return EdgeRange(&vertices, first, vertices.size());
+}
+
 template<typename T, typename Container>
 typename Container::iterator Polygon<T, Container>::ClockWise() {
   if (vertices.empty())
     return vertices.end();
 
+  if constexpr (randomAccess) {
+    std::size_t next = (current - vertices.begin()) + 1;
+
+    return vertices.begin() + (next < vertices.size() ? next : 0);
+  }
+
   if (current == vertices.end())
     return vertices.begin();
 
@@ -100,6 +122,12 @@ typename Container::iterator Polygon<T, Container>::CounterClockWise() {
   if (vertices.empty())
     return vertices.end();
 
+  if constexpr (randomAccess) {
+    std::size_t index = current - vertices.begin();
+
+    return vertices.begin() + ((index == 0 ? vertices.size() : index) - 1);
+  }
+
   if (current != vertices.begin())
     return std::prev(current);
 
@@ -111,6 +139,12 @@ typename Container::const_iterator Polygon<T, Container>::ClockWise() const {
   if (vertices.empty())
     return vertices.end();
 
+  if constexpr (randomAccess) {
+    std::size_t next = (Current() - vertices.begin()) + 1;
+
+    return vertices.begin() + (next < vertices.size() ? next : 0);
+  }
+
   if (current == vertices.end())
     return vertices.begin();
 
@@ -126,6 +160,12 @@ Polygon<T, Container>::CounterClockWise() const {
   if (vertices.empty())
     return vertices.end();
 
+  if constexpr (randomAccess) {
+    std::size_t index = Current() - vertices.begin();
+
+    return vertices.begin() + ((index == 0 ? vertices.size() : index) - 1);
+  }
+
   if (current != vertices.begin())
     return std::prev(current);
 
@@ -195,6 +235,34 @@ Polygon<T, Container> Polygon<T, Container>::Split(
     return Polygon(other, std::prev(other.end()));
   }
 
+  if constexpr (randomAccess) {
+    // Вершины копируются и удаляются диапазонами, так как удаление по одной
+    // вершине сдвигает хвост массива и делает итератор position
+    // недействительным.
+    std::size_t first = current - vertices.begin();
+    std::size_t last = position - vertices.begin();
+
+    if (first < last) {
+      other.insert(other.end(), vertices.begin() + first + 1,
+                   vertices.begin() + last + 1);
+      vertices.erase(vertices.begin() + first + 1, vertices.begin() + last);
+    } else {
+      other.insert(other.end(), vertices.begin() + first + 1, vertices.end());
+      other.insert(other.end(), vertices.begin(), vertices.begin() + last + 1);
+      vertices.erase(vertices.begin() + first + 1, vertices.end());
+      vertices.erase(vertices.begin(), vertices.begin() + last);
+      first -= last;
+    }
+
+    current = vertices.begin() + first;
+
+    Polygon result(std::move(other));
+
+    result.current = std::prev(result.vertices.end());
+
+    return result;
+  }
+
   typename Container::iterator it = std::next(current);
 
   while (it != position) {
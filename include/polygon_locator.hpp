@@ -0,0 +1,627 @@
+/**
+ * @file include/polygon_locator.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Определение положения точки относительно простого многоугольника за
+ * логарифмическое время с помощью разбиения на полосы.
+ */
+
+#ifndef INCLUDE_POLYGON_LOCATOR_HPP_
+#define INCLUDE_POLYGON_LOCATOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <orientation.hpp>
+#include <angle_point_in_polygon.hpp>
+#include <point_in_polygon.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Индекс для определения положения точки относительно простого
+ * многоугольника.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * Вертикальные прямые через все вершины разбивают плоскость на полосы.
+ * Внутри полосы рёбра простого многоугольника не пересекаются, поэтому
+ * их можно упорядочить снизу вверх. Соседние полосы отличаются только
+ * рёбрами, которые начинаются или заканчиваются на общей границе, поэтому
+ * упорядоченные рёбра всех полос хранятся в одном персистентном дереве
+ * поиска (декартовом дереве с копированием пути, Sarnak, Tarjan): версия
+ * полосы получается из версии предыдущей полосы удалением и вставкой
+ * рёбер и разделяет с ней все нетронутые узлы.
+ *
+ * Запрос находит полосу двоичным поиском по \f$ X \f$, а затем спуском
+ * по версии дерева этой полосы с помощью Orientation() находит количество
+ * рёбер полосы под точкой: точка внутри, если оно нечётно. Запрос
+ * выполняется за ожидаемое время \f$ O(\log n) \f$, построение --- за
+ * \f$ O(n \log n) \f$, индекс занимает \f$ O(n \log n) \f$ памяти
+ * независимо от того, сколько рёбер пересекает вертикальная прямая.
+ *
+ * Граница определяется так же, как в WindingNumberPointInPolygon(): точка
+ * коллинеарна ребру с точностью precision и лежит в его ограничивающем
+ * прямоугольнике. Для самопересекающихся многоугольников результат не
+ * определён.
+ *
+ * Индекс можно сохранить в поток функцией Write() и восстановить функцией
+ * Read() без повторного построения.
+ */
+template<typename T>
+class PolygonLocator {
+ private:
+  static_assert(std::is_floating_point_v<T>,
+                "PolygonLocator: T must be a floating point type");
+
+  /**
+   * @brief Ребро, направленное слева направо.
+   */
+  struct Segment {
+    //! Левый конец.
+    Point<T> left;
+    //! Правый конец.
+    Point<T> right;
+  };
+
+  /**
+   * @brief Узел персистентного дерева рёбер.
+   *
+   * Узел 0 --- пустое дерево. Узлы создаются после своих потомков,
+   * поэтому номера потомков меньше номера узла.
+   */
+  struct Node {
+    //! Номер ребра в segments.
+    std::uint32_t segment;
+    //! Левое поддерево (рёбра ниже).
+    std::uint32_t left;
+    //! Правое поддерево (рёбра выше).
+    std::uint32_t right;
+    //! Количество рёбер в поддереве.
+    std::uint32_t size;
+  };
+
+  /**
+   * @brief Вертикальное или вырожденное ребро.
+   */
+  struct Vertical {
+    //! Координата \f$ X \f$.
+    T x;
+    //! Нижний конец.
+    T low;
+    //! Верхний конец.
+    T high;
+  };
+
+  //! Сигнатура формата сохранённого индекса.
+  static constexpr std::uint32_t magic = 0x434f4c50;  // "PLOC"
+  //! Версия формата сохранённого индекса.
+  static constexpr std::uint32_t version = 2;
+  //! Наибольшее количество элементов, читаемое из потока за один раз.
+  static constexpr std::size_t readChunk = 1 << 16;
+
+  //! Абсолютная точность вычисления ориентации.
+  T precision = T(1e-9);
+  //! Левый нижний угол ограничивающего прямоугольника.
+  Point<T> lower;
+  //! Правый верхний угол ограничивающего прямоугольника.
+  Point<T> upper;
+  //! Различные координаты \f$ X \f$ вершин по возрастанию.
+  std::vector<T> xs;
+  //! Невертикальные рёбра.
+  std::vector<Segment> segments;
+  //! Узлы всех версий дерева рёбер.
+  std::vector<Node> nodes = std::vector<Node>(1, Node{0, 0, 0, 0});
+  //! Корень версии дерева для каждой полосы.
+  std::vector<std::uint32_t> roots;
+  //! Вертикальные рёбра, упорядоченные по \f$ X \f$.
+  std::vector<Vertical> verticals;
+
+  /**
+   * @brief Приоритет ребра в декартовом дереве.
+   *
+   * @param segment Номер ребра.
+   * @return Функция возвращает псевдослучайное число, зависящее только от
+   * номера ребра.
+   */
+  static std::uint64_t Priority(std::uint32_t segment) {
+    std::uint64_t z = segment + 0x9e3779b97f4a7c15ull;
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+
+    return z ^ (z >> 31);
+  }
+
+  /**
+   * @brief Сравнить рёбра по высоте над вертикальной прямой.
+   *
+   * @param a Номер первого ребра.
+   * @param b Номер второго ребра.
+   * @param x Координата \f$ X \f$ прямой внутри общей полосы рёбер.
+   * @return Функция возвращает true, если ребро a ниже ребра b.
+   */
+  bool Below(std::uint32_t a, std::uint32_t b, T x) const {
+    auto height = [this, x](std::uint32_t index) {
+      const Segment& segment = segments[index];
+      const T t = (x - segment.left.X()) /
+                  (segment.right.X() - segment.left.X());
+
+      return segment.left.Y() + t * (segment.right.Y() - segment.left.Y());
+    };
+
+    const T ha = height(a);
+    const T hb = height(b);
+
+    return ha < hb || (ha == hb && a < b);
+  }
+
+  /**
+   * @brief Создать узел дерева.
+   *
+   * @param segment Номер ребра.
+   * @param left Левое поддерево.
+   * @param right Правое поддерево.
+   * @return Функция возвращает номер нового узла.
+   *
+   * @throw std::length_error если узлов больше \f$ 2^{32} - 1 \f$.
+   */
+  std::uint32_t MakeNode(std::uint32_t segment, std::uint32_t left,
+                         std::uint32_t right) {
+    if (nodes.size() > std::numeric_limits<std::uint32_t>::max())
+      throw std::length_error("PolygonLocator: too many tree nodes");
+
+    nodes.push_back(Node{segment, left, right,
+                         nodes[left].size + nodes[right].size + 1});
+
+    return static_cast<std::uint32_t>(nodes.size() - 1);
+  }
+
+  /**
+   * @brief Разделить дерево на рёбра ниже и выше данного.
+   *
+   * @param tree Корень дерева.
+   * @param segment Номер ребра, которого нет в дереве.
+   * @param x Координата \f$ X \f$ для сравнения рёбер.
+   * @return Функция возвращает корни новых деревьев.
+   */
+  std::pair<std::uint32_t, std::uint32_t> Split(std::uint32_t tree,
+                                                std::uint32_t segment, T x) {
+    if (tree == 0)
+      return {0, 0};
+
+    const Node node = nodes[tree];
+
+    if (Below(node.segment, segment, x)) {
+      auto [low, high] = Split(node.right, segment, x);
+
+      return {MakeNode(node.segment, node.left, low), high};
+    }
+
+    auto [low, high] = Split(node.left, segment, x);
+
+    return {low, MakeNode(node.segment, high, node.right)};
+  }
+
+  /**
+   * @brief Объединить деревья.
+   *
+   * @param low Корень дерева, все рёбра которого ниже рёбер high.
+   * @param high Корень второго дерева.
+   * @return Функция возвращает корень нового дерева.
+   */
+  std::uint32_t Merge(std::uint32_t low, std::uint32_t high) {
+    if (low == 0 || high == 0)
+      return low + high;
+
+    const Node a = nodes[low];
+    const Node b = nodes[high];
+
+    if (Priority(a.segment) > Priority(b.segment))
+      return MakeNode(a.segment, a.left, Merge(a.right, high));
+
+    return MakeNode(b.segment, Merge(low, b.left), b.right);
+  }
+
+  /**
+   * @brief Вставить ребро в дерево.
+   *
+   * @param tree Корень дерева.
+   * @param segment Номер ребра.
+   * @param x Координата \f$ X \f$ для сравнения рёбер.
+   * @return Функция возвращает корень новой версии дерева.
+   */
+  std::uint32_t Insert(std::uint32_t tree, std::uint32_t segment, T x) {
+    const Node node = nodes[tree];
+
+    if (tree == 0 || Priority(segment) > Priority(node.segment)) {
+      auto [low, high] = Split(tree, segment, x);
+
+      return MakeNode(segment, low, high);
+    }
+
+    if (Below(segment, node.segment, x))
+      return MakeNode(node.segment, Insert(node.left, segment, x),
+                      node.right);
+
+    return MakeNode(node.segment, node.left,
+                    Insert(node.right, segment, x));
+  }
+
+  /**
+   * @brief Удалить ребро из дерева.
+   *
+   * @param tree Корень дерева.
+   * @param segment Номер ребра.
+   * @param x Координата \f$ X \f$ для сравнения рёбер.
+   * @return Функция возвращает корень новой версии дерева.
+   */
+  std::uint32_t Erase(std::uint32_t tree, std::uint32_t segment, T x) {
+    if (tree == 0)
+      return 0;
+
+    const Node node = nodes[tree];
+
+    if (node.segment == segment)
+      return Merge(node.left, node.right);
+
+    if (Below(segment, node.segment, x))
+      return MakeNode(node.segment, Erase(node.left, segment, x),
+                      node.right);
+
+    return MakeNode(node.segment, node.left,
+                    Erase(node.right, segment, x));
+  }
+
+  /**
+   * @brief Найти количество рёбер полосы под точкой.
+   *
+   * @param slab Номер полосы.
+   * @param point Точка.
+   * @param below Указатель, по которому записывается количество рёбер под
+   * точкой (может быть nullptr).
+   * @return Функция возвращает true, если точка лежит на ребре полосы.
+   */
+  bool SearchSlab(std::size_t slab, const Point<T>& point,
+                  std::size_t* below) const {
+    std::uint32_t tree = roots[slab];
+    std::size_t count = 0;
+    const Segment* above = nullptr;
+
+    while (tree != 0) {
+      const Node& node = nodes[tree];
+      const Segment& segment = segments[node.segment];
+
+      if (Orientation(segment.left, segment.right, point, precision) > 0) {
+        count += nodes[node.left].size + 1;
+        tree = node.right;
+      } else {
+        above = &segment;
+        tree = node.left;
+      }
+    }
+
+    if (below)
+      *below = count;
+
+    return above &&
+           Orientation(above->left, above->right, point, precision) == 0 &&
+           InSegmentBox(point, above->left, above->right, precision);
+  }
+
+  /**
+   * @brief Записать массив в поток.
+   *
+   * @param stream Поток.
+   * @param values Массив.
+   */
+  template<typename U>
+  static void WriteArray(std::ostream& stream, const std::vector<U>& values) {
+    static_assert(std::is_trivially_copyable_v<U>,
+                  "PolygonLocator: U must be trivially copyable");
+
+    const std::uint64_t size = values.size();
+
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream.write(reinterpret_cast<const char*>(values.data()),
+                 values.size() * sizeof(U));
+  }
+
+  /**
+   * @brief Прочитать массив из потока.
+   *
+   * @param stream Поток.
+   * @param values Указатель на массив.
+   *
+   * Массив читается частями не больше readChunk элементов, поэтому
+   * испорченный размер не приводит к выделению памяти больше, чем есть
+   * данных в потоке.
+   *
+   * @throw std::invalid_argument если поток оборвался.
+   */
+  template<typename U>
+  static void ReadArray(std::istream& stream, std::vector<U>* values) {
+    std::uint64_t size = 0;
+
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+
+    if (!stream || size > std::numeric_limits<std::uint32_t>::max())
+      throw std::invalid_argument("PolygonLocator: truncated data");
+
+    values->clear();
+
+    while (values->size() < size) {
+      const std::size_t offset = values->size();
+      const std::size_t count = std::min<std::uint64_t>(size - offset,
+                                                        readChunk);
+
+      values->resize(offset + count);
+      stream.read(reinterpret_cast<char*>(values->data() + offset),
+                  count * sizeof(U));
+
+      if (!stream)
+        throw std::invalid_argument("PolygonLocator: truncated data");
+    }
+  }
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Создать пустой индекс.
+   *
+   * Все точки находятся вне пустого многоугольника.
+   */
+  PolygonLocator() = default;
+
+  /**
+   * @brief Построить индекс многоугольника.
+   *
+   * @tparam Container Тип контейнера для хранения вершин.
+   * @param polygon Простой многоугольник.
+   * @param precision Абсолютная точность вычисления ориентации.
+   *
+   * @throw std::length_error если в дереве больше \f$ 2^{32} - 1 \f$
+   * узлов.
+   */
+  template<typename Container>
+  explicit PolygonLocator(const Polygon<T, Container>& polygon,
+                          T precision = T(1e-9)) :
+    precision(precision),
+    lower(std::numeric_limits<T>::max(), std::numeric_limits<T>::max()),
+    upper(std::numeric_limits<T>::lowest(),
+          std::numeric_limits<T>::lowest()) {
+    const auto edges = polygon.Edges();
+
+    for (auto edge = edges.begin(); edge != edges.end(); ++edge) {
+      Point<T> a = edge.Origin();
+      Point<T> b = edge.Destination();
+
+      xs.push_back(a.X());
+      lower = Point<T>(std::min(lower.X(), a.X()), std::min(lower.Y(), a.Y()));
+      upper = Point<T>(std::max(upper.X(), a.X()), std::max(upper.Y(), a.Y()));
+
+      if (a.X() == b.X()) {
+        verticals.push_back(Vertical{a.X(), std::min(a.Y(), b.Y()),
+                                     std::max(a.Y(), b.Y())});
+        continue;
+      }
+
+      if (b.X() < a.X())
+        std::swap(a, b);
+
+      segments.push_back(Segment{a, b});
+    }
+
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+
+    std::sort(verticals.begin(), verticals.end(),
+              [](const Vertical& a, const Vertical& b) {
+                return a.x < b.x;
+              });
+
+    const std::size_t numSlabs = xs.size() > 1 ? xs.size() - 1 : 0;
+    // Рёбра, начинающиеся и заканчивающиеся на каждой границе полос.
+    std::vector<std::vector<std::uint32_t>> starts(numSlabs + 1);
+    std::vector<std::vector<std::uint32_t>> ends(numSlabs + 1);
+
+    for (std::size_t i = 0; i < segments.size(); i++) {
+      std::size_t first = std::lower_bound(xs.begin(), xs.end(),
+                                           segments[i].left.X()) - xs.begin();
+      std::size_t last = std::lower_bound(xs.begin() + first, xs.end(),
+                                          segments[i].right.X()) - xs.begin();
+
+      starts[first].push_back(static_cast<std::uint32_t>(i));
+      ends[last].push_back(static_cast<std::uint32_t>(i));
+    }
+
+    roots.assign(numSlabs, 0);
+
+    // Рёбра полосы не пересекаются внутри неё, поэтому их порядок
+    // определяется высотой над серединой полосы. Рёбра, заканчивающиеся
+    // на границе, ищутся по порядку предыдущей полосы.
+    std::uint32_t tree = 0;
+
+    for (std::size_t slab = 0; slab < numSlabs; slab++) {
+      if (slab > 0) {
+        const T previous = (xs[slab - 1] + xs[slab]) / T(2);
+
+        for (std::uint32_t segment : ends[slab])
+          tree = Erase(tree, segment, previous);
+      }
+
+      const T middle = (xs[slab] + xs[slab + 1]) / T(2);
+
+      for (std::uint32_t segment : starts[slab])
+        tree = Insert(tree, segment, middle);
+
+      roots[slab] = tree;
+    }
+  }
+
+  /**
+   * @brief Определить положение точки.
+   *
+   * @param point Точка.
+   * @return Функция возвращает положение точки относительно многоугольника.
+   *
+   * Если точка ближе precision к границе полосы, то проверяются рёбра
+   * соседней полосы, а также вертикальные рёбра.
+   */
+  PointPosition Locate(const Point<T>& point) const {
+    const T px = point.X();
+    const T py = point.Y();
+
+    if (xs.empty() || px < lower.X() - precision ||
+        px > upper.X() + precision || py < lower.Y() - precision ||
+        py > upper.Y() + precision)
+      return PointPosition::OUTSIDE;
+
+    auto vertical = std::partition_point(verticals.begin(), verticals.end(),
+        [px, this](const Vertical& v) { return v.x < px - precision; });
+
+    for (; vertical != verticals.end() && vertical->x <= px + precision;
+         ++vertical) {
+      if (py >= vertical->low - precision && py <= vertical->high + precision)
+        return PointPosition::BOUNDARY;
+    }
+
+    if (xs.size() < 2)
+      return PointPosition::OUTSIDE;
+
+    const std::size_t numSlabs = xs.size() - 1;
+    std::size_t slab = std::upper_bound(xs.begin(), xs.end(), px) -
+                       xs.begin();
+
+    slab = std::min(slab > 0 ? slab - 1 : 0, numSlabs - 1);
+
+    std::size_t below = 0;
+
+    if (SearchSlab(slab, point, &below))
+      return PointPosition::BOUNDARY;
+
+    if (slab > 0 && px - xs[slab] <= precision &&
+        SearchSlab(slab - 1, point, nullptr))
+      return PointPosition::BOUNDARY;
+
+    if (slab + 1 < numSlabs && xs[slab + 1] - px <= precision &&
+        SearchSlab(slab + 1, point, nullptr))
+      return PointPosition::BOUNDARY;
+
+    if (px < xs.front() || px > xs.back())
+      return PointPosition::OUTSIDE;
+
+    return below % 2 == 1 ? PointPosition::INSIDE : PointPosition::OUTSIDE;
+  }
+
+  /**
+   * @brief Получить количество полос.
+   * @return Функция возвращает количество полос.
+   */
+  std::size_t NumSlabs() const { return roots.size(); }
+
+  /**
+   * @brief Получить количество узлов всех версий дерева рёбер.
+   * @return Функция возвращает размер индекса.
+   */
+  std::size_t NumNodes() const { return nodes.size() - 1; }
+
+  /**
+   * @brief Сохранить индекс в поток.
+   *
+   * @param stream Поток, открытый в режиме binary.
+   *
+   * Числа записываются в порядке байтов машины, поэтому индекс можно
+   * прочитать только на машине с тем же порядком байтов и тем же типом T.
+   */
+  void Write(std::ostream& stream) const {
+    const std::uint32_t header[3] = {magic, version,
+                                     static_cast<std::uint32_t>(sizeof(T))};
+    const T bounds[5] = {precision, lower.X(), lower.Y(), upper.X(),
+                         upper.Y()};
+
+    stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(bounds), sizeof(bounds));
+    WriteArray(stream, xs);
+    WriteArray(stream, segments);
+    WriteArray(stream, nodes);
+    WriteArray(stream, roots);
+    WriteArray(stream, verticals);
+  }
+
+  /**
+   * @brief Прочитать индекс из потока.
+   *
+   * @param stream Поток, открытый в режиме binary.
+   * @return Функция возвращает прочитанный индекс.
+   *
+   * @throw std::invalid_argument если данные не являются индексом,
+   * сохранённым функцией Write() для того же типа T.
+   */
+  static PolygonLocator Read(std::istream& stream) {
+    std::uint32_t header[3] = {0, 0, 0};
+    T bounds[5];
+
+    stream.read(reinterpret_cast<char*>(header), sizeof(header));
+
+    if (!stream || header[0] != magic || header[1] != version ||
+        header[2] != sizeof(T))
+      throw std::invalid_argument("PolygonLocator: invalid header");
+
+    stream.read(reinterpret_cast<char*>(bounds), sizeof(bounds));
+
+    if (!stream)
+      throw std::invalid_argument("PolygonLocator: truncated data");
+
+    PolygonLocator locator;
+
+    locator.precision = bounds[0];
+    locator.lower = Point<T>(bounds[1], bounds[2]);
+    locator.upper = Point<T>(bounds[3], bounds[4]);
+    ReadArray(stream, &locator.xs);
+    ReadArray(stream, &locator.segments);
+    ReadArray(stream, &locator.nodes);
+    ReadArray(stream, &locator.roots);
+    ReadArray(stream, &locator.verticals);
+
+    const std::size_t numSlabs = locator.xs.size() > 1 ?
+                                 locator.xs.size() - 1 : 0;
+    const auto& nodes = locator.nodes;
+    bool valid = locator.roots.size() == numSlabs && !nodes.empty() &&
+                 nodes[0].size == 0;
+
+    // Потомки узла создаются раньше него, поэтому проверка номеров
+    // исключает циклы, а проверка размеров --- неверные ответы.
+    for (std::size_t i = 1; valid && i < nodes.size(); i++) {
+      const Node& node = nodes[i];
+
+      valid = node.segment < locator.segments.size() && node.left < i &&
+              node.right < i &&
+              node.size == std::uint64_t(nodes[node.left].size) +
+                           nodes[node.right].size + 1;
+    }
+
+    for (std::uint32_t root : locator.roots)
+      valid = valid && root < nodes.size();
+
+    if (!valid)
+      throw std::invalid_argument("PolygonLocator: inconsistent data");
+
+    return locator;
+  }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POLYGON_LOCATOR_HPP_
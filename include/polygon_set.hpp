@@ -0,0 +1,344 @@
+/**
+ * @file include/polygon_set.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Поиск многоугольников, содержащих точку, в большом наборе
+ * многоугольников.
+ */
+
+#ifndef INCLUDE_POLYGON_SET_HPP_
+#define INCLUDE_POLYGON_SET_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <angle_point_in_polygon.hpp>
+#include <point_in_polygon.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Набор многоугольников с индексом для поиска по точке.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Ограничивающие прямоугольники многоугольников упаковываются в R-дерево
+ * методом Sort-Tile-Recursive (STR): прямоугольники сортируются по
+ * \f$ X \f$ центра, делятся на вертикальные полосы, внутри полосы
+ * сортируются по \f$ Y \f$ и группируются по nodeCapacity в листья. Тот же
+ * приём повторяется для каждого уровня, пока не останется один корень.
+ * Построение занимает \f$ O(m \log m) \f$ для \f$ m \f$ многоугольников.
+ *
+ * Запрос спускается только в узлы, прямоугольники которых (расширенные на
+ * precision) содержат точку, и проверяет кандидатов с помощью
+ * PreparedPolygon::Classify(). Многоугольник содержит точку, если она
+ * лежит внутри или на границе.
+ *
+ * Объект не изменяется после создания, поэтому запросы можно выполнять из
+ * нескольких потоков одновременно.
+ */
+template<typename T>
+class PolygonSet {
+ public:
+  //! Значение, возвращаемое, если точку не содержит ни один многоугольник.
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  //! Максимальное количество детей узла.
+  static constexpr std::size_t nodeCapacity = 16;
+
+ private:
+  /**
+   * @brief Узел R-дерева.
+   */
+  struct Node {
+    //! Левый нижний угол ограничивающего прямоугольника.
+    Point<T> lower;
+    //! Правый верхний угол ограничивающего прямоугольника.
+    Point<T> upper;
+    //! Первый ребёнок в nodes или первый элемент листа в entries.
+    std::uint32_t first;
+    //! Количество детей.
+    std::uint32_t count;
+    //! Является ли узел листом.
+    bool leaf;
+  };
+
+  //! Подготовленные многоугольники в порядке входа.
+  std::vector<PreparedPolygon<T>> polygons;
+  //! Узлы R-дерева по уровням от листьев, корень последний.
+  std::vector<Node> nodes;
+  //! Номера многоугольников в порядке листьев.
+  std::vector<std::uint32_t> entries;
+  //! Абсолютная точность вычисления ориентации.
+  T precision;
+
+  /**
+   * @brief Упорядочить прямоугольники методом STR.
+   *
+   * @param items Указатель на прямоугольники. Каждые nodeCapacity подряд
+   * идущих прямоугольников после упорядочивания образуют узел.
+   */
+  static void SortTileRecursive(std::vector<Node>* items) {
+    auto centerX = [](const Node& node) {
+      return node.lower.X() / 2 + node.upper.X() / 2;
+    };
+    auto centerY = [](const Node& node) {
+      return node.lower.Y() / 2 + node.upper.Y() / 2;
+    };
+
+    const std::size_t numNodes = (items->size() + nodeCapacity - 1) /
+                                 nodeCapacity;
+    const std::size_t numSlices = static_cast<std::size_t>(
+        std::ceil(std::sqrt(static_cast<double>(numNodes))));
+    const std::size_t sliceSize = numSlices * nodeCapacity;
+
+    std::sort(items->begin(), items->end(),
+              [&centerX](const Node& a, const Node& b) {
+                return centerX(a) < centerX(b);
+              });
+
+    for (std::size_t first = 0; first < items->size(); first += sliceSize) {
+      const std::size_t last = std::min(first + sliceSize, items->size());
+
+      std::sort(items->begin() + first, items->begin() + last,
+                [&centerY](const Node& a, const Node& b) {
+                  return centerY(a) < centerY(b);
+                });
+    }
+  }
+
+  /**
+   * @brief Создать узлы над упорядоченными прямоугольниками.
+   *
+   * @param items Упорядоченные прямоугольники.
+   * @param offset Номер первого прямоугольника в nodes или entries.
+   * @param leaf Являются ли создаваемые узлы листьями.
+   */
+  void Pack(const std::vector<Node>& items, std::size_t offset, bool leaf) {
+    for (std::size_t first = 0; first < items.size();
+         first += nodeCapacity) {
+      const std::size_t last = std::min(first + nodeCapacity, items.size());
+      Node node{items[first].lower, items[first].upper,
+                static_cast<std::uint32_t>(offset + first),
+                static_cast<std::uint32_t>(last - first), leaf};
+
+      for (std::size_t i = first + 1; i < last; i++) {
+        node.lower = Point<T>(std::min(node.lower.X(), items[i].lower.X()),
+                              std::min(node.lower.Y(), items[i].lower.Y()));
+        node.upper = Point<T>(std::max(node.upper.X(), items[i].upper.X()),
+                              std::max(node.upper.Y(), items[i].upper.Y()));
+      }
+
+      nodes.push_back(node);
+    }
+  }
+
+  /**
+   * @brief Обойти многоугольники, содержащие точку.
+   *
+   * @tparam Visit Тип функции обработки многоугольника.
+   * @param index Номер узла.
+   * @param point Точка.
+   * @param visit Функция, вызываемая для номера каждого многоугольника,
+   * содержащего точку.
+   */
+  template<typename Visit>
+  void Search(std::size_t index, const Point<T>& point, Visit& visit) const {
+    const Node& node = nodes[index];
+
+    if (point.X() < node.lower.X() - precision ||
+        point.X() > node.upper.X() + precision ||
+        point.Y() < node.lower.Y() - precision ||
+        point.Y() > node.upper.Y() + precision)
+      return;
+
+    for (std::size_t i = node.first; i < node.first + node.count; i++) {
+      if (!node.leaf) {
+        Search(i, point, visit);
+        continue;
+      }
+
+      const std::uint32_t polygon = entries[i];
+
+      if (polygons[polygon].Classify(point) != PointPosition::OUTSIDE)
+        visit(polygon);
+    }
+  }
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Построить индекс набора многоугольников.
+   *
+   * @tparam Container Тип контейнера для хранения вершин.
+   * @param polygons Многоугольники.
+   * @param precision Абсолютная точность вычисления ориентации.
+   *
+   * @throw std::length_error если многоугольников больше
+   * \f$ 2^{32} - 1 \f$.
+   */
+  template<typename Container>
+  explicit PolygonSet(const std::vector<Polygon<T, Container>>& polygons,
+                      T precision = T(1e-9)) :
+    precision(precision) {
+    if (polygons.size() > std::numeric_limits<std::uint32_t>::max())
+      throw std::length_error("PolygonSet: too many polygons");
+
+    std::vector<Node> items;
+
+    this->polygons.reserve(polygons.size());
+
+    for (std::size_t i = 0; i < polygons.size(); i++) {
+      this->polygons.emplace_back(polygons[i], precision);
+
+      // Пустые многоугольники не содержат точек и не попадают в дерево.
+      if (polygons[i].Size() > 0)
+        items.push_back(Node{this->polygons[i].Lower(),
+                             this->polygons[i].Upper(),
+                             static_cast<std::uint32_t>(i), 0, true});
+    }
+
+    if (items.empty())
+      return;
+
+    SortTileRecursive(&items);
+
+    for (const Node& item : items)
+      entries.push_back(item.first);
+
+    Pack(items, 0, true);
+
+    std::size_t levelStart = 0;
+
+    while (nodes.size() - levelStart > 1) {
+      const std::size_t levelEnd = nodes.size();
+
+      items.assign(nodes.begin() + levelStart, nodes.end());
+      SortTileRecursive(&items);
+
+      // Дети узла должны идти подряд, поэтому уровень переупорядочивается.
+      std::copy(items.begin(), items.end(), nodes.begin() + levelStart);
+      Pack(items, levelStart, false);
+
+      levelStart = levelEnd;
+    }
+  }
+
+  /**
+   * @brief Найти многоугольник, содержащий точку.
+   *
+   * @param point Точка.
+   * @return Функция возвращает наименьший номер многоугольника, внутри или
+   * на границе которого лежит точка, или npos.
+   */
+  std::size_t Find(const Point<T>& point) const {
+    std::size_t result = npos;
+
+    if (nodes.empty())
+      return result;
+
+    auto visit = [&result](std::size_t polygon) {
+      result = std::min(result, polygon);
+    };
+
+    Search(nodes.size() - 1, point, visit);
+
+    return result;
+  }
+
+  /**
+   * @brief Найти все многоугольники, содержащие точку.
+   *
+   * @param point Точка.
+   * @param result Указатель на массив, в который записываются номера
+   * многоугольников по возрастанию.
+   */
+  void FindAll(const Point<T>& point, std::vector<std::size_t>* result) const {
+    result->clear();
+
+    if (nodes.empty())
+      return;
+
+    auto visit = [result](std::size_t polygon) {
+      result->push_back(polygon);
+    };
+
+    Search(nodes.size() - 1, point, visit);
+    std::sort(result->begin(), result->end());
+  }
+
+  /**
+   * @brief Найти многоугольники, содержащие точки.
+   *
+   * @param points Точки.
+   * @param threads Количество потоков (0 --- по количеству аппаратных
+   * потоков).
+   * @return Функция возвращает для каждой точки результат Find().
+   *
+   * Точки распределяются по потокам функцией ParallelFor().
+   */
+  std::vector<std::size_t> Find(const std::vector<Point<T>>& points,
+                                std::size_t threads = 0) const {
+    std::vector<std::size_t> result(points.size());
+
+    ParallelFor(points.size(), threads, nodeCapacity * Depth(),
+        [this, &points, &result](std::size_t first, std::size_t last) {
+          for (std::size_t i = first; i < last; i++)
+            result[i] = Find(points[i]);
+        });
+
+    return result;
+  }
+
+  /**
+   * @brief Получить количество многоугольников.
+   * @return Функция возвращает количество многоугольников в наборе.
+   */
+  std::size_t Size() const { return polygons.size(); }
+
+  /**
+   * @brief Получить многоугольник.
+   *
+   * @param index Номер многоугольника.
+   * @return Функция возвращает подготовленный многоугольник.
+   */
+  const PreparedPolygon<T>& operator[](std::size_t index) const {
+    return polygons[index];
+  }
+
+  /**
+   * @brief Получить количество узлов R-дерева.
+   * @return Функция возвращает количество узлов.
+   */
+  std::size_t NumNodes() const { return nodes.size(); }
+
+  /**
+   * @brief Получить высоту R-дерева.
+   * @return Функция возвращает количество уровней (0 для пустого набора).
+   */
+  std::size_t Depth() const {
+    std::size_t depth = 0;
+
+    for (std::size_t index = nodes.size(); index > 0;
+         index = nodes[index - 1].first + 1) {
+      depth++;
+
+      if (nodes[index - 1].leaf)
+        break;
+    }
+
+    return depth;
+  }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POLYGON_SET_HPP_
@@ -0,0 +1,361 @@
+/**
+ * @file include/polygon_triangulation.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Simple polygon triangulation: sweep-line decomposition into
+ * y-monotone pieces followed by monotone triangulation.
+ */
+
+#ifndef INCLUDE_POLYGON_TRIANGULATION_HPP_
+#define INCLUDE_POLYGON_TRIANGULATION_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <monotone_polygone_triangulation.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Type of a polygon vertex for the make-monotone sweep
+ */
+enum class VertexType {
+    START,    //!< both neighbours below, interior angle < pi
+    END,      //!< both neighbours above, interior angle < pi
+    SPLIT,    //!< both neighbours below, interior angle > pi
+    MERGE,    //!< both neighbours above, interior angle > pi
+    REGULAR   //!< one neighbour above and one below
+};
+
+/**
+ * @brief Split a simple polygon into y-monotone pieces
+ *
+ * @tparam T coordinate type
+ * @tparam OrientationPolicy orientation predicate type
+ * (see predicates.hpp)
+ * @param polygon simple polygon in counterclockwise order
+ * @param orientation orientation predicate used to classify vertices
+ * @return vector of diagonals as pairs of vertex positions in the polygon
+ *
+ * The sweep line goes from top to bottom over the vertices ordered by
+ * SweepPrecedes(). The status tree holds the edges that have the interior
+ * of the polygon on their right and cross the sweep line, ordered by the
+ * x coordinate of the crossing; every edge keeps its helper, the lowest
+ * vertex above the sweep line visible from the edge. Split vertices are
+ * connected to the helper of the edge on their left, and merge vertices
+ * to the next vertex that takes over as a helper. Each vertex does O(1)
+ * tree operations, so the sweep takes O(n log n) time.
+ *
+ * @throw std::invalid_argument if the sweep finds two boundary edges
+ * crossing the sweep line at the same point or a vertex without the
+ * edges its type requires, i.e. the polygon is not simple.
+ */
+template<typename T, typename OrientationPolicy>
+std::vector<std::pair<size_t, size_t>> MakeMonotone(
+    const std::vector<Point<T>>& polygon,
+    const OrientationPolicy& orientation) {
+    std::vector<std::pair<size_t, size_t>> diagonals;
+    const size_t n = polygon.size();
+    if (n < 4) return diagonals;
+
+    auto next = [n](size_t i) { return i + 1 == n ? 0 : i + 1; };
+    auto prev = [n](size_t i) { return i == 0 ? n - 1 : i - 1; };
+
+    std::vector<VertexType> types(n);
+    for (size_t i = 0; i < n; ++i) {
+        const Point<T>& p = polygon[prev(i)];
+        const Point<T>& v = polygon[i];
+        const Point<T>& q = polygon[next(i)];
+        const bool convex = orientation(p, v, q) >= 0;
+
+        if (SweepPrecedes(v, p) && SweepPrecedes(v, q))
+            types[i] = convex ? VertexType::START : VertexType::SPLIT;
+        else if (SweepPrecedes(p, v) && SweepPrecedes(q, v))
+            types[i] = convex ? VertexType::END : VertexType::MERGE;
+        else
+            types[i] = VertexType::REGULAR;
+    }
+
+    std::vector<size_t> events(n);
+    for (size_t i = 0; i < n; ++i)
+        events[i] = i;
+    std::sort(events.begin(), events.end(), [&polygon](size_t a, size_t b) {
+        return SweepPrecedes(polygon[a], polygon[b]);
+    });
+
+    // Edge i goes from vertex i to vertex i + 1. Key n is a probe used to
+    // find the edge on the left of a vertex.
+    double sweepY = 0.0;
+    double probeX = 0.0;
+    auto crossingX = [&](size_t edge) {
+        if (edge == n) return probeX;
+        const double ax = static_cast<double>(polygon[edge].X());
+        const double ay = static_cast<double>(polygon[edge].Y());
+        const double bx = static_cast<double>(polygon[next(edge)].X());
+        const double by = static_cast<double>(polygon[next(edge)].Y());
+        if (ay == by) return std::min(ax, bx);
+        return ax + (bx - ax) * (sweepY - ay) / (by - ay);
+    };
+    auto less = [&crossingX](size_t a, size_t b) {
+        return crossingX(a) < crossingX(b);
+    };
+
+    std::set<size_t, decltype(less)> status(less);
+    std::vector<typename decltype(status)::iterator> position(n,
+                                                              status.end());
+    std::vector<size_t> helper(n);
+
+    // A self-touching boundary puts two edges at the same crossing or
+    // leaves a vertex without the edge its type expects; stop there rather
+    // than let position[] alias another edge's node.
+    auto notSimple = []() {
+        return std::invalid_argument("polygon is not simple");
+    };
+    auto insert = [&](size_t edge, size_t vertex) {
+        auto inserted = status.insert(edge);
+        if (!inserted.second) throw notSimple();
+        position[edge] = inserted.first;
+        helper[edge] = vertex;
+    };
+    auto erase = [&](size_t edge) {
+        if (position[edge] == status.end()) throw notSimple();
+        status.erase(position[edge]);
+        position[edge] = status.end();
+    };
+    auto connectMerge = [&](size_t edge, size_t vertex) {
+        if (types[helper[edge]] == VertexType::MERGE)
+            diagonals.emplace_back(vertex, helper[edge]);
+    };
+    auto leftEdge = [&](size_t vertex) {
+        probeX = static_cast<double>(polygon[vertex].X());
+        auto it = status.upper_bound(n);
+        if (it == status.begin()) throw notSimple();
+        return *--it;
+    };
+
+    for (size_t vertex : events) {
+        sweepY = static_cast<double>(polygon[vertex].Y());
+        const size_t in = prev(vertex);
+        size_t left;
+
+        switch (types[vertex]) {
+            case VertexType::START:
+                insert(vertex, vertex);
+                break;
+            case VertexType::END:
+                connectMerge(in, vertex);
+                erase(in);
+                break;
+            case VertexType::SPLIT:
+                left = leftEdge(vertex);
+                diagonals.emplace_back(vertex, helper[left]);
+                helper[left] = vertex;
+                insert(vertex, vertex);
+                break;
+            case VertexType::MERGE:
+                connectMerge(in, vertex);
+                erase(in);
+                left = leftEdge(vertex);
+                connectMerge(left, vertex);
+                helper[left] = vertex;
+                break;
+            case VertexType::REGULAR:
+                // The boundary goes down here, so the interior is on the
+                // right of the vertex.
+                if (SweepPrecedes(polygon[in], polygon[vertex])) {
+                    connectMerge(in, vertex);
+                    erase(in);
+                    insert(vertex, vertex);
+                } else {
+                    left = leftEdge(vertex);
+                    connectMerge(left, vertex);
+                    helper[left] = vertex;
+                }
+                break;
+        }
+    }
+
+    return diagonals;
+}
+
+/**
+ * @brief Split a polygon along non-crossing diagonals
+ *
+ * @tparam T coordinate type
+ * @param polygon simple polygon in counterclockwise order
+ * @param diagonals diagonals as pairs of vertex positions
+ * @return vector of pieces, each as vertex positions in counterclockwise
+ * order
+ *
+ * The diagonals leaving every vertex are sorted by angle from its outgoing
+ * edge. A piece is traced by always taking, at the end of a side, the
+ * next side clockwise from it, which keeps the piece on the left. The
+ * split takes O(n + m log m) time for m diagonals.
+ */
+template<typename T>
+std::vector<std::vector<size_t>> SplitPolygon(
+    const std::vector<Point<T>>& polygon,
+    const std::vector<std::pair<size_t, size_t>>& diagonals) {
+    const size_t n = polygon.size();
+    const size_t sides = n + 2 * diagonals.size();
+    std::vector<std::vector<size_t>> pieces;
+    if (n < 3) return pieces;
+
+    // Side i < n goes from vertex i to vertex i + 1, sides n + 2k and
+    // n + 2k + 1 are diagonal k in both directions.
+    auto origin = [&](size_t side) {
+        if (side < n) return side;
+        const auto& diagonal = diagonals[(side - n) / 2];
+        return (side - n) % 2 == 0 ? diagonal.first : diagonal.second;
+    };
+    auto twin = [n](size_t side) { return n + ((side - n) ^ 1); };
+    auto target = [&](size_t side) {
+        if (side < n) return side + 1 == n ? size_t(0) : side + 1;
+        return origin(twin(side));
+    };
+
+    // Diagonals leaving each vertex, sorted counterclockwise from the
+    // outgoing edge of the vertex.
+    std::vector<size_t> first(n + 1, 0);
+    for (size_t side = n; side < sides; ++side)
+        ++first[origin(side) + 1];
+    for (size_t i = 0; i < n; ++i)
+        first[i + 1] += first[i];
+
+    std::vector<size_t> outgoing(sides - n);
+    std::vector<size_t> fill(first.begin(), first.end() - 1);
+    for (size_t side = n; side < sides; ++side)
+        outgoing[fill[origin(side)]++] = side;
+
+    std::vector<size_t> rank(sides, 0);
+    for (size_t v = 0; v < n; ++v) {
+        const Point<T>& o = polygon[v];
+        const Point<T>& e = polygon[v + 1 == n ? 0 : v + 1];
+        auto angle = [&](size_t side) {
+            const Point<T>& w = polygon[target(side)];
+            const double ex = static_cast<double>(e.X()) - o.X();
+            const double ey = static_cast<double>(e.Y()) - o.Y();
+            const double wx = static_cast<double>(w.X()) - o.X();
+            const double wy = static_cast<double>(w.Y()) - o.Y();
+            const double a = std::atan2(ex * wy - ey * wx, ex * wx + ey * wy);
+            return a < 0.0 ? a + 2.0 * M_PI : a;
+        };
+        std::sort(outgoing.begin() + first[v], outgoing.begin() + first[v + 1],
+                  [&angle](size_t a, size_t b) {
+                      return angle(a) < angle(b);
+                  });
+        for (size_t k = first[v]; k < first[v + 1]; ++k)
+            rank[outgoing[k]] = k - first[v] + 1;
+    }
+
+    // The side after one ending at v is the one just clockwise of it
+    // around v: rank 0 is the outgoing edge, the polygon edge coming into
+    // v comes after the last diagonal.
+    auto following = [&](size_t side) {
+        const size_t v = target(side);
+        const size_t k = side < n ? first[v + 1] - first[v] + 1 :
+                                    rank[twin(side)];
+        return k == 1 ? v : outgoing[first[v] + k - 2];
+    };
+
+    std::vector<char> visited(sides, 0);
+    for (size_t start = 0; start < sides; ++start) {
+        if (visited[start]) continue;
+        std::vector<size_t> piece;
+        for (size_t side = start; !visited[side]; side = following(side)) {
+            visited[side] = 1;
+            piece.push_back(origin(side));
+        }
+        pieces.push_back(std::move(piece));
+    }
+
+    return pieces;
+}
+
+/**
+ * @brief Triangulate a simple polygon
+ *
+ * @tparam T coordinate type
+ * @tparam OrientationPolicy orientation predicate type
+ * (see predicates.hpp)
+ * @param polygon simple polygon vertices in either order
+ * @param orientation orientation predicate used by the sweeps
+ * @return flat buffer of 3 (n - 2) vertex positions in the polygon, three
+ * per triangle, every triangle in counterclockwise order
+ *
+ * MakeMonotone() cuts the polygon into y-monotone pieces, SplitPolygon()
+ * extracts them, and TriangulateMonotonePolygon() triangulates each piece
+ * in linear time. The whole triangulation takes O(n log n) time.
+ *
+ * @throw std::length_error if there are more than 2^32 - 1 vertices.
+ * @throw std::invalid_argument if the polygon is not simple and the sweep
+ * detects it (see MakeMonotone()).
+ */
+template<typename T, typename OrientationPolicy>
+std::vector<uint32_t> TriangulatePolygon(const std::vector<Point<T>>& polygon,
+                                         const OrientationPolicy& orientation) {
+    std::vector<uint32_t> triangles;
+    const size_t n = polygon.size();
+    if (n < 3) return triangles;
+    if (n > std::numeric_limits<uint32_t>::max())
+        throw std::length_error("TriangulatePolygon: too many vertices");
+
+    // The topmost vertex is convex, so the turn at it gives the direction
+    // of the boundary.
+    size_t top = 0;
+    for (size_t i = 1; i < n; ++i)
+        if (SweepPrecedes(polygon[i], polygon[top])) top = i;
+    const bool ccw = orientation(polygon[top == 0 ? n - 1 : top - 1],
+                                 polygon[top],
+                                 polygon[top + 1 == n ? 0 : top + 1]) >= 0;
+
+    std::vector<Point<T>> reversed;
+    if (!ccw)
+        reversed.assign(polygon.rbegin(), polygon.rend());
+    const std::vector<Point<T>>& boundary = ccw ? polygon : reversed;
+
+    triangles.reserve(3 * (n - 2));
+    std::vector<Point<T>> piece;
+    for (const auto& positions : SplitPolygon(boundary,
+                                              MakeMonotone(boundary,
+                                                           orientation))) {
+        piece.clear();
+        for (size_t position : positions)
+            piece.push_back(boundary[position]);
+
+        for (uint32_t local : TriangulateMonotonePolygon(piece, orientation)) {
+            const size_t position = positions[local];
+            triangles.push_back(static_cast<uint32_t>(
+                ccw ? position : n - 1 - position));
+        }
+    }
+
+    return triangles;
+}
+
+/**
+ * @brief Triangulate a simple polygon
+ *
+ * @tparam T coordinate type
+ * @param polygon simple polygon vertices in either order
+ * @return flat buffer of vertex positions, three per triangle
+ *
+ * The sign of the cross product is used as is, without any tolerance.
+ */
+template<typename T>
+std::vector<uint32_t> TriangulatePolygon(
+    const std::vector<Point<T>>& polygon) {
+    return TriangulatePolygon(polygon, ToleranceOrientationPolicy<T>());
+}
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POLYGON_TRIANGULATION_HPP_
@@ -0,0 +1,273 @@
+/**
+ * @file include/polygon_with_holes.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Многоугольник с дырами и определение положения точки относительно него.
+ */
+
+#ifndef INCLUDE_POLYGON_WITH_HOLES_HPP_
+#define INCLUDE_POLYGON_WITH_HOLES_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <angle_point_in_polygon.hpp>
+#include <point_in_polygon.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Многоугольник с дырами: внешнее кольцо и внутренние кольца.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Вершины всех колец копируются в общие массивы координат, для каждого
+ * кольца запоминается ограничивающий прямоугольник. Classify() за один
+ * проход по кольцам считает чётность числа пересечений горизонтального
+ * луча из точки с рёбрами (crossing number). Кольцо, ограничивающий
+ * прямоугольник которого (расширенный на precision) не содержит точку,
+ * пересекает луч чётное число раз и пропускается целиком.
+ *
+ * Направление обхода колец не важно. Если дыры лежат внутри внешнего
+ * кольца и не пересекаются, то точка внутри, если она внутри внешнего
+ * кольца и снаружи всех дыр. Точка на ребре любого кольца лежит на
+ * границе.
+ *
+ * Объект не изменяется после создания, поэтому Classify() можно вызывать
+ * из нескольких потоков одновременно.
+ */
+template<typename T>
+class PolygonWithHoles {
+ private:
+  /**
+   * @brief Кольцо в общих массивах координат.
+   */
+  struct Ring {
+    //! Левый нижний угол ограничивающего прямоугольника.
+    Point<T> lower;
+    //! Правый верхний угол ограничивающего прямоугольника.
+    Point<T> upper;
+    //! Номер первого ребра.
+    std::size_t first;
+    //! Номер, следующий за последним ребром.
+    std::size_t last;
+  };
+
+  //! Координаты \f$ X \f$ вершин колец, после каждого кольца повторяется
+  //! его первая вершина.
+  std::vector<T> xs;
+  //! Координаты \f$ Y \f$ вершин колец, после каждого кольца повторяется
+  //! его первая вершина.
+  std::vector<T> ys;
+  //! Приращения \f$ X \f$ вдоль рёбер (0 для повторённых вершин).
+  std::vector<T> dxs;
+  //! Приращения \f$ Y \f$ вдоль рёбер (0 для повторённых вершин).
+  std::vector<T> dys;
+  //! Кольца, внешнее первое. Пустые кольца не хранятся.
+  std::vector<Ring> rings;
+  //! Количество рёбер во всех кольцах.
+  std::size_t size = 0;
+  //! Количество дыр.
+  std::size_t numHoles = 0;
+  //! Абсолютная точность вычисления ориентации.
+  T precision = T(1e-9);
+
+  /**
+   * @brief Добавить кольцо.
+   *
+   * @tparam Container Тип контейнера для хранения вершин.
+   * @param polygon Кольцо.
+   */
+  template<typename Container>
+  void AddRing(const Polygon<T, Container>& polygon) {
+    if (polygon.Size() == 0)
+      return;
+
+    Ring ring{Point<T>(std::numeric_limits<T>::max(),
+                       std::numeric_limits<T>::max()),
+              Point<T>(std::numeric_limits<T>::lowest(),
+                       std::numeric_limits<T>::lowest()),
+              xs.size(), xs.size() + polygon.Size()};
+    const auto edges = polygon.Edges();
+
+    for (auto edge = edges.begin(); edge != edges.end(); ++edge) {
+      const Point<T>& a = edge.Origin();
+      const Point<T> d = edge.Destination() - a;
+
+      xs.push_back(a.X());
+      ys.push_back(a.Y());
+      dxs.push_back(d.X());
+      dys.push_back(d.Y());
+
+      ring.lower = Point<T>(std::min(ring.lower.X(), a.X()),
+                            std::min(ring.lower.Y(), a.Y()));
+      ring.upper = Point<T>(std::max(ring.upper.X(), a.X()),
+                            std::max(ring.upper.Y(), a.Y()));
+    }
+
+    xs.push_back(xs[ring.first]);
+    ys.push_back(ys[ring.first]);
+    dxs.push_back(T(0));
+    dys.push_back(T(0));
+
+    rings.push_back(ring);
+    size += polygon.Size();
+  }
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Создать пустой многоугольник.
+   */
+  PolygonWithHoles() = default;
+
+  /**
+   * @brief Создать многоугольник с дырами.
+   *
+   * @tparam Container Тип контейнера для хранения вершин.
+   * @param outer Внешнее кольцо.
+   * @param holes Внутренние кольца.
+   * @param precision Абсолютная точность вычисления ориентации.
+   *
+   * Если внешнее кольцо пустое, то многоугольник не содержит ни одной
+   * точки, а дыры не сохраняются.
+   */
+  template<typename Container>
+  explicit PolygonWithHoles(const Polygon<T, Container>& outer,
+      const std::vector<Polygon<T, Container>>& holes = {},
+      T precision = T(1e-9)) :
+    precision(precision) {
+    if (outer.Size() == 0)
+      return;
+
+    std::size_t total = outer.Size() + 1;
+
+    for (const auto& hole : holes)
+      total += hole.Size() + 1;
+
+    xs.reserve(total);
+    ys.reserve(total);
+    dxs.reserve(total);
+    dys.reserve(total);
+
+    AddRing(outer);
+
+    for (const auto& hole : holes)
+      AddRing(hole);
+
+    numHoles = holes.size();
+  }
+
+  /**
+   * @brief Определить положение точки.
+   *
+   * @param point Точка.
+   * @return Функция возвращает положение точки относительно многоугольника.
+   *
+   * Проверка ребра та же, что в PreparedPolygon::Classify(), но вместо
+   * числа оборотов меняется чётность. Точка вне ограничивающего
+   * прямоугольника внешнего кольца сразу считается внешней.
+   */
+  PointPosition Classify(const Point<T>& point) const {
+    const T px = point.X();
+    const T py = point.Y();
+    bool inside = false;
+
+    for (const Ring& ring : rings) {
+      if (px < ring.lower.X() - precision ||
+          px > ring.upper.X() + precision ||
+          py < ring.lower.Y() - precision ||
+          py > ring.upper.Y() + precision) {
+        // Снаружи внешнего кольца точка снаружи и всех дыр.
+        if (&ring == &rings.front())
+          return PointPosition::OUTSIDE;
+
+        continue;
+      }
+
+      for (std::size_t i = ring.first; i < ring.last; i++) {
+        const T ay = ys[i];
+        const T by = ys[i + 1];
+
+        if ((ay > py + precision && by > py + precision) ||
+            (ay < py - precision && by < py - precision))
+          continue;
+
+        const T ax = xs[i];
+        const T cross = dxs[i] * (py - ay) - (px - ax) * dys[i];
+
+        if (cross >= -precision && cross <= precision) {
+          const T bx = xs[i + 1];
+
+          if (px >= std::min(ax, bx) - precision &&
+              px <= std::max(ax, bx) + precision &&
+              py >= std::min(ay, by) - precision &&
+              py <= std::max(ay, by) + precision)
+            return PointPosition::BOUNDARY;
+
+          continue;
+        }
+
+        if ((ay <= py && by > py && cross > precision) ||
+            (by <= py && ay > py && cross < -precision))
+          inside = !inside;
+      }
+    }
+
+    return inside ? PointPosition::INSIDE : PointPosition::OUTSIDE;
+  }
+
+  /**
+   * @brief Определить положение набора точек.
+   *
+   * @param points Точки.
+   * @param threads Количество потоков (0 --- по количеству аппаратных
+   * потоков).
+   * @return Функция возвращает положение каждой точки в порядке входа.
+   *
+   * Точки распределяются по потокам функцией ClassifyInParallel().
+   */
+  std::vector<PointPosition> Classify(const std::vector<Point<T>>& points,
+                                      std::size_t threads = 0) const {
+    return ClassifyInParallel(*this, points, threads, size);
+  }
+
+  /**
+   * @brief Получить количество рёбер.
+   * @return Функция возвращает количество рёбер во всех кольцах.
+   */
+  std::size_t Size() const { return size; }
+
+  /**
+   * @brief Получить количество дыр.
+   * @return Функция возвращает количество внутренних колец.
+   */
+  std::size_t NumHoles() const { return numHoles; }
+
+  /**
+   * @brief Получить левый нижний угол ограничивающего прямоугольника.
+   * @return Функция возвращает точку с наименьшими координатами внешнего
+   * кольца.
+   */
+  Point<T> Lower() const {
+    return rings.empty() ? Point<T>() : rings.front().lower;
+  }
+
+  /**
+   * @brief Получить правый верхний угол ограничивающего прямоугольника.
+   * @return Функция возвращает точку с наибольшими координатами внешнего
+   * кольца.
+   */
+  Point<T> Upper() const {
+    return rings.empty() ? Point<T>() : rings.front().upper;
+  }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_POLYGON_WITH_HOLES_HPP_
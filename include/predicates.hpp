@@ -0,0 +1,551 @@
+/**
+ * @file include/predicates.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Адаптивный точный предикат ориентации и стратегии вычисления ориентации.
+ */
+
+#ifndef INCLUDE_PREDICATES_HPP_
+#define INCLUDE_PREDICATES_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <point.hpp>
+#include <orientation.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Счётчики вызовов адаптивного предиката.
+ *
+ * Счётчики не синхронизированы, поэтому каждый поток должен использовать
+ * собственный экземпляр структуры.
+ */
+struct OrientationStatistics {
+  //! Общее количество вызовов предиката.
+  std::uint64_t calls = 0;
+  //! Количество вызовов, для которых потребовалась точная арифметика.
+  std::uint64_t exactCalls = 0;
+};
+
+/**
+ * @brief Вычислить сумму двух чисел без потери точности.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * @param a Первое слагаемое.
+ * @param b Второе слагаемое.
+ * @param x В эту переменную запишется округлённая сумма.
+ * @param y В эту переменную запишется ошибка округления.
+ *
+ * Функция находит такие x и y, что \f$ a + b = x + y \f$ точно.
+ * Требуется \f$ |a| \ge |b| \f$.
+ */
+template<typename T>
+void FastTwoSum(T a, T b, T* x, T* y) {
+  *x = a + b;
+  T bVirtual = *x - a;
+  *y = b - bVirtual;
+}
+
+/**
+ * @brief Вычислить сумму двух чисел без потери точности.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * @param a Первое слагаемое.
+ * @param b Второе слагаемое.
+ * @param x В эту переменную запишется округлённая сумма.
+ * @param y В эту переменную запишется ошибка округления.
+ *
+ * Функция находит такие x и y, что \f$ a + b = x + y \f$ точно.
+ */
+template<typename T>
+void TwoSum(T a, T b, T* x, T* y) {
+  *x = a + b;
+  T bVirtual = *x - a;
+  T aVirtual = *x - bVirtual;
+  T bRoundoff = b - bVirtual;
+  T aRoundoff = a - aVirtual;
+  *y = aRoundoff + bRoundoff;
+}
+
+/**
+ * @brief Вычислить разность двух чисел без потери точности.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * @param a Уменьшаемое.
+ * @param b Вычитаемое.
+ * @param x В эту переменную запишется округлённая разность.
+ * @param y В эту переменную запишется ошибка округления.
+ *
+ * Функция находит такие x и y, что \f$ a - b = x + y \f$ точно.
+ */
+template<typename T>
+void TwoDiff(T a, T b, T* x, T* y) {
+  *x = a - b;
+  T bVirtual = a - *x;
+  T aVirtual = *x + bVirtual;
+  T bRoundoff = bVirtual - b;
+  T aRoundoff = a - aVirtual;
+  *y = aRoundoff + bRoundoff;
+}
+
+/**
+ * @brief Проверить, поддерживает ли процессор быструю инструкцию FMA.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ * @return Функция возвращает true, если для типа T определён макрос
+ * FP_FAST_FMA (FP_FAST_FMAF, FP_FAST_FMAL).
+ */
+template<typename T>
+constexpr bool HasFastFma() {
+#ifdef FP_FAST_FMA
+  if constexpr (std::is_same_v<T, double>)
+    return true;
+#endif
+#ifdef FP_FAST_FMAF
+  if constexpr (std::is_same_v<T, float>)
+    return true;
+#endif
+#ifdef FP_FAST_FMAL
+  if constexpr (std::is_same_v<T, long double>)
+    return true;
+#endif
+  return false;
+}
+
+/**
+ * @brief Вычислить произведение двух чисел без потери точности.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * @param a Первый множитель.
+ * @param b Второй множитель.
+ * @param x В эту переменную запишется округлённое произведение.
+ * @param y В эту переменную запишется ошибка округления.
+ *
+ * Функция находит такие x и y, что \f$ a b = x + y \f$ точно. Если
+ * аппаратная инструкция FMA доступна, ошибка вычисляется с её помощью
+ * (в этом случае компилятор может объединять операции, и разбиение Деккера
+ * перестаёт быть точным), иначе используется разбиение Деккера.
+ */
+template<typename T>
+void TwoProduct(T a, T b, T* x, T* y) {
+  *x = a * b;
+
+  if constexpr (HasFastFma<T>()) {
+    *y = std::fma(a, b, -*x);
+  } else {
+    const T splitter = std::ldexp(T(1),
+        (std::numeric_limits<T>::digits + 1) / 2) + T(1);
+
+    T c = splitter * a;
+    T aBig = c - a;
+    T aHigh = c - aBig;
+    T aLow = a - aHigh;
+
+    c = splitter * b;
+    T bBig = c - b;
+    T bHigh = c - bBig;
+    T bLow = b - bHigh;
+
+    T err1 = *x - aHigh * bHigh;
+    T err2 = err1 - aLow * bHigh;
+    T err3 = err2 - aHigh * bLow;
+    *y = aLow * bLow - err3;
+  }
+}
+
+/**
+ * @brief Умножить расширение на число.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * @param size Количество компонент расширения.
+ * @param e Компоненты расширения в порядке возрастания модуля.
+ * @param b Множитель.
+ * @param h Массив для результата (не меньше 2 * size элементов).
+ * @return Функция возвращает количество компонент результата.
+ *
+ * Нулевые компоненты результата отбрасываются.
+ */
+template<typename T>
+std::size_t ScaleExpansion(std::size_t size, const T* e, T b, T* h) {
+  std::size_t length = 0;
+  T q, hh;
+
+  TwoProduct(e[0], b, &q, &hh);
+
+  if (hh != T(0))
+    h[length++] = hh;
+
+  for (std::size_t i = 1; i < size; i++) {
+    T product1, product0, sum;
+
+    TwoProduct(e[i], b, &product1, &product0);
+    TwoSum(q, product0, &sum, &hh);
+
+    if (hh != T(0))
+      h[length++] = hh;
+
+    FastTwoSum(product1, sum, &q, &hh);
+
+    if (hh != T(0))
+      h[length++] = hh;
+  }
+
+  if (q != T(0) || length == 0)
+    h[length++] = q;
+
+  return length;
+}
+
+/**
+ * @brief Сложить два расширения.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * @param eSize Количество компонент первого расширения.
+ * @param e Компоненты первого расширения в порядке возрастания модуля.
+ * @param fSize Количество компонент второго расширения.
+ * @param f Компоненты второго расширения в порядке возрастания модуля.
+ * @param h Массив для результата (не меньше eSize + fSize элементов).
+ * @return Функция возвращает количество компонент результата.
+ *
+ * Нулевые компоненты результата отбрасываются.
+ */
+template<typename T>
+std::size_t ExpansionSum(std::size_t eSize, const T* e,
+                         std::size_t fSize, const T* f, T* h) {
+  std::size_t eIndex = 0;
+  std::size_t fIndex = 0;
+  std::size_t length = 0;
+  T eNow = e[0];
+  T fNow = f[0];
+  T q, qNew, hh;
+
+  auto nextE = [&]() { eNow = ++eIndex < eSize ? e[eIndex] : T(0); };
+  auto nextF = [&]() { fNow = ++fIndex < fSize ? f[fIndex] : T(0); };
+
+  if ((fNow > eNow) == (fNow > -eNow)) {
+    q = eNow;
+    nextE();
+  } else {
+    q = fNow;
+    nextF();
+  }
+
+  if (eIndex < eSize && fIndex < fSize) {
+    if ((fNow > eNow) == (fNow > -eNow)) {
+      FastTwoSum(eNow, q, &qNew, &hh);
+      nextE();
+    } else {
+      FastTwoSum(fNow, q, &qNew, &hh);
+      nextF();
+    }
+
+    q = qNew;
+
+    if (hh != T(0))
+      h[length++] = hh;
+
+    while (eIndex < eSize && fIndex < fSize) {
+      if ((fNow > eNow) == (fNow > -eNow)) {
+        TwoSum(q, eNow, &qNew, &hh);
+        nextE();
+      } else {
+        TwoSum(q, fNow, &qNew, &hh);
+        nextF();
+      }
+
+      q = qNew;
+
+      if (hh != T(0))
+        h[length++] = hh;
+    }
+  }
+
+  while (eIndex < eSize) {
+    TwoSum(q, eNow, &qNew, &hh);
+    nextE();
+    q = qNew;
+
+    if (hh != T(0))
+      h[length++] = hh;
+  }
+
+  while (fIndex < fSize) {
+    TwoSum(q, fNow, &qNew, &hh);
+    nextF();
+    q = qNew;
+
+    if (hh != T(0))
+      h[length++] = hh;
+  }
+
+  if (q != T(0) || length == 0)
+    h[length++] = q;
+
+  return length;
+}
+
+/**
+ * @brief Вычислить знак векторного произведения точно.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ *
+ * @param p0 Начало первого вектора.
+ * @param p1 Конец первого вектора.
+ * @param q0 Начало второго вектора.
+ * @param q1 Конец второго вектора.
+ * @return Функция возвращает знак \f$ (p_1 - p_0) \times (q_1 - q_0) \f$.
+ *
+ * Разности координат и произведения представляются расширениями
+ * (суммами неперекрывающихся чисел с плавающей точкой), поэтому результат
+ * не содержит ошибок округления.
+ */
+template<typename T>
+int CrossProductSignExact(const Point<T>& p0, const Point<T>& p1,
+                          const Point<T>& q0, const Point<T>& q1) {
+  T px[2], py[2], qx[2], qy[2];
+
+  TwoDiff(p1.X(), p0.X(), &px[1], &px[0]);
+  TwoDiff(p1.Y(), p0.Y(), &py[1], &py[0]);
+  TwoDiff(q1.X(), q0.X(), &qx[1], &qx[0]);
+  TwoDiff(q1.Y(), q0.Y(), &qy[1], &qy[0]);
+
+  // Знак выражения px * qy - py * qx.
+  T negativePy[2] = {-py[0], -py[1]};
+  T part0[4], part1[4], left[8], right[8], det[16];
+
+  std::size_t size0 = ScaleExpansion(2, qy, px[0], part0);
+  std::size_t size1 = ScaleExpansion(2, qy, px[1], part1);
+  std::size_t leftSize = ExpansionSum(size0, part0, size1, part1, left);
+
+  size0 = ScaleExpansion(2, qx, negativePy[0], part0);
+  size1 = ScaleExpansion(2, qx, negativePy[1], part1);
+  std::size_t rightSize = ExpansionSum(size0, part0, size1, part1, right);
+
+  std::size_t detSize = ExpansionSum(leftSize, left, rightSize, right, det);
+
+  // Старшая компонента расширения определяет его знак.
+  T top = det[detSize - 1];
+
+  return top > T(0) ? 1 : (top < T(0) ? -1 : 0);
+}
+
+/**
+ * @brief Вычислить знак векторного произведения адаптивно.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * @param p0 Начало первого вектора.
+ * @param p1 Конец первого вектора.
+ * @param q0 Начало второго вектора.
+ * @param q1 Конец второго вектора.
+ * @param statistics Счётчики вызовов (может быть nullptr).
+ * @return Функция возвращает знак \f$ (p_1 - p_0) \times (q_1 - q_0) \f$.
+ *
+ * Сначала произведение вычисляется в обычной арифметике и сравнивается со
+ * статической оценкой погрешности (фильтр Шевчука). Точная арифметика
+ * расширений используется только тогда, когда знак нельзя гарантировать.
+ * Для целочисленных типов произведение вычисляется напрямую.
+ */
+template<typename T>
+int CrossProductSign(const Point<T>& p0, const Point<T>& p1,
+                     const Point<T>& q0, const Point<T>& q1,
+                     OrientationStatistics* statistics = nullptr) {
+  if (statistics)
+    statistics->calls++;
+
+  T left = (p1.X() - p0.X()) * (q1.Y() - q0.Y());
+  T right = (p1.Y() - p0.Y()) * (q1.X() - q0.X());
+  T det = left - right;
+
+  if constexpr (!std::is_floating_point_v<T>) {
+    return det > T(0) ? 1 : (det < T(0) ? -1 : 0);
+  } else {
+    // Оценка погрешности из работы Шевчука: (3 + 16 eps) eps.
+    const T epsilon = std::numeric_limits<T>::epsilon() / T(2);
+    const T errorBound = (T(3) + T(16) * epsilon) * epsilon;
+    T sum;
+
+    if (left > T(0)) {
+      if (right <= T(0))
+        return 1;
+
+      sum = left + right;
+    } else if (left < T(0)) {
+      if (right >= T(0))
+        return -1;
+
+      sum = -left - right;
+    } else {
+      return right > T(0) ? -1 : (right < T(0) ? 1 : 0);
+    }
+
+    T bound = errorBound * sum;
+
+    if (det >= bound && det > T(0))
+      return 1;
+
+    if (-det >= bound && det < T(0))
+      return -1;
+
+    if (statistics)
+      statistics->exactCalls++;
+
+    return CrossProductSignExact(p0, p1, q0, q1);
+  }
+}
+
+/**
+ * @brief Вычислить ориентацию трёх точек точно.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * @param pt0 Первая точка.
+ * @param pt1 Вторая точка.
+ * @param pt2 Третья точка.
+ * @param statistics Счётчики вызовов (может быть nullptr).
+ * @return Ориентация точек.
+ *
+ * Функция возвращает 1, -1 или 0 аналогично функции Orientation(), но без
+ * использования абсолютной точности.
+ */
+template<typename T>
+int AdaptiveOrientation(const Point<T>& pt0,
+                        const Point<T>& pt1,
+                        const Point<T>& pt2,
+                        OrientationStatistics* statistics = nullptr) {
+  return CrossProductSign(pt0, pt1, pt0, pt2, statistics);
+}
+
+/**
+ * @brief Стратегия вычисления ориентации с абсолютной точностью.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Стратегия повторяет поведение функции Orientation(). Стратегии
+ * ориентации передаются в GrahamScan(), Edge::Intersect() и
+ * TriangulateMonotonePolygon().
+ */
+template<typename T>
+class ToleranceOrientationPolicy {
+ private:
+  //! Абсолютная точность вычислений.
+  T precision;
+
+ public:
+  /**
+   * @brief Создать стратегию.
+   *
+   * @param precision Абсолютная точность вычислений.
+   */
+  explicit ToleranceOrientationPolicy(T precision = T(0)) :
+    precision(precision)
+  { }
+
+  /**
+   * @brief Вычислить ориентацию трёх точек.
+   *
+   * @param pt0 Первая точка.
+   * @param pt1 Вторая точка.
+   * @param pt2 Третья точка.
+   * @return Ориентация точек.
+   */
+  int operator()(const Point<T>& pt0,
+                 const Point<T>& pt1,
+                 const Point<T>& pt2) const {
+    return Orientation(pt0, pt1, pt2, precision);
+  }
+
+  /**
+   * @brief Вычислить знак векторного произведения.
+   *
+   * @param p0 Начало первого вектора.
+   * @param p1 Конец первого вектора.
+   * @param q0 Начало второго вектора.
+   * @param q1 Конец второго вектора.
+   * @return Функция возвращает знак \f$ (p_1 - p_0) \times (q_1 - q_0) \f$.
+   */
+  int CrossSign(const Point<T>& p0, const Point<T>& p1,
+                const Point<T>& q0, const Point<T>& q1) const {
+    T sa = (p1.X() - p0.X()) * (q1.Y() - q0.Y()) -
+           (p1.Y() - p0.Y()) * (q1.X() - q0.X());
+
+    if (sa > precision)
+      return 1;
+    else if (sa < -precision)
+      return -1;
+
+    return 0;
+  }
+};
+
+/**
+ * @brief Стратегия точного адаптивного вычисления ориентации.
+ *
+ * Стратегия использует функцию CrossProductSign(). Если передан указатель
+ * на счётчики, то стратегия подсчитывает количество вызовов точной
+ * арифметики.
+ */
+class AdaptiveOrientationPolicy {
+ private:
+  //! Счётчики вызовов.
+  OrientationStatistics* statistics;
+
+ public:
+  /**
+   * @brief Создать стратегию.
+   *
+   * @param statistics Счётчики вызовов (может быть nullptr).
+   */
+  explicit AdaptiveOrientationPolicy(
+      OrientationStatistics* statistics = nullptr) :
+    statistics(statistics)
+  { }
+
+  /**
+   * @brief Вычислить ориентацию трёх точек.
+   *
+   * @tparam T Тип данных, используемый для арифметики.
+   *
+   * @param pt0 Первая точка.
+   * @param pt1 Вторая точка.
+   * @param pt2 Третья точка.
+   * @return Ориентация точек.
+   */
+  template<typename T>
+  int operator()(const Point<T>& pt0,
+                 const Point<T>& pt1,
+                 const Point<T>& pt2) const {
+    return AdaptiveOrientation(pt0, pt1, pt2, statistics);
+  }
+
+  /**
+   * @brief Вычислить знак векторного произведения.
+   *
+   * @tparam T Тип данных, используемый для арифметики.
+   *
+   * @param p0 Начало первого вектора.
+   * @param p1 Конец первого вектора.
+   * @param q0 Начало второго вектора.
+   * @param q1 Конец второго вектора.
+   * @return Функция возвращает знак \f$ (p_1 - p_0) \times (q_1 - q_0) \f$.
+   */
+  template<typename T>
+  int CrossSign(const Point<T>& p0, const Point<T>& p1,
+                const Point<T>& q0, const Point<T>& q1) const {
+    return CrossProductSign(p0, p1, q0, q1, statistics);
+  }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_PREDICATES_HPP_
@@ -0,0 +1,263 @@
+/**
+ * @file include/rotating_calipers.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Характеристики выпуклой оболочки методом вращающихся калиперов.
+ */
+
+#ifndef INCLUDE_ROTATING_CALIPERS_HPP_
+#define INCLUDE_ROTATING_CALIPERS_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Прямоугольник, описанный вокруг выпуклой оболочки.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Одна из сторон прямоугольника содержит ребро оболочки edge, т.е. ребро
+ * из вершины edge в следующую за ней.
+ */
+template<typename T>
+struct CaliperRectangle {
+  //! Вершины прямоугольника против часовой стрелки, начиная с вершины на
+  //! прямой ребра edge.
+  std::array<Point<T>, 4> corners;
+  //! Длина стороны, параллельной ребру edge.
+  T width = T(0);
+  //! Длина стороны, перпендикулярной ребру edge.
+  T height = T(0);
+  //! Номер вершины оболочки, из которой выходит ребро на стороне.
+  std::size_t edge = 0;
+
+  //! Получить площадь прямоугольника.
+  T Area() const { return width * height; }
+
+  //! Получить периметр прямоугольника.
+  T Perimeter() const { return T(2) * (width + height); }
+};
+
+/**
+ * @brief Характеристики выпуклой оболочки.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Все индексы --- номера вершин оболочки, переданной в RotatingCalipers().
+ */
+template<typename T>
+struct HullMetrics {
+  //! Диаметр, т.е. наибольшее расстояние между вершинами.
+  T diameter = T(0);
+  //! Вершины, на которых достигается диаметр.
+  std::pair<std::size_t, std::size_t> diameterPair = {0, 0};
+  //! Ширина, т.е. наименьшее расстояние между параллельными опорными
+  //! прямыми.
+  T width = T(0);
+  //! Ребро, на прямой которого достигается ширина.
+  std::size_t widthEdge = 0;
+  //! Вершина, наиболее удалённая от ребра widthEdge.
+  std::size_t widthVertex = 0;
+  //! Описанный прямоугольник наименьшей площади.
+  CaliperRectangle<T> minAreaRectangle;
+  //! Описанный прямоугольник наименьшего периметра.
+  CaliperRectangle<T> minPerimeterRectangle;
+  //! Все антиподальные пары вершин \f$ (i, j) \f$, \f$ i < j \f$, в
+  //! лексикографическом порядке.
+  std::vector<std::pair<std::size_t, std::size_t>> antipodalPairs;
+};
+
+/**
+ * @brief Вычислить характеристики выпуклой оболочки за \f$ O(h) \f$.
+ *
+ * @tparam T Тип данных с плавающей точкой.
+ * @param hull Вершины выпуклой оболочки против часовой стрелки без
+ * коллинеарных вершин, например, результат GrahamScan().
+ * @return Функция возвращает диаметр, ширину, описанные прямоугольники
+ * наименьшей площади и наименьшего периметра и антиподальные пары.
+ *
+ * Для каждого ребра оболочки поддерживаются три указателя: на вершины с
+ * наибольшей и наименьшей проекцией на направление ребра и на вершину,
+ * наиболее удалённую от ребра. При переходе к следующему ребру указатели
+ * только сдвигаются вперёд, поэтому все рёбра обрабатываются за
+ * \f$ O(h) \f$. Ширина и оба прямоугольника достигаются на положении, в
+ * котором одна из опорных прямых содержит ребро оболочки. Вершине i
+ * антиподальны вершины, через которые проходит указатель на наиболее
+ * удалённую вершину между рёбрами i - 1 и i; каждая пара записывается
+ * один раз и сразу в лексикографическом порядке, а диаметр достигается на
+ * первой из пар наибольшей длины.
+ *
+ * Для одной точки все величины равны 0, для двух точек ширина и площадь
+ * прямоугольника равны 0, а прямоугольник вырождается в отрезок.
+ */
+template<typename T>
+HullMetrics<T> RotatingCalipers(const std::vector<Point<T>>& hull) {
+  static_assert(std::is_floating_point_v<T>,
+                "RotatingCalipers: T must be a floating point type");
+
+  HullMetrics<T> metrics;
+  const std::size_t h = hull.size();
+
+  if (h == 0)
+    return metrics;
+
+  if (h == 1) {
+    metrics.minAreaRectangle.corners.fill(hull[0]);
+    metrics.minPerimeterRectangle = metrics.minAreaRectangle;
+    return metrics;
+  }
+
+  auto cross = [](const Point<T>& a, const Point<T>& b) {
+    return a.X() * b.Y() - a.Y() * b.X();
+  };
+  auto next = [h](std::size_t i) { return i + 1 == h ? 0 : i + 1; };
+
+  if (h == 2) {
+    CaliperRectangle<T>& rectangle = metrics.minAreaRectangle;
+
+    metrics.diameter = (hull[1] - hull[0]).Length();
+    metrics.diameterPair = {0, 1};
+    metrics.antipodalPairs.emplace_back(0, 1);
+    rectangle.corners = {hull[0], hull[1], hull[1], hull[0]};
+    rectangle.width = metrics.diameter;
+    metrics.minPerimeterRectangle = rectangle;
+
+    return metrics;
+  }
+
+  T bestArea = T(0);
+  T bestPerimeter = T(0);
+
+  // Вершины, антиподальные вершине 0, по возрастанию.
+  std::vector<std::size_t> zeroPairs;
+
+  // Каждая пара (a, b) встречается дважды: среди вершин, антиподальных
+  // a, и среди вершин, антиподальных b. Пара записывается со стороны
+  // меньшей вершины, а пары с вершиной 0 --- со стороны второй вершины,
+  // так как для вершины 0 антиподальные вершины не перебираются.
+  auto visit = [&](std::size_t a, std::size_t b) {
+    if (b == 0)
+      zeroPairs.push_back(a);
+    else if (a < b)
+      metrics.antipodalPairs.emplace_back(a, b);
+  };
+
+  // Указатели на вершины с наибольшей проекцией на ребро (right),
+  // наибольшим удалением от ребра (top) и наименьшей проекцией (left).
+  std::size_t right = 0;
+  std::size_t top = 0;
+  std::size_t left = 0;
+
+  for (std::size_t i = 0; i < h; i++) {
+    const Point<T>& origin = hull[i];
+    const Point<T> e = hull[next(i)] - origin;
+
+    if (i == 0) {
+      right = next(0);
+
+      while (e * (hull[next(right)] - hull[right]) > T(0))
+        right = next(right);
+
+      top = right;
+    }
+
+    const std::size_t previousTop = top;
+
+    while (cross(e, hull[next(top)] - hull[top]) > T(0))
+      top = next(top);
+
+    if (i == 0)
+      left = top;
+
+    while (e * (hull[next(right)] - hull[right]) > T(0))
+      right = next(right);
+
+    while (e * (hull[next(left)] - hull[left]) < T(0))
+      left = next(left);
+
+    // Пока опорная прямая поворачивается от ребра i - 1 к ребру i,
+    // вершине i антиподальны вершины от прежнего до нового положения top,
+    // а если ребро при top параллельно ребру i, то и следующая за ним.
+    if (i > 0) {
+      for (std::size_t j = previousTop; j != top; j = next(j))
+        visit(i, j);
+
+      visit(i, top);
+
+      if (cross(e, hull[next(top)] - hull[top]) == T(0))
+        visit(i, next(top));
+    }
+
+    const T length = e.Length();
+    const Point<T> u = (T(1) / length) * e;
+    const Point<T> n(-u.Y(), u.X());
+    const T minProjection = u * (hull[left] - origin);
+    const T maxProjection = u * (hull[right] - origin);
+    const T distance = n * (hull[top] - origin);
+
+    if (i == 0 || distance < metrics.width) {
+      metrics.width = distance;
+      metrics.widthEdge = i;
+      metrics.widthVertex = top;
+    }
+
+    CaliperRectangle<T> rectangle;
+
+    rectangle.width = maxProjection - minProjection;
+    rectangle.height = distance;
+    rectangle.edge = i;
+    rectangle.corners[0] = origin + minProjection * u;
+    rectangle.corners[1] = origin + maxProjection * u;
+    rectangle.corners[2] = rectangle.corners[1] + distance * n;
+    rectangle.corners[3] = rectangle.corners[0] + distance * n;
+
+    if (i == 0 || rectangle.Area() < bestArea) {
+      bestArea = rectangle.Area();
+      metrics.minAreaRectangle = rectangle;
+    }
+
+    if (i == 0 || rectangle.Perimeter() < bestPerimeter) {
+      bestPerimeter = rectangle.Perimeter();
+      metrics.minPerimeterRectangle = rectangle;
+    }
+  }
+
+  std::vector<std::pair<std::size_t, std::size_t>> pairs;
+
+  pairs.reserve(zeroPairs.size() + metrics.antipodalPairs.size());
+
+  for (std::size_t j : zeroPairs)
+    pairs.emplace_back(0, j);
+
+  pairs.insert(pairs.end(), metrics.antipodalPairs.begin(),
+               metrics.antipodalPairs.end());
+  metrics.antipodalPairs = std::move(pairs);
+
+  // Диаметр достигается на одной из антиподальных пар.
+  T bestDiameter = T(-1);
+
+  for (const auto& [a, b] : metrics.antipodalPairs) {
+    Point<T> d = hull[b] - hull[a];
+    T squared = d * d;
+
+    if (squared > bestDiameter) {
+      bestDiameter = squared;
+      metrics.diameterPair = {a, b};
+    }
+  }
+
+  metrics.diameter = std::sqrt(bestDiameter);
+
+  return metrics;
+}
+
+}  // namespace geometry
+
+#endif  // INCLUDE_ROTATING_CALIPERS_HPP_
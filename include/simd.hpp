@@ -0,0 +1,71 @@
+/**
+ * @file include/simd.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Определение набора векторных инструкций, доступных во время выполнения.
+ */
+
+#ifndef INCLUDE_SIMD_HPP_
+#define INCLUDE_SIMD_HPP_
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+//! Макрос определён, если компилятор позволяет собирать ядра AVX2/AVX-512.
+#define GEOMETRY_X86_SIMD 1
+#endif
+
+namespace geometry {
+
+/**
+ * Уровень векторных инструкций.
+ */
+enum class SimdLevel {
+  Scalar,
+  Avx2,
+  Avx512
+};
+
+/**
+ * @brief Определить максимальный уровень векторных инструкций процессора.
+ * @return Функция возвращает максимальный уровень, поддерживаемый
+ * процессором и операционной системой.
+ *
+ * Проверка выполняется один раз, результат запоминается.
+ */
+inline SimdLevel DetectSimdLevel() {
+#ifdef GEOMETRY_X86_SIMD
+  static const SimdLevel level = []() {
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+      return SimdLevel::Avx512;
+
+    if (__builtin_cpu_supports("avx2"))
+      return SimdLevel::Avx2;
+
+    return SimdLevel::Scalar;
+  }();
+
+  return level;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+/**
+ * @brief Ограничить уровень векторных инструкций возможностями процессора.
+ *
+ * @param level Запрошенный уровень.
+ * @return Функция возвращает запрошенный уровень, если он поддерживается,
+ * и максимальный поддерживаемый уровень в противном случае.
+ */
+inline SimdLevel ClampSimdLevel(SimdLevel level) {
+  SimdLevel supported = DetectSimdLevel();
+
+  return static_cast<int>(level) < static_cast<int>(supported) ?
+      level : supported;
+}
+
+}  // namespace geometry
+
+#endif  // INCLUDE_SIMD_HPP_
@@ -0,0 +1,258 @@
+/**
+ * @file include/sliding_window_convex_hull.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Выпуклая оболочка скользящего окна упорядоченных по времени точек.
+ */
+
+#ifndef INCLUDE_SLIDING_WINDOW_CONVEX_HULL_HPP_
+#define INCLUDE_SLIDING_WINDOW_CONVEX_HULL_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <dynamic_convex_hull.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Выпуклая оболочка последних точек потока.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @tparam OrientationPolicy Стратегия вычисления ориентации
+ * (см. predicates.hpp).
+ *
+ * Окно --- очередь точек, в конец которой точки добавляются, а из начала
+ * удаляются. Очередь хранится в виде двух стеков, у каждого из которых
+ * есть своя DynamicConvexHull:
+ *  - в задний стек попадают новые точки, его оболочка только растёт;
+ *  - из переднего стека удаляются старые точки. Когда он пуст, в него
+ *    переносится весь задний стек, начиная с самой новой точки, с
+ *    журналом добавлений. Тогда удаление самой старой точки --- отмена
+ *    последнего добавления (DynamicConvexHull::Undo()).
+ *
+ * Каждая точка добавляется в каждую оболочку и удаляется из неё не
+ * больше одного раза, поэтому добавление и удаление стоят
+ * \f$ O(\log n) \f$ амортизированно, где \f$ n \f$ --- размер окна.
+ * Оболочка окна --- оболочка вершин двух оболочек, она строится за
+ * \f$ O(h \log h) \f$.
+ *
+ * Размер окна ограничивается количеством точек, временем или обоими
+ * способами: Push() удаляет точки, вышедшие за границы окна.
+ */
+template<typename T, typename OrientationPolicy = AdaptiveOrientationPolicy>
+class SlidingWindowConvexHull {
+ private:
+  /**
+   * @brief Точка окна.
+   */
+  struct Entry {
+    //! Точка.
+    Point<T> point;
+    //! Время поступления.
+    double time;
+  };
+
+  //! Стратегия вычисления ориентации.
+  OrientationPolicy orientation;
+  //! Наибольшее количество точек в окне (0 --- не ограничено).
+  std::size_t capacity;
+  //! Длительность окна.
+  double duration;
+  //! Время поступления последней добавленной точки.
+  double latest = -std::numeric_limits<double>::infinity();
+  //! Передний стек: самая старая точка в конце.
+  std::vector<Entry> front;
+  //! Задний стек: самая новая точка в конце.
+  std::vector<Entry> back;
+  //! Оболочка переднего стека с журналом добавлений.
+  DynamicConvexHull<T, OrientationPolicy> frontHull;
+  //! Оболочка заднего стека.
+  DynamicConvexHull<T, OrientationPolicy> backHull;
+
+  /**
+   * @brief Перенести задний стек в передний.
+   */
+  void Transfer() {
+    frontHull.Clear();
+    frontHull.EnableUndo(true);
+
+    for (std::size_t i = back.size(); i > 0; i--) {
+      front.push_back(back[i - 1]);
+      frontHull.Insert(back[i - 1].point);
+    }
+
+    back.clear();
+    backHull.Clear();
+  }
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Создать пустое окно.
+   *
+   * @param capacity Наибольшее количество точек в окне (0 --- не
+   * ограничено).
+   * @param duration Длительность окна: точки, поступившие раньше, чем
+   * за duration до последней точки, удаляются (по-умолчанию не
+   * ограничена).
+   * @param orientation Стратегия вычисления ориентации.
+   */
+  explicit SlidingWindowConvexHull(
+      std::size_t capacity = 0,
+      double duration = std::numeric_limits<double>::infinity(),
+      const OrientationPolicy& orientation = OrientationPolicy()) :
+    orientation(orientation),
+    capacity(capacity),
+    duration(duration),
+    frontHull(orientation),
+    backHull(orientation)
+  { }
+
+  /**
+   * @brief Добавить точку в окно.
+   *
+   * @param point Точка.
+   * @param time Время поступления точки (не меньше времени предыдущих
+   * точек).
+   * @return Функция возвращает количество удалённых из окна точек.
+   *
+   * @throw std::invalid_argument если time меньше времени предыдущей
+   * точки или равно NaN: самая старая точка окна должна оставаться в его
+   * начале.
+   */
+  std::size_t Push(const Point<T>& point, double time = 0.0) {
+    if (!(time >= latest))
+      throw std::invalid_argument(
+          "SlidingWindowConvexHull: time must not decrease");
+
+    latest = time;
+    back.push_back(Entry{point, time});
+    backHull.Insert(point);
+
+    std::size_t expired = ExpireBefore(time - duration);
+
+    for (; capacity != 0 && Size() > capacity; expired++)
+      Pop();
+
+    return expired;
+  }
+
+  /**
+   * @brief Удалить из окна самую старую точку.
+   *
+   * @throw std::logic_error если окно пусто.
+   */
+  void Pop() {
+    if (Empty())
+      throw std::logic_error("SlidingWindowConvexHull: the window is empty");
+
+    if (front.empty())
+      Transfer();
+
+    front.pop_back();
+    frontHull.Undo();
+  }
+
+  /**
+   * @brief Удалить точки, поступившие раньше заданного времени.
+   *
+   * @param time Время.
+   * @return Функция возвращает количество удалённых точек.
+   */
+  std::size_t ExpireBefore(double time) {
+    std::size_t expired = 0;
+
+    for (; !Empty() && OldestTime() < time; expired++)
+      Pop();
+
+    return expired;
+  }
+
+  /**
+   * @brief Получить самую старую точку окна.
+   * @return Функция возвращает самую старую точку окна.
+   */
+  const Point<T>& Oldest() const {
+    return front.empty() ? back.front().point : front.back().point;
+  }
+
+  /**
+   * @brief Получить время поступления самой старой точки окна.
+   * @return Функция возвращает время поступления самой старой точки.
+   */
+  double OldestTime() const {
+    return front.empty() ? back.front().time : front.back().time;
+  }
+
+  /**
+   * @brief Получить время поступления последней добавленной точки.
+   * @return Функция возвращает время последней точки (минус
+   * бесконечность, если точки не добавлялись).
+   */
+  double LatestTime() const { return latest; }
+
+  /**
+   * @brief Получить вершины оболочки окна.
+   *
+   * @return Функция возвращает вершины оболочки точек окна в том же
+   * порядке, что и GrahamScan().
+   */
+  std::vector<Point<T>> Hull() const {
+    std::vector<Point<T>> hull = frontHull.Hull();
+
+    if (backHull.Empty())
+      return hull;
+
+    if (hull.empty())
+      return backHull.Hull();
+
+    std::vector<Point<T>> backVertices = backHull.Hull();
+
+    hull.insert(hull.end(), backVertices.begin(), backVertices.end());
+    hull = GrahamScan(std::move(hull), orientation);
+
+    // Как и в DynamicConvexHull, совпадающие точки дают одну вершину.
+    if (hull.size() == 2 && hull[0].X() == hull[1].X() &&
+        hull[0].Y() == hull[1].Y())
+      hull.pop_back();
+
+    return hull;
+  }
+
+  /**
+   * @brief Получить количество точек в окне.
+   * @return Функция возвращает количество точек в окне.
+   */
+  std::size_t Size() const { return front.size() + back.size(); }
+
+  /**
+   * @brief Проверить, что окно пусто.
+   * @return Функция возвращает true, если в окне нет точек.
+   */
+  bool Empty() const { return front.empty() && back.empty(); }
+
+  /**
+   * @brief Получить наибольшее количество точек в окне.
+   * @return Функция возвращает наибольшее количество точек (0 --- не
+   * ограничено).
+   */
+  std::size_t Capacity() const { return capacity; }
+
+  /**
+   * @brief Получить длительность окна.
+   * @return Функция возвращает длительность окна.
+   */
+  double Duration() const { return duration; }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_SLIDING_WINDOW_CONVEX_HULL_HPP_
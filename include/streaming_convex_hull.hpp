@@ -0,0 +1,160 @@
+/**
+ * @file include/streaming_convex_hull.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Выпуклая оболочка потока точек с ограниченным объёмом памяти.
+ */
+
+#ifndef INCLUDE_STREAMING_CONVEX_HULL_HPP_
+#define INCLUDE_STREAMING_CONVEX_HULL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+
+namespace geometry {
+
+/**
+ * @brief Выпуклая оболочка потока точек.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @tparam OrientationPolicy Стратегия вычисления ориентации
+ * (см. predicates.hpp).
+ *
+ * Точки накапливаются в буфере после вершин текущей оболочки. Когда в
+ * буфере набирается chunkSize новых точек, функция GrahamScan() строит
+ * оболочку вершин и буфера, и она становится текущей. Поэтому в памяти
+ * одновременно находится не больше \f$ h + chunkSize \f$ точек, где
+ * \f$ h \f$ --- размер оболочки, а время обработки \f$ n \f$ точек равно
+ * \f$ O(n \log(h + chunkSize)) \f$.
+ *
+ * Оболочка оболочки и новых точек совпадает с оболочкой всех точек только
+ * при точном вычислении ориентации, поэтому по-умолчанию используется
+ * AdaptiveOrientationPolicy.
+ */
+template<typename T, typename OrientationPolicy = AdaptiveOrientationPolicy>
+class StreamingConvexHull {
+ private:
+  //! Стратегия вычисления ориентации.
+  OrientationPolicy orientation;
+  //! Параметры GrahamScan().
+  GrahamScanOptions options;
+  //! Количество новых точек, после которого строится оболочка.
+  std::size_t chunkSize;
+  //! Вершины текущей оболочки, за которыми следуют новые точки.
+  std::vector<Point<T>> points;
+  //! Количество вершин текущей оболочки в начале буфера.
+  std::size_t hullSize = 0;
+  //! Количество добавленных точек.
+  std::size_t numPoints = 0;
+  //! Наибольший размер буфера.
+  std::size_t peakPoints = 0;
+
+  /**
+   * @brief Построить оболочку вершин и новых точек.
+   */
+  void Merge() {
+    if (points.size() == hullSize)
+      return;
+
+    points = GrahamScan(std::move(points), options, orientation);
+    hullSize = points.size();
+  }
+
+ public:
+  //! Тип данных, используемый для арифметики.
+  using ValueType = T;
+
+  /**
+   * @brief Создать пустую оболочку.
+   *
+   * @param chunkSize Количество новых точек, после которого строится
+   * оболочка.
+   * @param options Параметры GrahamScan() (например, способ сортировки).
+   * @param orientation Стратегия вычисления ориентации.
+   *
+   * @throw std::invalid_argument если chunkSize равен 0.
+   */
+  explicit StreamingConvexHull(
+      std::size_t chunkSize = 1 << 16,
+      const GrahamScanOptions& options = GrahamScanOptions(),
+      const OrientationPolicy& orientation = OrientationPolicy()) :
+    orientation(orientation),
+    options(options),
+    chunkSize(chunkSize) {
+    if (chunkSize == 0)
+      throw std::invalid_argument("StreamingConvexHull: chunkSize is 0");
+  }
+
+  /**
+   * @brief Добавить точку.
+   *
+   * @param point Точка.
+   */
+  void Insert(const Point<T>& point) {
+    if (points.size() - hullSize == chunkSize) {
+      Merge();
+      points.reserve(hullSize + chunkSize);
+    }
+
+    points.push_back(point);
+    numPoints++;
+    peakPoints = std::max(peakPoints, points.size());
+  }
+
+  /**
+   * @brief Добавить точки.
+   *
+   * @tparam InputIt Тип итератора на Point<T>.
+   * @param first Начало последовательности точек.
+   * @param last Конец последовательности точек.
+   */
+  template<typename InputIt>
+  void Insert(InputIt first, InputIt last) {
+    for (; first != last; ++first)
+      Insert(*first);
+  }
+
+  /**
+   * @brief Получить оболочку всех добавленных точек.
+   *
+   * @return Функция возвращает вершины оболочки в том же порядке, что и
+   * GrahamScan().
+   *
+   * Новые точки, если они есть, сначала объединяются с оболочкой.
+   */
+  const std::vector<Point<T>>& Hull() {
+    Merge();
+
+    return points;
+  }
+
+  /**
+   * @brief Получить количество добавленных точек.
+   * @return Функция возвращает количество добавленных точек.
+   */
+  std::size_t NumPoints() const { return numPoints; }
+
+  /**
+   * @brief Получить наибольшее количество точек в памяти.
+   * @return Функция возвращает наибольший размер буфера, не больше
+   * \f$ h + chunkSize \f$.
+   */
+  std::size_t PeakPoints() const { return peakPoints; }
+
+  /**
+   * @brief Получить размер порции.
+   * @return Функция возвращает количество новых точек, после которого
+   * строится оболочка.
+   */
+  std::size_t ChunkSize() const { return chunkSize; }
+};
+
+}  // namespace geometry
+
+#endif  // INCLUDE_STREAMING_CONVEX_HULL_HPP_
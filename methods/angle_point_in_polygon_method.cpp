@@ -6,10 +6,13 @@
  */
 
 #include <vector>
-#include <list>
 #include <string>
+#include <utility>
 #include <nlohmann/json.hpp>
 #include "../include/angle_point_in_polygon.hpp"
+#include "../include/cyclic_vector.hpp"
+#include "../include/point_in_polygon.hpp"
+#include "../include/polygon_grid.hpp"
 
 /**
  * @brief Method for angle-based point-in-polygon algorithm implementation.
@@ -44,7 +47,7 @@ int AnglePointInPolygonMethod(const nlohmann::json& input, \
             input["point"]["x"].get<double>(),
             input["point"]["y"].get<double>());
         // Parse polygon
-        std::list<Point<double>> polygon_points;
+        CyclicVector<Point<double>> polygon_points;
         for (const auto& point_json : input["polygon"]) {
             if (!point_json.is_object() ||
                 !point_json.contains("x") || !point_json["x"].is_number() ||
@@ -56,9 +59,35 @@ int AnglePointInPolygonMethod(const nlohmann::json& input, \
                 point_json["x"].get<double>(), \
                 point_json["y"].get<double>());
         }
-        Polygon<double> polygon(polygon_points);
+        // Select the algorithm: automatic choice (default), angle
+        // summation, winding number or uniform grid
+        std::string method = "auto";
+        if (input.contains("method")) {
+            if (input["method"] != "angle" && input["method"] != "winding" &&
+                input["method"] != "grid" && input["method"] != "auto") {
+                (*output)["error"] =
+                    "'method' must be 'angle', 'winding', 'grid' or 'auto'";
+                return 6;
+            }
+            method = input["method"].get<std::string>();
+        }
+        Polygon<double, CyclicVector<Point<double>>> polygon(
+            std::move(polygon_points));
         // Run algorithm with default precision
-        auto position = AnglePointInPolygon(point, polygon, 1e-9);
+        PointPosition position;
+        if (method == "auto") {
+            PreparedPolygon<double> prepared(polygon, 1e-9);
+            position = prepared.Classify(point);
+            (*output)["path"] = prepared.IsConvex() ? "convex" : "winding";
+        } else if (method == "grid") {
+            PolygonGrid<double> grid(polygon, 1e-9);
+            position = grid.Classify(point);
+            (*output)["memory"] = grid.MemoryUsage();
+        } else if (method == "winding") {
+            position = WindingNumberPointInPolygon(point, polygon, 1e-9);
+        } else {
+            position = AnglePointInPolygon(point, polygon, 1e-9);
+        }
         // Prepare output
         switch (position) {
             case PointPosition::INSIDE:
@@ -76,6 +105,7 @@ int AnglePointInPolygonMethod(const nlohmann::json& input, \
             {"y", point.Y()}
         };
         (*output)["polygon_size"] = polygon.Size();
+        (*output)["method"] = method;
         return 0;
     } catch (const std::exception& e) {
         (*output)["error"] = std::string("Exception: ") + e.what();
@@ -83,3 +113,42 @@ int AnglePointInPolygonMethod(const nlohmann::json& input, \
     }
 }
 }  // namespace geometry
+
+/**
+ * Input JSON structure:
+ * {
+ *   "point" : {"x": 0.5, "y": 0.5},
+ *   "polygon" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 1.0, "y": 0.0},
+ *     {"x": 1.0, "y": 1.0},
+ *     {"x": 0.0, "y": 1.0}
+ *   ],
+ *   "method" : "auto"
+ * }
+ *
+ * The optional "method" field selects the algorithm: "auto" (default),
+ * "angle" (sum of polar angle differences, two atan calls per edge),
+ * "winding" (winding number, one cross product per edge near the
+ * horizontal line of the point) or "grid" (uniform grid over the bounding
+ * box, only the edges crossing the cell of the point are tested). All of
+ * them return the same position for points off the boundary. With "grid"
+ * the output also has "memory", the size of the grid in bytes.
+ *
+ * "auto" checks whether the polygon is strictly convex. Convex polygons are
+ * tested by binary search over the fan of the first vertex in O(log n),
+ * the others with the winding number. The output then has "path":
+ * "convex" or "winding". Both paths give the same result as "angle" off
+ * the boundary, so requests without "method" only get faster.
+ *
+ * Output JSON structure:
+ * {
+ *   "position" : "inside",
+ *   "point" : {"x": 0.5, "y": 0.5},
+ *   "polygon_size" : 4,
+ *   "method" : "auto",
+ *   "path" : "convex"
+ * }
+ *
+ * "position" is "inside", "outside" or "boundary".
+ */
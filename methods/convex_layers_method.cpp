@@ -0,0 +1,137 @@
+/**
+ * @file methods/convex_layers_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Convex layers (onion peeling) method.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/convex_layers.hpp"
+
+namespace geometry {
+
+int ConvexLayersMethod(const nlohmann::json& input, nlohmann::json* output) {
+  try {
+    if (!input.contains("points") || !input["points"].is_array()) {
+      (*output)["error"] = "Input must contain 'points' array";
+      return 1;
+    }
+
+    std::vector<Point<double>> points;
+
+    for (const auto& point_json : input["points"]) {
+      if (!point_json.is_object() ||
+          !point_json.contains("x") || !point_json["x"].is_number() ||
+          !point_json.contains("y") || !point_json["y"].is_number()) {
+        (*output)["error"] = "Each point must have 'x' and 'y' numeric fields";
+        return 2;
+      }
+
+      points.emplace_back(point_json["x"].get<double>(),
+                          point_json["y"].get<double>());
+    }
+
+    std::string predicate = "exact";
+
+    if (input.contains("predicate")) {
+      if (input["predicate"] != "tolerance" && input["predicate"] != "exact") {
+        (*output)["error"] = "'predicate' must be 'tolerance' or 'exact'";
+        return 3;
+      }
+
+      predicate = input["predicate"].get<std::string>();
+    }
+
+    bool with_contours = false;
+
+    if (input.contains("contours")) {
+      if (!input["contours"].is_boolean()) {
+        (*output)["error"] = "'contours' must be a boolean";
+        return 4;
+      }
+
+      with_contours = input["contours"].get<bool>();
+    }
+
+    std::vector<std::vector<size_t>> contours;
+    std::vector<size_t> layers;
+
+    if (predicate == "exact") {
+      layers = ConvexLayers(points, AdaptiveOrientationPolicy(),
+                            with_contours ? &contours : nullptr);
+    } else {
+      layers = ConvexLayers(points, ToleranceOrientationPolicy<double>(),
+                            with_contours ? &contours : nullptr);
+    }
+
+    size_t num_layers = 0;
+
+    for (size_t layer : layers)
+      num_layers = std::max(num_layers, layer + 1);
+
+    (*output)["layers"] = layers;
+    (*output)["num_layers"] = num_layers;
+
+    if (with_contours) {
+      nlohmann::json contours_json = nlohmann::json::array();
+
+      for (const auto& contour : contours) {
+        nlohmann::json contour_json = nlohmann::json::array();
+
+        for (size_t index : contour)
+          contour_json.push_back({{"x", points[index].X()},
+                                  {"y", points[index].Y()}});
+
+        contours_json.push_back(contour_json);
+      }
+
+      (*output)["contours"] = contours_json;
+    }
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+}  // namespace geometry
+
+/**
+ * Input JSON structure:
+ * {
+ *   "points" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 4.0, "y": 0.0},
+ *     {"x": 2.0, "y": 4.0},
+ *     {"x": 2.0, "y": 1.0}
+ *   ],
+ *   "predicate" : "exact",
+ *   "contours" : true
+ * }
+ *
+ * All points are split into convex layers in one call: layer 0 is the
+ * boundary of the convex hull (including points on its edges), layer 1 is
+ * the boundary of the hull of the remaining points and so on. The points
+ * are sorted once and every layer costs one linear pass.
+ *
+ * The optional "predicate" field is "exact" (default) or "tolerance".
+ * If "contours" is true, the output also contains the hull vertices of
+ * every layer in the same order as /GrahamScan returns them.
+ *
+ * Output JSON structure:
+ * {
+ *   "layers" : [0, 0, 0, 1],
+ *   "num_layers" : 2,
+ *   "contours" : [
+ *     [{"x": 0.0, "y": 0.0}, {"x": 4.0, "y": 0.0}, {"x": 2.0, "y": 4.0}],
+ *     [{"x": 2.0, "y": 1.0}]
+ *   ]
+ * }
+ *
+ * "layers" contains the layer index of every input point in input order.
+ */
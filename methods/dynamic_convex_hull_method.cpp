@@ -0,0 +1,290 @@
+/**
+ * @file methods/dynamic_convex_hull_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Server sessions for the dynamic convex hull.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/dynamic_convex_hull.hpp"
+#include "session_registry.hpp"
+
+namespace geometry {
+
+/**
+ * @brief Open sessions of the dynamic convex hull methods.
+ */
+static SessionRegistry<DynamicConvexHull<double>> hullSessions;
+
+/**
+ * @brief Parse the optional "points" array.
+ *
+ * @param input input data in JSON format
+ * @param points pointer to the parsed points
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParsePoints(const nlohmann::json& input,
+                       std::vector<Point<double>>* points,
+                       nlohmann::json* output) {
+  if (!input.contains("points"))
+    return 0;
+
+  if (!input["points"].is_array()) {
+    (*output)["error"] = "'points' must be an array";
+    return 1;
+  }
+
+  for (const auto& point_json : input["points"]) {
+    if (!point_json.is_object() ||
+        !point_json.contains("x") || !point_json["x"].is_number() ||
+        !point_json.contains("y") || !point_json["y"].is_number()) {
+      (*output)["error"] = "Each point must have 'x' and 'y' numeric fields";
+      return 2;
+    }
+
+    points->emplace_back(point_json["x"].get<double>(),
+                         point_json["y"].get<double>());
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Parse the session identifier.
+ *
+ * @param input input data in JSON format
+ * @param id pointer to the identifier
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParseId(const nlohmann::json& input, uint64_t* id,
+                   nlohmann::json* output) {
+  if (!input.contains("id") || !input["id"].is_number_unsigned()) {
+    (*output)["error"] = "Input must contain non-negative integer 'id'";
+    return 3;
+  }
+
+  *id = input["id"].get<uint64_t>();
+
+  return 0;
+}
+
+/**
+ * @brief Write the hull summary to the output.
+ *
+ * @param id session identifier
+ * @param hull dynamic convex hull
+ * @param output pointer to JSON output
+ */
+static void WriteSummary(uint64_t id, const DynamicConvexHull<double>& hull,
+                         nlohmann::json* output) {
+  (*output)["id"] = id;
+  (*output)["hull_size"] = hull.Size();
+  (*output)["num_points"] = hull.NumPoints();
+}
+
+int DynamicConvexHullCreateMethod(const nlohmann::json& input,
+                                  nlohmann::json* output) {
+  try {
+    std::vector<Point<double>> points;
+
+    if (int result = ParsePoints(input, &points, output))
+      return result;
+
+    DynamicConvexHull<double> hull;
+
+    hull.Insert(points.begin(), points.end());
+
+    uint64_t id;
+
+    if (!hullSessions.Create(hull, &id)) {
+      (*output)["error"] = "Too many open sessions";
+      return 5;
+    }
+
+    WriteSummary(id, hull, output);
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int DynamicConvexHullInsertMethod(const nlohmann::json& input,
+                                  nlohmann::json* output) {
+  try {
+    uint64_t id;
+    std::vector<Point<double>> points;
+
+    if (int result = ParseId(input, &id, output))
+      return result;
+
+    if (int result = ParsePoints(input, &points, output))
+      return result;
+
+    bool found = hullSessions.Access(id, [&](DynamicConvexHull<double>& hull) {
+      (*output)["changed"] = hull.Insert(points.begin(), points.end());
+
+      WriteSummary(id, hull, output);
+    });
+
+    if (!found) {
+      (*output)["error"] = "Unknown session 'id'";
+      return 4;
+    }
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int DynamicConvexHullHullMethod(const nlohmann::json& input,
+                                nlohmann::json* output) {
+  try {
+    uint64_t id;
+
+    if (int result = ParseId(input, &id, output))
+      return result;
+
+    std::vector<Point<double>> convex_hull;
+
+    bool found = hullSessions.Access(id, [&](DynamicConvexHull<double>& hull) {
+      convex_hull = hull.Hull();
+
+      WriteSummary(id, hull, output);
+    });
+
+    if (!found) {
+      (*output)["error"] = "Unknown session 'id'";
+      return 4;
+    }
+
+    nlohmann::json hull_json = nlohmann::json::array();
+
+    for (const auto& point : convex_hull)
+      hull_json.push_back({{"x", point.X()}, {"y", point.Y()}});
+
+    (*output)["convex_hull"] = hull_json;
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int DynamicConvexHullContainsMethod(const nlohmann::json& input,
+                                    nlohmann::json* output) {
+  try {
+    uint64_t id;
+    std::vector<Point<double>> points;
+
+    if (int result = ParseId(input, &id, output))
+      return result;
+
+    if (int result = ParsePoints(input, &points, output))
+      return result;
+
+    std::vector<bool> contains;
+
+    bool found = hullSessions.Access(id, [&](DynamicConvexHull<double>& hull) {
+      for (const auto& point : points)
+        contains.push_back(hull.Contains(point));
+
+      WriteSummary(id, hull, output);
+    });
+
+    if (!found) {
+      (*output)["error"] = "Unknown session 'id'";
+      return 4;
+    }
+
+    (*output)["contains"] = contains;
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int DynamicConvexHullDeleteMethod(const nlohmann::json& input,
+                                  nlohmann::json* output) {
+  uint64_t id;
+
+  if (int result = ParseId(input, &id, output))
+    return result;
+
+  if (!hullSessions.Remove(id)) {
+    (*output)["error"] = "Unknown session 'id'";
+    return 4;
+  }
+
+  (*output)["id"] = id;
+
+  return 0;
+}
+
+}  // namespace geometry
+
+/**
+ * The dynamic convex hull keeps its points on the server between requests.
+ * Every method takes a JSON object and returns a JSON object; on error the
+ * status is 400 and the output contains "error".
+ *
+ * /DynamicConvexHull/Create opens a session. Input (all fields optional):
+ * {
+ *   "points" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 2.0, "y": 0.0}
+ *   ]
+ * }
+ * Output:
+ * {
+ *   "id" : 1,
+ *   "hull_size" : 2,
+ *   "num_points" : 2
+ * }
+ *
+ * /DynamicConvexHull/Insert appends points to session "id" in
+ * O(log n) amortized time per point. Input:
+ * {
+ *   "id" : 1,
+ *   "points" : [
+ *     {"x": 1.0, "y": 1.0}
+ *   ]
+ * }
+ * Output: the same as for Create plus "changed", the number of points
+ * that became hull vertices.
+ *
+ * /DynamicConvexHull/Hull returns the current hull of session "id"
+ * counterclockwise from the lexicographically smallest vertex, the same
+ * as /GrahamScan with "predicate": "exact". Input: {"id" : 1}. Output:
+ * {
+ *   "id" : 1,
+ *   "convex_hull" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 2.0, "y": 0.0},
+ *     {"x": 1.0, "y": 1.0}
+ *   ],
+ *   "hull_size" : 3,
+ *   "num_points" : 3
+ * }
+ *
+ * /DynamicConvexHull/Contains tests "points" against the current hull
+ * without changing it. Output contains "contains", an array of booleans
+ * (true if the point is inside the hull or on its boundary).
+ *
+ * /DynamicConvexHull/Delete closes session "id". Input: {"id" : 1}.
+ *
+ * Return codes: 1 - 'points' is not an array, 2 - a point without numeric
+ * 'x' and 'y', 3 - no 'id', 4 - unknown session, 5 - too many open
+ * sessions.
+ */
@@ -5,8 +5,11 @@
  * @brief Graham scan convex hull algorithm implementation.
  */
 
+#include <cstdint>
+#include <map>
 #include <vector>
 #include <string>
+#include <utility>
 #include <nlohmann/json.hpp>
 #include "../include/graham_scan.hpp"
 
@@ -46,7 +49,248 @@ namespace geometry {
           point_json["y"].get<double>());
       }
 
-      auto convex_hull = geometry::GrahamScan(points);
+      std::string predicate = "tolerance";
+
+      if (input.contains("predicate")) {
+        if (!input["predicate"].is_string() ||
+            (input["predicate"] != "tolerance" &&
+             input["predicate"] != "exact")) {
+          (*output)["error"] = "'predicate' must be 'tolerance' or 'exact'";
+          return 3;
+        }
+
+        predicate = input["predicate"].get<std::string>();
+      }
+
+      size_t threads = 1;
+
+      if (input.contains("threads")) {
+        if (!input["threads"].is_number_unsigned()) {
+          (*output)["error"] = "'threads' must be a non-negative integer";
+          return 4;
+        }
+
+        threads = input["threads"].get<size_t>();
+      }
+
+      geometry::GrahamScanOptions options;
+
+      if (input.contains("prefilter")) {
+        if (!input["prefilter"].is_boolean()) {
+          (*output)["error"] = "'prefilter' must be a boolean";
+          return 5;
+        }
+
+        options.prefilter = input["prefilter"].get<bool>();
+      }
+
+      if (input.contains("sort")) {
+        if (!input["sort"].is_string() ||
+            (input["sort"] != "comparison" && input["sort"] != "radix")) {
+          (*output)["error"] = "'sort' must be 'comparison' or 'radix'";
+          return 9;
+        }
+
+        if (input["sort"] == "radix")
+          options.sort = geometry::PointSort::Radix;
+      }
+
+      geometry::HullAlgorithm algorithm = geometry::HullAlgorithm::Graham;
+
+      if (input.contains("algorithm")) {
+        const std::map<std::string, geometry::HullAlgorithm> algorithms = {
+          {"auto", geometry::HullAlgorithm::Auto},
+          {"graham", geometry::HullAlgorithm::Graham},
+          {"chan", geometry::HullAlgorithm::Chan},
+          {"quickhull", geometry::HullAlgorithm::Quickhull}
+        };
+
+        if (!input["algorithm"].is_string() ||
+            !algorithms.count(input["algorithm"].get<std::string>())) {
+          (*output)["error"] =
+              "'algorithm' must be 'auto', 'graham', 'chan' or 'quickhull'";
+          return 6;
+        }
+
+        algorithm = algorithms.at(input["algorithm"].get<std::string>());
+      }
+
+      std::string output_format = "points";
+
+      if (input.contains("output")) {
+        if (!input["output"].is_string() ||
+            (input["output"] != "points" && input["output"] != "indices")) {
+          (*output)["error"] = "'output' must be 'points' or 'indices'";
+          return 7;
+        }
+
+        output_format = input["output"].get<std::string>();
+      }
+
+      // Approximate mode is enabled by the number of strips or by the
+      // relative error; 0 strips means the exact hull.
+      const size_t max_strips = size_t(1) << 20;
+      size_t strips = 0;
+
+      if (input.contains("epsilon") && input.contains("strips")) {
+        (*output)["error"] = "Only one of 'epsilon' and 'strips' may be given";
+        return 10;
+      }
+
+      if (input.contains("epsilon")) {
+        if (!input["epsilon"].is_number() ||
+            !(input["epsilon"].get<double>() > 0.0 &&
+              input["epsilon"].get<double>() <= 1.0)) {
+          (*output)["error"] = "'epsilon' must be a number in (0, 1]";
+          return 10;
+        }
+
+        // Checked before the conversion: 1 / epsilon may not even fit
+        // into size_t.
+        if (input["epsilon"].get<double>() < 1.0 / max_strips) {
+          (*output)["error"] = "Too many strips, 'epsilon' is too small";
+          return 10;
+        }
+
+        strips = geometry::ApproximateHullStrips(
+            input["epsilon"].get<double>());
+      }
+
+      if (input.contains("strips")) {
+        if (!input["strips"].is_number_unsigned() ||
+            input["strips"].get<size_t>() == 0) {
+          (*output)["error"] = "'strips' must be a positive integer";
+          return 10;
+        }
+
+        strips = input["strips"].get<size_t>();
+      }
+
+      if (strips > max_strips) {
+        (*output)["error"] = "Too many strips, 'epsilon' is too small";
+        return 10;
+      }
+
+      if (output_format == "indices" &&
+          (algorithm != geometry::HullAlgorithm::Graham || threads != 1 ||
+           options.prefilter || strips != 0)) {
+        (*output)["error"] = "'output': 'indices' is supported only by the "
+                             "single-threaded exact graham algorithm "
+                             "without prefilter";
+        return 8;
+      }
+
+      // The prefilter runs in compute(), the scan only needs the sorting
+      // method.
+      geometry::GrahamScanOptions sort_options;
+      sort_options.sort = options.sort;
+
+      std::vector<geometry::Point<double>> convex_hull;
+      geometry::GrahamScanStatistics scan_statistics;
+
+      // Only the Graham scan has a parallel version, so the automatic
+      // choice is made first.
+      auto compute = [&](const auto& orientation) {
+        std::vector<geometry::Point<double>> survivors = points;
+
+        if (options.prefilter) {
+          scan_statistics.eliminated =
+              geometry::AklToussaintFilter(&survivors);
+        }
+
+        size_t hull_size_estimate = 0;
+
+        if (algorithm == geometry::HullAlgorithm::Auto) {
+          algorithm = geometry::SelectHullAlgorithm(survivors, orientation,
+                                                    &hull_size_estimate);
+        }
+
+        scan_statistics.algorithm = algorithm;
+
+        switch (algorithm) {
+        case geometry::HullAlgorithm::Chan:
+          return geometry::ChanHull(std::move(survivors), orientation,
+                                    hull_size_estimate);
+        case geometry::HullAlgorithm::Quickhull:
+          return geometry::Quickhull(std::move(survivors), orientation);
+        default:
+          if (threads != 1) {
+            return geometry::ParallelGrahamScan(std::move(survivors),
+                                                threads, sort_options,
+                                                orientation);
+          }
+
+          return geometry::GrahamScan(std::move(survivors), sort_options,
+                                      orientation);
+        }
+      };
+
+      std::vector<uint32_t> hull_indices;
+      double error_bound = 0.0;
+
+      // The index version sorts a permutation of the input and does not
+      // copy the points.
+      auto run = [&](const auto& orientation) {
+        if (strips != 0) {
+          convex_hull = geometry::ApproximateConvexHull(points, strips,
+                                                        orientation,
+                                                        &error_bound);
+        } else if (output_format == "indices") {
+          hull_indices = geometry::GrahamScanIndices(points.begin(),
+                                                     points.end(),
+                                                     orientation);
+        } else {
+          convex_hull = compute(orientation);
+        }
+      };
+
+      bool parallel = threads != 1 &&
+          (algorithm == geometry::HullAlgorithm::Graham ||
+           algorithm == geometry::HullAlgorithm::Auto);
+
+      // The sub-hulls of the parallel scan evaluate the predicate on
+      // different triples, so only the exact one gives the same hull for
+      // any number of threads.
+      if (parallel)
+        predicate = "exact";
+
+      if (predicate == "exact" && !parallel) {
+        geometry::OrientationStatistics statistics;
+
+        run(geometry::AdaptiveOrientationPolicy(&statistics));
+
+        (*output)["predicate_statistics"] = {
+          {"calls", statistics.calls},
+          {"exact_calls", statistics.exactCalls}
+        };
+      } else if (predicate == "exact") {
+        run(geometry::AdaptiveOrientationPolicy());
+      } else {
+        run(geometry::ToleranceOrientationPolicy<double>());
+      }
+
+      const char* algorithm_names[] = {"auto", "graham", "chan", "quickhull"};
+
+      if (strips != 0) {
+        (*output)["algorithm"] = "approximate";
+        (*output)["strips"] = strips;
+        (*output)["error_bound"] = error_bound;
+      } else {
+        (*output)["algorithm"] =
+            algorithm_names[static_cast<int>(scan_statistics.algorithm)];
+      }
+
+      if (options.prefilter && strips == 0)
+        (*output)["eliminated"] = scan_statistics.eliminated;
+
+      (*output)["original_size"] = points.size();
+
+      if (output_format == "indices") {
+        (*output)["hull_indices"] = hull_indices;
+        (*output)["hull_size"] = hull_indices.size();
+
+        return 0;
+      }
 
       nlohmann::json hull_json = nlohmann::json::array();
       for (const auto& point : convex_hull) {
@@ -58,7 +302,6 @@ namespace geometry {
 
       (*output)["convex_hull"] = hull_json;
       (*output)["hull_size"] = convex_hull.size();
-      (*output)["original_size"] = points.size();
 
       return 0;
     } catch (const std::exception& e) {
@@ -76,9 +319,63 @@ namespace geometry {
   *      {"x": 0.0, "y": 0.0},
   *      {"x": 1.0, "y": 1.0},
   *      {"x": 2.0, "y": 0.0}
-  *   ]
+  *   ],
+  *   "predicate" : "exact",
+  *   "threads" : 1,
+  *   "prefilter" : true,
+  *   "algorithm" : "auto",
+  *   "output" : "points",
+  *   "sort" : "radix",
+  *   "epsilon" : 0.001
   * }
   *
+  * The optional "predicate" field selects the orientation predicate:
+  * "tolerance" (default, plain floating-point sign) or "exact" (adaptive
+  * exact predicate). With "exact" the output also contains
+  * "predicate_statistics" with the total number of predicate calls and
+  * the number of calls that needed exact arithmetic.
+  *
+  * The optional "threads" field sets the number of worker threads
+  * (default 1, 0 - one per hardware thread); larger values are clamped to
+  * the number of hardware threads. With more than one thread the parallel
+  * divide-and-conquer hull is used. It always uses the exact predicate,
+  * whatever "predicate" is, so its result is the same as the
+  * single-threaded one with "predicate": "exact" for any number of
+  * threads. "predicate_statistics" is reported only for single-threaded
+  * runs.
+  *
+  * The optional "prefilter" field (default false) enables the
+  * Akl-Toussaint prefilter: points strictly inside the octagon of extreme
+  * points are discarded before sorting. The number of discarded points is
+  * returned in "eliminated".
+  *
+  * The optional "algorithm" field selects the hull algorithm: "graham"
+  * (default), "chan", "quickhull" or "auto" (chosen from the number of
+  * points and a sample-based estimate of the hull size). The algorithm
+  * that was actually used is returned in "algorithm". Only "graham" uses
+  * more than one thread, so "predicate_statistics" is omitted when
+  * "threads" is not 1 and the algorithm is "graham" or "auto".
+  *
+  * The optional "output" field selects the result format: "points"
+  * (default, "convex_hull" with coordinates) or "indices" ("hull_indices"
+  * with indices into the input "points" array). "indices" is available for
+  * the single-threaded "graham" algorithm without prefilter; it sorts a
+  * permutation of 32-bit indices instead of copying the points.
+  *
+  * The optional "sort" field selects how the graham algorithm orders the
+  * points: "comparison" (default, std::sort) or "radix" (LSD radix sort on
+  * order-preserving integer keys of the coordinates). The hull does not
+  * depend on it.
+  *
+  * The optional "epsilon" (relative error in (0, 1]) or "strips" (number
+  * of strips, at most 2^20) field enables the approximate hull: the x
+  * range is split into strips = ceil(1 / epsilon) strips and the hull of
+  * the lowest and the highest point of every strip is returned in O(n +
+  * strips) time. Every input point lies within "error_bound" = (max x -
+  * min x) / strips of the returned hull. "algorithm" is then
+  * "approximate"; the "algorithm", "threads", "prefilter" and "sort"
+  * fields are ignored and "output" must be "points".
+  *
   * Output JSON structure:
   * {
   *   "convex_hull" : [
@@ -86,7 +383,13 @@ namespace geometry {
   *     {"x": 1.0, "y": 1.0},
   *     {"x": 2.0, "y": 0.0}
   *   ],
+  *   "hull_indices" : [0, 1, 2],
   *   "hull_size" : 3,
-  *   "original_size" : 3
+  *   "original_size" : 3,
+  *   "algorithm" : "graham",
+  *   "eliminated" : 0,
+  *   "strips" : 1000,
+  *   "error_bound" : 0.002,
+  *   "predicate_statistics" : {"calls": 5, "exact_calls": 0}
   * }
   */
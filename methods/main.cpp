@@ -8,12 +8,44 @@
 #include <httplib.h>
 #include <iostream>
 #include <cstdio>
+#include <functional>
 #include <string>
 #include <nlohmann/json.hpp>
 #include "methods.hpp"
 
 using json = nlohmann::json;
 
+/**
+ * @brief Создать обработчик POST запроса для метода алгоритма.
+ *
+ * @param method Метод алгоритма (см. methods.hpp).
+ * @return Функция возвращает обработчик, который разбирает JSON из тела
+ * запроса, вызывает метод и отправляет клиенту JSON с результатом. Если
+ * метод вернул ненулевой код или JSON не удалось разобрать, то статус
+ * ответа равен 400.
+ */
+static httplib::Server::Handler MethodHandler(int (*method)(const json&,
+                                                            json*)) {
+  return [method](const httplib::Request& req, httplib::Response& res) {
+    try {
+      auto input = json::parse(req.body);
+      json output;
+
+      int result = method(input, &output);
+
+      if (result != 0) {
+        res.status = 400;  // Bad request
+      }
+
+      res.set_content(output.dump(), "application/json");
+    } catch (const std::exception& e) {
+      json error_output = {{"error", std::string("Parse error: ") + e.what()}};
+      res.status = 400;
+      res.set_content(error_output.dump(), "application/json");
+    }
+  };
+}
+
 int main(int argc, char* argv[]) {
   // Порт по-умолчанию.
   int port = 8080;
@@ -25,6 +57,11 @@ int main(int argc, char* argv[]) {
       return -1;
   }
 
+  if (argc >= 3) {
+    // Каталог, из которого /StreamingConvexHull может читать файлы.
+    geometry::SetStreamingDataDirectory(argv[2]);
+  }
+
   std::cerr << "Listening on port " << port << "..." << std::endl;
 
   httplib::Server svr;
@@ -37,33 +74,73 @@ int main(int argc, char* argv[]) {
 
   /* Сюда нужно вставить обработчик post запроса для алгоритма. */
 
-  svr.Post("/GrahamScan",
-           [&](const httplib::Request& req, httplib::Response& res) {
+  svr.Post("/GrahamScan", MethodHandler(geometry::GrahamScanMethod));
+
+  svr.Post("/AnglePointInPolygon",
+           MethodHandler(geometry::AnglePointInPolygonMethod));
+  svr.Post("/PointInPolygonBatch",
+           MethodHandler(geometry::PointInPolygonBatchMethod));
+  svr.Post("/PointInPolygonWithHoles",
+           MethodHandler(geometry::PointInPolygonWithHolesMethod));
+
+  svr.Post("/MonotonePolygonTriangulation",
+           MethodHandler(geometry::MonotonePolygonTriangulationMethod));
+  svr.Post("/Triangulate", MethodHandler(geometry::TriangulateMethod));
+
+  svr.Post("/PolygonSet/Create",
+           MethodHandler(geometry::PolygonSetCreateMethod));
+  svr.Post("/PolygonSet/Query",
+           MethodHandler(geometry::PolygonSetQueryMethod));
+  svr.Post("/PolygonSet/Delete",
+           MethodHandler(geometry::PolygonSetDeleteMethod));
+
+  svr.Post("/DynamicConvexHull/Create",
+           MethodHandler(geometry::DynamicConvexHullCreateMethod));
+  svr.Post("/DynamicConvexHull/Insert",
+           MethodHandler(geometry::DynamicConvexHullInsertMethod));
+  svr.Post("/DynamicConvexHull/Hull",
+           MethodHandler(geometry::DynamicConvexHullHullMethod));
+  svr.Post("/DynamicConvexHull/Contains",
+           MethodHandler(geometry::DynamicConvexHullContainsMethod));
+  svr.Post("/DynamicConvexHull/Delete",
+           MethodHandler(geometry::DynamicConvexHullDeleteMethod));
+
+  svr.Post("/SlidingWindowConvexHull/Create",
+           MethodHandler(geometry::SlidingWindowConvexHullCreateMethod));
+  svr.Post("/SlidingWindowConvexHull/Push",
+           MethodHandler(geometry::SlidingWindowConvexHullPushMethod));
+  svr.Post("/SlidingWindowConvexHull/Hull",
+           MethodHandler(geometry::SlidingWindowConvexHullHullMethod));
+  svr.Post("/SlidingWindowConvexHull/Delete",
+           MethodHandler(geometry::SlidingWindowConvexHullDeleteMethod));
+
+  svr.Post("/ConvexLayers", MethodHandler(geometry::ConvexLayersMethod));
+  svr.Post("/RotatingCalipers",
+           MethodHandler(geometry::RotatingCalipersMethod));
+
+  svr.Post("/StreamingConvexHull",
+           MethodHandler(geometry::StreamingConvexHullMethod));
+
+  // Тело запроса разбирается по мере получения, поэтому параметры
+  // передаются в строке запроса.
+  svr.Post("/StreamingConvexHull/Upload",
+           [&](const httplib::Request& req, httplib::Response& res,
+               const httplib::ContentReader& content_reader) {
     try {
-      auto input = json::parse(req.body);
-      json output;
+      json input;
 
-      int result = geometry::GrahamScanMethod(input, &output);
-
-      if (result != 0) {
-        res.status = 400;  // Bad request
-      }
+      if (req.has_param("format"))
+        input["format"] = req.get_param_value("format");
 
-      res.set_content(output.dump(), "application/json");
-    } catch (const std::exception& e) {
-      json error_output = {{"error", std::string("Parse error: ") + e.what()}};
-      res.status = 400;
-      res.set_content(error_output.dump(), "application/json");
-    }
-  });
+      if (req.has_param("chunk_size"))
+        input["chunk_size"] = std::stoull(req.get_param_value("chunk_size"));
 
-    svr.Post("/AnglePointInPolygon",
-           [&](const httplib::Request& req, httplib::Response& res) {
-    try {
-      auto input = json::parse(req.body);
       json output;
 
-      int result = geometry::AnglePointInPolygonMethod(input, &output);
+      int result = geometry::StreamingConvexHullUploadMethod(input,
+          [&](const std::function<bool(const char*, size_t)>& receiver) {
+            return content_reader(receiver);
+          }, &output);
 
       if (result != 0) {
         res.status = 400;  // Bad request
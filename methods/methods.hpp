@@ -10,8 +10,21 @@
 #ifndef METHODS_METHODS_HPP_
 #define METHODS_METHODS_HPP_
 
+#include <cstddef>
+#include <functional>
+#include <string>
+
 namespace geometry {
 
+/**
+ * @brief Источник тела запроса, поступающего частями.
+ *
+ * Функция вызывает переданный приёмник для каждой части тела запроса и
+ * возвращает false, если тело не удалось получить целиком.
+ */
+using ContentSource = std::function<bool(
+    const std::function<bool(const char*, std::size_t)>&)>;
+
 /* Сюда нужно вставить объявление серверной части алгоритма. */
 
 /** 
@@ -26,6 +39,144 @@ namespace geometry {
   int AnglePointInPolygonMethod(const nlohmann::json& input, \
     nlohmann::json* output);
 
+/**
+ * @brief Methods for the dynamic convex hull sessions
+ * (see dynamic_convex_hull_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int DynamicConvexHullCreateMethod(const nlohmann::json& input,
+                                    nlohmann::json* output);
+  int DynamicConvexHullInsertMethod(const nlohmann::json& input,
+                                    nlohmann::json* output);
+  int DynamicConvexHullHullMethod(const nlohmann::json& input,
+                                  nlohmann::json* output);
+  int DynamicConvexHullContainsMethod(const nlohmann::json& input,
+                                      nlohmann::json* output);
+  int DynamicConvexHullDeleteMethod(const nlohmann::json& input,
+                                    nlohmann::json* output);
+
+/**
+ * @brief Methods for the bounded-memory streaming convex hull
+ * (see streaming_convex_hull_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param content request body received in parts (upload only)
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int StreamingConvexHullMethod(const nlohmann::json& input,
+                                nlohmann::json* output);
+  int StreamingConvexHullUploadMethod(const nlohmann::json& input,
+                                      const ContentSource& content,
+                                      nlohmann::json* output);
+
+/**
+ * @brief Set the directory /StreamingConvexHull may read files from.
+ *
+ * @param directory path to the data directory
+ */
+
+  void SetStreamingDataDirectory(const std::string& directory);
+
+/**
+ * @brief Method for convex layers (see convex_layers_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int ConvexLayersMethod(const nlohmann::json& input, nlohmann::json* output);
+
+/**
+ * @brief Method for convex hull metrics by rotating calipers
+ * (see rotating_calipers_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int RotatingCalipersMethod(const nlohmann::json& input,
+                             nlohmann::json* output);
+
+/**
+ * @brief Methods for the sliding-window convex hull sessions
+ * (see sliding_window_convex_hull_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int SlidingWindowConvexHullCreateMethod(const nlohmann::json& input,
+                                          nlohmann::json* output);
+  int SlidingWindowConvexHullPushMethod(const nlohmann::json& input,
+                                        nlohmann::json* output);
+  int SlidingWindowConvexHullHullMethod(const nlohmann::json& input,
+                                        nlohmann::json* output);
+  int SlidingWindowConvexHullDeleteMethod(const nlohmann::json& input,
+                                          nlohmann::json* output);
+
+/**
+ * @brief Method for classifying many points against one polygon
+ * (see point_in_polygon_batch_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int PointInPolygonBatchMethod(const nlohmann::json& input,
+                                nlohmann::json* output);
+
+/**
+ * @brief Methods for the multi-polygon point location sessions
+ * (see polygon_set_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int PolygonSetCreateMethod(const nlohmann::json& input,
+                             nlohmann::json* output);
+  int PolygonSetQueryMethod(const nlohmann::json& input,
+                            nlohmann::json* output);
+  int PolygonSetDeleteMethod(const nlohmann::json& input,
+                             nlohmann::json* output);
+
+/**
+ * @brief Method for locating a point in a polygon with holes
+ * (see polygon_with_holes_method.cpp).
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int PointInPolygonWithHolesMethod(const nlohmann::json& input,
+                                    nlohmann::json* output);
+
+/**
+ * @brief Methods for polygon triangulation: /MonotonePolygonTriangulation
+ * (see monotone_polygone_triangulation_method.cpp) for y-monotone polygons
+ * and /Triangulate (see triangulate_method.cpp) for any simple polygon.
+ *
+ * @param input input data in JSON format
+ * @param output pointer to JSON output
+ * @return return code: 0 - success, otherwise - error
+ */
+
+  int MonotonePolygonTriangulationMethod(const nlohmann::json& input,
+                                         nlohmann::json* output);
+  int TriangulateMethod(const nlohmann::json& input, nlohmann::json* output);
+
 /* Конец вставки. */
 
 }  // namespace geometry
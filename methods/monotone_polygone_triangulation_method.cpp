@@ -5,7 +5,8 @@
  * @brief Monotone polygon triangulation algorithm implementation.
  */
 
-#include "methods/monotone_polygone_triangulation_method.hpp"
+#include "monotone_polygone_triangulation_method.hpp"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include "../include/monotone_polygone_triangulation.hpp"
@@ -28,8 +29,7 @@ int MonotonePolygonTriangulationMethod(const nlohmann::json& input,
             return 1;
         }
 
-        std::vector<Point> polygon;
-        int id_counter = 0;
+        std::vector<Point<double>> polygon;
         for (const auto& point_json : input["polygon"]) {
             if (!point_json.is_object() || !point_json.contains("x") ||
                 !point_json["x"].is_number()) {
@@ -44,8 +44,7 @@ int MonotonePolygonTriangulationMethod(const nlohmann::json& input,
 
             polygon.emplace_back(
                 point_json["x"].get<double>(),
-                point_json["y"].get<double>(),
-                id_counter++);
+                point_json["y"].get<double>());
         }
 
         if (polygon.size() < 3) {
@@ -53,18 +52,25 @@ int MonotonePolygonTriangulationMethod(const nlohmann::json& input,
             return 3;
         }
 
-        auto diagonals = TriangulateMonotonePolygon(polygon);
+        std::vector<uint32_t> triangles = TriangulateMonotonePolygon(polygon);
 
+        // Every diagonal is a side of two counterclockwise triangles, once
+        // in each direction, so it is taken from the one where from < to.
+        const size_t n = polygon.size();
         nlohmann::json diagonals_json = nlohmann::json::array();
-        for (const auto& diagonal : diagonals) {
-            if (!IsPolygonEdge(polygon, diagonal.first, diagonal.second)) {
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            const uint32_t from = triangles[i];
+            const uint32_t to = triangles[i % 3 == 2 ? i - 2 : i + 1];
+            if (from < to && to - from != 1 && to - from != n - 1) {
                 diagonals_json.push_back({
-                    {"from", diagonal.first},
-                    {"to", diagonal.second}
+                    {"from", from},
+                    {"to", to}
                 });
             }
         }
 
+        (*output)["triangles_count"] = triangles.size() / 3;
+        (*output)["triangles"] = std::move(triangles);
         (*output)["diagonals"] = diagonals_json;
         (*output)["diagonals_count"] = diagonals_json.size();
         (*output)["vertices_count"] = polygon.size();
@@ -92,11 +98,18 @@ int MonotonePolygonTriangulationMethod(const nlohmann::json& input,
  *
  * Output JSON structure:
  * {
+ *   "triangles" : [2, 1, 0, 4, 2, 0, 3, 2, 4],
+ *   "triangles_count" : 3,
  *   "diagonals" : [
- *     {"from": 0, "to": 3},
- *     {"from": 3, "to": 1}
+ *     {"from": 0, "to": 2},
+ *     {"from": 2, "to": 4}
  *   ],
  *   "diagonals_count" : 2,
  *   "vertices_count" : 5
  * }
+ *
+ * "triangles" is a flat index buffer: every three consecutive numbers are
+ * the indices of the vertices of one triangle in the input, in
+ * counterclockwise order. "diagonals" are the sides of the triangles that
+ * are not polygon edges, each with from < to.
  */
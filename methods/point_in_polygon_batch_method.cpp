@@ -0,0 +1,261 @@
+/**
+ * @file methods/point_in_polygon_batch_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Batch point-in-polygon method.
+ */
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/cyclic_vector.hpp"
+#include "../include/point_in_polygon.hpp"
+#include "../include/polygon_grid.hpp"
+#include "../include/polygon_with_holes.hpp"
+
+namespace geometry {
+
+int PointInPolygonBatchMethod(const nlohmann::json& input,
+                              nlohmann::json* output) {
+  try {
+    if (!input.contains("polygon") || !input["polygon"].is_array()) {
+      (*output)["error"] = "Input must contain 'polygon' array";
+      return 1;
+    }
+
+    const bool has_points = input.contains("points");
+    const bool has_coordinates = input.contains("coordinates");
+
+    if (has_points == has_coordinates ||
+        (has_points && !input["points"].is_array()) ||
+        (has_coordinates && !input["coordinates"].is_array())) {
+      (*output)["error"] =
+          "Input must contain either 'points' or 'coordinates' array";
+      return 2;
+    }
+
+    CyclicVector<Point<double>> vertices;
+
+    for (const auto& point_json : input["polygon"]) {
+      if (!point_json.is_object() ||
+          !point_json.contains("x") || !point_json["x"].is_number() ||
+          !point_json.contains("y") || !point_json["y"].is_number()) {
+        (*output)["error"] = "Each polygon point must have 'x' & 'y'";
+        return 3;
+      }
+
+      vertices.emplace_back(point_json["x"].get<double>(),
+                            point_json["y"].get<double>());
+    }
+
+    std::vector<Polygon<double, CyclicVector<Point<double>>>> holes;
+
+    if (input.contains("holes")) {
+      if (!input["holes"].is_array()) {
+        (*output)["error"] = "'holes' must be an array of polygons";
+        return 7;
+      }
+
+      for (const auto& hole_json : input["holes"]) {
+        if (!hole_json.is_array()) {
+          (*output)["error"] = "Each hole must be an array of points";
+          return 7;
+        }
+
+        CyclicVector<Point<double>> hole;
+
+        for (const auto& point_json : hole_json) {
+          if (!point_json.is_object() ||
+              !point_json.contains("x") || !point_json["x"].is_number() ||
+              !point_json.contains("y") || !point_json["y"].is_number()) {
+            (*output)["error"] = "Each polygon point must have 'x' & 'y'";
+            return 3;
+          }
+
+          hole.emplace_back(point_json["x"].get<double>(),
+                            point_json["y"].get<double>());
+        }
+
+        holes.emplace_back(std::move(hole));
+      }
+    }
+
+    std::vector<Point<double>> points;
+
+    if (has_points) {
+      points.reserve(input["points"].size());
+
+      for (const auto& point_json : input["points"]) {
+        if (!point_json.is_object() ||
+            !point_json.contains("x") || !point_json["x"].is_number() ||
+            !point_json.contains("y") || !point_json["y"].is_number()) {
+          (*output)["error"] = "Each point must have 'x' and 'y' numeric "
+                               "fields";
+          return 4;
+        }
+
+        points.emplace_back(point_json["x"].get<double>(),
+                            point_json["y"].get<double>());
+      }
+    } else {
+      const auto& coordinates = input["coordinates"];
+
+      if (coordinates.size() % 2 != 0) {
+        (*output)["error"] = "'coordinates' must contain an even number of "
+                             "numbers";
+        return 4;
+      }
+
+      points.reserve(coordinates.size() / 2);
+
+      for (size_t i = 0; i < coordinates.size(); i += 2) {
+        if (!coordinates[i].is_number() || !coordinates[i + 1].is_number()) {
+          (*output)["error"] = "'coordinates' must contain only numbers";
+          return 4;
+        }
+
+        points.emplace_back(coordinates[i].get<double>(),
+                            coordinates[i + 1].get<double>());
+      }
+    }
+
+    size_t threads = 0;
+
+    if (input.contains("threads")) {
+      if (!input["threads"].is_number_unsigned()) {
+        (*output)["error"] = "'threads' must be a non-negative integer";
+        return 5;
+      }
+
+      threads = input["threads"].get<size_t>();
+    }
+
+    std::string method = "prepared";
+
+    if (input.contains("method")) {
+      if (input["method"] != "prepared" && input["method"] != "grid") {
+        (*output)["error"] = "'method' must be 'prepared' or 'grid'";
+        return 6;
+      }
+
+      method = input["method"].get<std::string>();
+    }
+
+    if (input.contains("holes") && method == "grid") {
+      (*output)["error"] = "'holes' are not supported with 'method': 'grid'";
+      return 7;
+    }
+
+    Polygon<double, CyclicVector<Point<double>>> polygon(std::move(vertices));
+    std::vector<PointPosition> positions;
+
+    if (input.contains("holes")) {
+      PolygonWithHoles<double> prepared(polygon, holes);
+
+      positions = prepared.Classify(points, threads);
+      (*output)["holes"] = prepared.NumHoles();
+      (*output)["path"] = "holes";
+    } else if (method == "grid") {
+      PolygonGrid<double> grid(polygon);
+
+      positions = grid.Classify(points, threads);
+      (*output)["memory"] = grid.MemoryUsage();
+      (*output)["path"] = "grid";
+    } else {
+      PreparedPolygon<double> prepared(polygon);
+
+      positions = prepared.Classify(points, threads);
+      (*output)["path"] = prepared.IsConvex() ? "convex" : "linear";
+    }
+
+    std::string codes(positions.size(), 'o');
+    size_t inside = 0;
+    size_t boundary = 0;
+
+    for (size_t i = 0; i < positions.size(); i++) {
+      if (positions[i] == PointPosition::INSIDE) {
+        codes[i] = 'i';
+        inside++;
+      } else if (positions[i] == PointPosition::BOUNDARY) {
+        codes[i] = 'b';
+        boundary++;
+      }
+    }
+
+    (*output)["positions"] = std::move(codes);
+    (*output)["inside"] = inside;
+    (*output)["outside"] = positions.size() - inside - boundary;
+    (*output)["boundary"] = boundary;
+    (*output)["polygon_size"] = polygon.Size();
+    (*output)["method"] = method;
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+}  // namespace geometry
+
+/**
+ * Input JSON structure:
+ * {
+ *   "polygon" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 0.0, "y": 1.0},
+ *     {"x": 1.0, "y": 1.0},
+ *     {"x": 1.0, "y": 0.0}
+ *   ],
+ *   "points" : [
+ *     {"x": 0.5, "y": 0.5},
+ *     {"x": 2.0, "y": 0.5},
+ *     {"x": 0.0, "y": 0.5}
+ *   ],
+ *   "threads" : 0,
+ *   "method" : "grid"
+ * }
+ *
+ * Instead of "points" the request may contain "coordinates", a flat array
+ * [x0, y0, x1, y1, ...], which is smaller and faster to parse.
+ *
+ * The polygon is parsed and prepared once (bounding box, edge vectors) and
+ * all points are classified with the winding number rule of
+ * /AnglePointInPolygon with "method": "winding". The optional "threads"
+ * field sets the number of worker threads; 0 (default) picks it from the
+ * amount of work. At most one thread per hardware thread is used.
+ *
+ * The optional "method" field selects the preprocessing: "prepared"
+ * (default, every point is tested against all edges) or "grid" (uniform
+ * grid with about one cell per edge; points in cells crossed by no edge are
+ * answered at once, the others test only the edges of their cell). With
+ * "grid" the output also has "memory", the size of the grid in bytes.
+ *
+ * The optional "holes" field is an array of inner rings in the format of
+ * "polygon", as in /PointInPolygonWithHoles. The points are then tested
+ * against all rings in one pass with the crossing number rule, and the
+ * output has "holes", the number of inner rings. "holes" can not be
+ * combined with "method": "grid".
+ *
+ * "path" reports how the points were tested: "convex" (the polygon is
+ * strictly convex, O(log n) per point), "linear" (all edges per point),
+ * "grid" or "holes" (all edges of the rings whose bounding box contains
+ * the point).
+ *
+ * Output JSON structure:
+ * {
+ *   "positions" : "iob",
+ *   "inside" : 1,
+ *   "outside" : 1,
+ *   "boundary" : 1,
+ *   "polygon_size" : 4,
+ *   "method" : "grid",
+ *   "memory" : 448,
+ *   "path" : "grid"
+ * }
+ *
+ * "positions" has one character per input point in input order: 'i' -
+ * inside, 'o' - outside, 'b' - boundary.
+ */
@@ -0,0 +1,298 @@
+/**
+ * @file methods/polygon_set_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Server sessions for multi-polygon point location.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/cyclic_vector.hpp"
+#include "../include/polygon_set.hpp"
+#include "session_registry.hpp"
+
+namespace geometry {
+
+/**
+ * @brief Open polygon sets.
+ *
+ * The index is immutable after creation, so a query takes a reference to
+ * it and releases the session lock before running. Queries to the same
+ * set then run in parallel.
+ */
+static SessionRegistry<std::shared_ptr<const PolygonSet<double>>>
+    polygonSets;
+
+/**
+ * @brief Parse the session identifier.
+ *
+ * @param input input data in JSON format
+ * @param id pointer to the identifier
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParseSetId(const nlohmann::json& input, uint64_t* id,
+                      nlohmann::json* output) {
+  if (!input.contains("id") || !input["id"].is_number_unsigned()) {
+    (*output)["error"] = "Input must contain non-negative integer 'id'";
+    return 3;
+  }
+
+  *id = input["id"].get<uint64_t>();
+
+  return 0;
+}
+
+/**
+ * @brief Parse the query points given as "points" or "coordinates".
+ *
+ * @param input input data in JSON format
+ * @param points pointer to the parsed points
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParseQueryPoints(const nlohmann::json& input,
+                            std::vector<Point<double>>* points,
+                            nlohmann::json* output) {
+  const bool has_points = input.contains("points");
+  const bool has_coordinates = input.contains("coordinates");
+
+  if (has_points == has_coordinates ||
+      (has_points && !input["points"].is_array()) ||
+      (has_coordinates && !input["coordinates"].is_array())) {
+    (*output)["error"] =
+        "Input must contain either 'points' or 'coordinates' array";
+    return 6;
+  }
+
+  if (has_points) {
+    points->reserve(input["points"].size());
+
+    for (const auto& point_json : input["points"]) {
+      if (!point_json.is_object() ||
+          !point_json.contains("x") || !point_json["x"].is_number() ||
+          !point_json.contains("y") || !point_json["y"].is_number()) {
+        (*output)["error"] = "Each point must have 'x' and 'y' numeric "
+                             "fields";
+        return 6;
+      }
+
+      points->emplace_back(point_json["x"].get<double>(),
+                           point_json["y"].get<double>());
+    }
+
+    return 0;
+  }
+
+  const auto& coordinates = input["coordinates"];
+
+  if (coordinates.size() % 2 != 0) {
+    (*output)["error"] = "'coordinates' must contain an even number of "
+                         "numbers";
+    return 6;
+  }
+
+  points->reserve(coordinates.size() / 2);
+
+  for (size_t i = 0; i < coordinates.size(); i += 2) {
+    if (!coordinates[i].is_number() || !coordinates[i + 1].is_number()) {
+      (*output)["error"] = "'coordinates' must contain only numbers";
+      return 6;
+    }
+
+    points->emplace_back(coordinates[i].get<double>(),
+                         coordinates[i + 1].get<double>());
+  }
+
+  return 0;
+}
+
+int PolygonSetCreateMethod(const nlohmann::json& input,
+                           nlohmann::json* output) {
+  try {
+    if (!input.contains("polygons") || !input["polygons"].is_array()) {
+      (*output)["error"] = "Input must contain 'polygons' array";
+      return 1;
+    }
+
+    std::vector<Polygon<double, CyclicVector<Point<double>>>> polygons;
+
+    polygons.reserve(input["polygons"].size());
+
+    for (const auto& polygon_json : input["polygons"]) {
+      if (!polygon_json.is_array()) {
+        (*output)["error"] = "Each polygon must be an array of points";
+        return 2;
+      }
+
+      CyclicVector<Point<double>> vertices;
+
+      for (const auto& point_json : polygon_json) {
+        if (!point_json.is_object() ||
+            !point_json.contains("x") || !point_json["x"].is_number() ||
+            !point_json.contains("y") || !point_json["y"].is_number()) {
+          (*output)["error"] = "Each polygon point must have 'x' & 'y'";
+          return 2;
+        }
+
+        vertices.emplace_back(point_json["x"].get<double>(),
+                              point_json["y"].get<double>());
+      }
+
+      polygons.emplace_back(std::move(vertices));
+    }
+
+    auto set = std::make_shared<const PolygonSet<double>>(polygons);
+    uint64_t id;
+
+    if (!polygonSets.Create(set, &id)) {
+      (*output)["error"] = "Too many open sessions";
+      return 5;
+    }
+
+    (*output)["id"] = id;
+    (*output)["size"] = set->Size();
+    (*output)["depth"] = set->Depth();
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int PolygonSetQueryMethod(const nlohmann::json& input,
+                          nlohmann::json* output) {
+  try {
+    uint64_t id;
+
+    if (int result = ParseSetId(input, &id, output))
+      return result;
+
+    std::vector<Point<double>> points;
+
+    if (int result = ParseQueryPoints(input, &points, output))
+      return result;
+
+    size_t threads = 0;
+
+    if (input.contains("threads")) {
+      if (!input["threads"].is_number_unsigned()) {
+        (*output)["error"] = "'threads' must be a non-negative integer";
+        return 7;
+      }
+
+      threads = input["threads"].get<size_t>();
+    }
+
+    std::shared_ptr<const PolygonSet<double>> set;
+
+    bool found = polygonSets.Access(id,
+        [&set](std::shared_ptr<const PolygonSet<double>>& state) {
+      set = state;
+    });
+
+    if (!found) {
+      (*output)["error"] = "Unknown session 'id'";
+      return 4;
+    }
+
+    std::vector<size_t> indices = set->Find(points, threads);
+    nlohmann::json polygons_json = nlohmann::json::array();
+    size_t matched = 0;
+
+    for (size_t index : indices) {
+      if (index == PolygonSet<double>::npos) {
+        polygons_json.push_back(-1);
+      } else {
+        polygons_json.push_back(index);
+        matched++;
+      }
+    }
+
+    (*output)["id"] = id;
+    (*output)["polygons"] = std::move(polygons_json);
+    (*output)["matched"] = matched;
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int PolygonSetDeleteMethod(const nlohmann::json& input,
+                           nlohmann::json* output) {
+  uint64_t id;
+
+  if (int result = ParseSetId(input, &id, output))
+    return result;
+
+  if (!polygonSets.Remove(id)) {
+    (*output)["error"] = "Unknown session 'id'";
+    return 4;
+  }
+
+  (*output)["id"] = id;
+
+  return 0;
+}
+
+}  // namespace geometry
+
+/**
+ * A polygon set answers "which polygon contains this point" for many
+ * polygons at once. The bounding boxes of the polygons are packed into an
+ * R-tree (Sort-Tile-Recursive bulk load), and only the polygons whose
+ * boxes contain the point are tested exactly. The index stays in memory
+ * between requests until it is deleted.
+ *
+ * /PolygonSet/Create builds the index. Input:
+ * {
+ *   "polygons" : [
+ *     [{"x": 0.0, "y": 0.0}, {"x": 0.0, "y": 1.0}, {"x": 1.0, "y": 1.0},
+ *      {"x": 1.0, "y": 0.0}],
+ *     [{"x": 1.0, "y": 0.0}, {"x": 1.0, "y": 1.0}, {"x": 2.0, "y": 1.0},
+ *      {"x": 2.0, "y": 0.0}]
+ *   ]
+ * }
+ * Output:
+ * {
+ *   "id" : 1,
+ *   "size" : 2,
+ *   "depth" : 1
+ * }
+ * "depth" is the number of levels of the R-tree.
+ *
+ * /PolygonSet/Query locates points. The points are given either as
+ * "points" or as a flat "coordinates" array [x0, y0, x1, y1, ...], as in
+ * /PointInPolygonBatch. The optional "threads" field sets the number of
+ * worker threads; 0 (default) picks it from the number of points. At
+ * most one thread per hardware thread is used.
+ * Input:
+ * {
+ *   "id" : 1,
+ *   "coordinates" : [0.5, 0.5, 1.0, 0.5, 3.0, 0.5],
+ *   "threads" : 0
+ * }
+ * Output:
+ * {
+ *   "id" : 1,
+ *   "polygons" : [0, 0, -1],
+ *   "matched" : 2
+ * }
+ * "polygons" has, for each point in input order, the smallest index of a
+ * polygon that contains the point (inside or on the boundary), or -1.
+ *
+ * /PolygonSet/Delete frees the index "id". Input: {"id" : 1}.
+ *
+ * Return codes: 1 - no 'polygons' array, 2 - a polygon is not an array of
+ * points with numeric 'x' and 'y', 3 - no 'id', 4 - unknown session,
+ * 5 - too many open sessions, 6 - invalid 'points' or 'coordinates',
+ * 7 - invalid 'threads'.
+ */
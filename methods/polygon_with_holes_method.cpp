@@ -0,0 +1,166 @@
+/**
+ * @file methods/polygon_with_holes_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Point-in-polygon method for polygons with holes.
+ */
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/cyclic_vector.hpp"
+#include "../include/polygon_with_holes.hpp"
+
+namespace geometry {
+
+/**
+ * @brief Parse a ring of a polygon with holes.
+ *
+ * @param ring_json array of points in JSON format
+ * @param ring pointer to the parsed ring
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParseRing(const nlohmann::json& ring_json,
+                     Polygon<double, CyclicVector<Point<double>>>* ring,
+                     nlohmann::json* output) {
+  CyclicVector<Point<double>> vertices;
+
+  for (const auto& point_json : ring_json) {
+    if (!point_json.is_object() ||
+        !point_json.contains("x") || !point_json["x"].is_number() ||
+        !point_json.contains("y") || !point_json["y"].is_number()) {
+      (*output)["error"] = "Each polygon point must have 'x' & 'y'";
+      return 4;
+    }
+
+    vertices.emplace_back(point_json["x"].get<double>(),
+                          point_json["y"].get<double>());
+  }
+
+  *ring = Polygon<double, CyclicVector<Point<double>>>(std::move(vertices));
+
+  return 0;
+}
+
+int PointInPolygonWithHolesMethod(const nlohmann::json& input,
+                                  nlohmann::json* output) {
+  try {
+    if (!input.contains("point") || !input["point"].is_object() ||
+        !input["point"].contains("x") || !input["point"]["x"].is_number() ||
+        !input["point"].contains("y") || !input["point"]["y"].is_number()) {
+      (*output)["error"] = "Input must contain 'point' with 'x' & 'y'";
+      return 1;
+    }
+
+    if (!input.contains("polygon") || !input["polygon"].is_array()) {
+      (*output)["error"] = "Input must contain 'polygon' array";
+      return 2;
+    }
+
+    if (input.contains("holes") && !input["holes"].is_array()) {
+      (*output)["error"] = "'holes' must be an array of polygons";
+      return 3;
+    }
+
+    Point<double> point(input["point"]["x"].get<double>(),
+                        input["point"]["y"].get<double>());
+
+    Polygon<double, CyclicVector<Point<double>>> outer;
+
+    if (int result = ParseRing(input["polygon"], &outer, output))
+      return result;
+
+    std::vector<Polygon<double, CyclicVector<Point<double>>>> holes;
+
+    if (input.contains("holes")) {
+      holes.resize(input["holes"].size());
+
+      for (size_t i = 0; i < holes.size(); i++) {
+        if (!input["holes"][i].is_array()) {
+          (*output)["error"] = "Each hole must be an array of points";
+          return 3;
+        }
+
+        if (int result = ParseRing(input["holes"][i], &holes[i], output))
+          return result;
+      }
+    }
+
+    PolygonWithHoles<double> polygon(outer, holes);
+
+    switch (polygon.Classify(point)) {
+      case PointPosition::INSIDE:
+        (*output)["position"] = "inside";
+        break;
+      case PointPosition::OUTSIDE:
+        (*output)["position"] = "outside";
+        break;
+      case PointPosition::BOUNDARY:
+        (*output)["position"] = "boundary";
+        break;
+    }
+
+    (*output)["point"] = {
+      {"x", point.X()},
+      {"y", point.Y()}
+    };
+    (*output)["polygon_size"] = polygon.Size();
+    (*output)["holes"] = polygon.NumHoles();
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+}  // namespace geometry
+
+/**
+ * Input JSON structure:
+ * {
+ *   "point" : {"x": 1.0, "y": 1.0},
+ *   "polygon" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 0.0, "y": 4.0},
+ *     {"x": 4.0, "y": 4.0},
+ *     {"x": 4.0, "y": 0.0}
+ *   ],
+ *   "holes" : [
+ *     [
+ *       {"x": 1.0, "y": 1.0},
+ *       {"x": 1.0, "y": 2.0},
+ *       {"x": 2.0, "y": 2.0},
+ *       {"x": 2.0, "y": 1.0}
+ *     ]
+ *   ]
+ * }
+ *
+ * "polygon" is the outer ring and the optional "holes" are the inner rings
+ * (lakes, courtyards). The orientation of the rings does not matter. The
+ * point is tested against all rings in one pass with the crossing number
+ * (even-odd) rule; rings whose bounding box does not contain the point are
+ * skipped. For holes inside the outer ring that do not overlap each other
+ * the point is inside if it is inside the outer ring and outside every
+ * hole. A point on an edge of any ring is on the boundary.
+ *
+ * Many points can be tested at once with /PointInPolygonBatch, which
+ * accepts the same "holes" field.
+ *
+ * Output JSON structure:
+ * {
+ *   "position" : "boundary",
+ *   "point" : {"x": 1.0, "y": 1.0},
+ *   "polygon_size" : 8,
+ *   "holes" : 1
+ * }
+ *
+ * "position" is "inside", "outside" or "boundary". "polygon_size" is the
+ * number of edges in all rings.
+ *
+ * Return codes: 1 - invalid 'point', 2 - no 'polygon' array, 3 - 'holes'
+ * is not an array of arrays, 4 - a vertex without numeric 'x' and 'y'.
+ */
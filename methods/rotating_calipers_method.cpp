@@ -0,0 +1,167 @@
+/**
+ * @file methods/rotating_calipers_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Convex hull metrics by rotating calipers.
+ */
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/graham_scan.hpp"
+#include "../include/rotating_calipers.hpp"
+
+namespace geometry {
+
+/**
+ * @brief Convert a rectangle to JSON.
+ *
+ * @param rectangle bounding rectangle
+ * @return JSON object with corners, sizes, area and perimeter
+ */
+static nlohmann::json RectangleToJson(
+    const CaliperRectangle<double>& rectangle) {
+  nlohmann::json corners = nlohmann::json::array();
+
+  for (const auto& corner : rectangle.corners)
+    corners.push_back({{"x", corner.X()}, {"y", corner.Y()}});
+
+  return {
+    {"corners", corners},
+    {"width", rectangle.width},
+    {"height", rectangle.height},
+    {"area", rectangle.Area()},
+    {"perimeter", rectangle.Perimeter()},
+    {"edge", rectangle.edge}
+  };
+}
+
+int RotatingCalipersMethod(const nlohmann::json& input,
+                           nlohmann::json* output) {
+  try {
+    if (!input.contains("points") || !input["points"].is_array()) {
+      (*output)["error"] = "Input must contain 'points' array";
+      return 1;
+    }
+
+    std::vector<Point<double>> points;
+
+    for (const auto& point_json : input["points"]) {
+      if (!point_json.is_object() ||
+          !point_json.contains("x") || !point_json["x"].is_number() ||
+          !point_json.contains("y") || !point_json["y"].is_number()) {
+        (*output)["error"] = "Each point must have 'x' and 'y' numeric fields";
+        return 2;
+      }
+
+      points.emplace_back(point_json["x"].get<double>(),
+                          point_json["y"].get<double>());
+    }
+
+    std::string predicate = "exact";
+
+    if (input.contains("predicate")) {
+      if (input["predicate"] != "tolerance" && input["predicate"] != "exact") {
+        (*output)["error"] = "'predicate' must be 'tolerance' or 'exact'";
+        return 3;
+      }
+
+      predicate = input["predicate"].get<std::string>();
+    }
+
+    std::vector<Point<double>> hull;
+
+    if (predicate == "exact")
+      hull = GrahamScan(std::move(points), AdaptiveOrientationPolicy());
+    else
+      hull = GrahamScan(std::move(points),
+                        ToleranceOrientationPolicy<double>());
+
+    HullMetrics<double> metrics = RotatingCalipers(hull);
+
+    nlohmann::json hull_json = nlohmann::json::array();
+
+    for (const auto& point : hull)
+      hull_json.push_back({{"x", point.X()}, {"y", point.Y()}});
+
+    nlohmann::json pairs_json = nlohmann::json::array();
+
+    for (const auto& [first, second] : metrics.antipodalPairs)
+      pairs_json.push_back({first, second});
+
+    (*output)["convex_hull"] = hull_json;
+    (*output)["hull_size"] = hull.size();
+    (*output)["diameter"] = {
+      {"length", metrics.diameter},
+      {"vertices", {metrics.diameterPair.first, metrics.diameterPair.second}}
+    };
+    (*output)["width"] = {
+      {"length", metrics.width},
+      {"edge", metrics.widthEdge},
+      {"vertex", metrics.widthVertex}
+    };
+    (*output)["min_area_rectangle"] =
+        RectangleToJson(metrics.minAreaRectangle);
+    (*output)["min_perimeter_rectangle"] =
+        RectangleToJson(metrics.minPerimeterRectangle);
+    (*output)["antipodal_pairs"] = pairs_json;
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+}  // namespace geometry
+
+/**
+ * Input JSON structure:
+ * {
+ *   "points" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 4.0, "y": 0.0},
+ *     {"x": 4.0, "y": 2.0},
+ *     {"x": 0.0, "y": 2.0},
+ *     {"x": 1.0, "y": 1.0}
+ *   ],
+ *   "predicate" : "exact"
+ * }
+ *
+ * The convex hull is computed by the Graham scan and all metrics are
+ * computed from it by rotating calipers in O(h) time, so one request
+ * returns the hull and its metrics. The optional "predicate" field is
+ * "exact" (default) or "tolerance".
+ *
+ * Output JSON structure:
+ * {
+ *   "convex_hull" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 4.0, "y": 0.0},
+ *     {"x": 4.0, "y": 2.0},
+ *     {"x": 0.0, "y": 2.0}
+ *   ],
+ *   "hull_size" : 4,
+ *   "diameter" : {"length": 4.472, "vertices": [0, 2]},
+ *   "width" : {"length": 2.0, "edge": 0, "vertex": 2},
+ *   "min_area_rectangle" : {
+ *     "corners" : [
+ *       {"x": 0.0, "y": 0.0},
+ *       {"x": 4.0, "y": 0.0},
+ *       {"x": 4.0, "y": 2.0},
+ *       {"x": 0.0, "y": 2.0}
+ *     ],
+ *     "width" : 4.0,
+ *     "height" : 2.0,
+ *     "area" : 8.0,
+ *     "perimeter" : 12.0,
+ *     "edge" : 0
+ *   },
+ *   "min_perimeter_rectangle" : { ... },
+ *   "antipodal_pairs" : [[0, 1], [0, 2], [0, 3], [1, 2], [1, 3], [2, 3]]
+ * }
+ *
+ * All vertex and edge numbers are positions in "convex_hull"; edge i goes
+ * from vertex i to the next one. Rectangle corners are listed
+ * counterclockwise starting on the line of edge "edge".
+ */
@@ -0,0 +1,148 @@
+/**
+ * @file methods/session_registry.hpp
+ * @author Mikhail Lozhnikov
+ *
+ * Хранилище состояний сервера между запросами.
+ */
+
+#ifndef METHODS_SESSION_REGISTRY_HPP_
+#define METHODS_SESSION_REGISTRY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace geometry {
+
+/**
+ * @brief Хранилище сессий.
+ *
+ * @tparam State Тип состояния сессии.
+ *
+ * Сессия создаётся одним запросом и получает числовой идентификатор,
+ * по которому следующие запросы обращаются к её состоянию. Запросы к
+ * разным сессиям выполняются параллельно, запросы к одной сессии ---
+ * последовательно. Количество одновременно открытых сессий ограничено,
+ * чтобы клиенты, не закрывающие сессии, не исчерпали память сервера.
+ */
+template<typename State>
+class SessionRegistry {
+ private:
+  /**
+   * @brief Сессия.
+   */
+  struct Session {
+    //! Блокировка состояния.
+    std::mutex mutex;
+    //! Состояние.
+    State state;
+
+    /**
+     * @brief Создать сессию.
+     *
+     * @param state Начальное состояние.
+     */
+    explicit Session(State&& state) : state(std::move(state)) { }
+  };
+
+  //! Блокировка списка сессий.
+  std::mutex mutex;
+  //! Открытые сессии.
+  std::map<std::uint64_t, std::shared_ptr<Session>> sessions;
+  //! Следующий идентификатор.
+  std::uint64_t nextId = 1;
+  //! Максимальное количество открытых сессий.
+  std::size_t maxSessions;
+
+ public:
+  /**
+   * @brief Создать хранилище.
+   *
+   * @param maxSessions Максимальное количество открытых сессий.
+   */
+  explicit SessionRegistry(std::size_t maxSessions = 1024) :
+    maxSessions(maxSessions)
+  { }
+
+  /**
+   * @brief Открыть сессию.
+   *
+   * @param state Начальное состояние.
+   * @param id Указатель, по которому записывается идентификатор сессии.
+   * @return Функция возвращает false, если открыто слишком много сессий.
+   */
+  bool Create(State state, std::uint64_t* id) {
+    auto session = std::make_shared<Session>(std::move(state));
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (sessions.size() >= maxSessions)
+      return false;
+
+    *id = nextId++;
+    sessions.emplace(*id, std::move(session));
+
+    return true;
+  }
+
+  /**
+   * @brief Выполнить функцию над состоянием сессии.
+   *
+   * @tparam Function Тип функции.
+   * @param id Идентификатор сессии.
+   * @param function Функция, принимающая ссылку на состояние.
+   * @return Функция возвращает false, если сессии не существует.
+   *
+   * На время выполнения функции сессия блокируется. Сессия, закрытая
+   * параллельным запросом, удаляется после завершения функции.
+   */
+  template<typename Function>
+  bool Access(std::uint64_t id, Function&& function) {
+    std::shared_ptr<Session> session;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = sessions.find(id);
+
+      if (it == sessions.end())
+        return false;
+
+      session = it->second;
+    }
+
+    std::lock_guard<std::mutex> lock(session->mutex);
+
+    function(session->state);
+
+    return true;
+  }
+
+  /**
+   * @brief Закрыть сессию.
+   *
+   * @param id Идентификатор сессии.
+   * @return Функция возвращает false, если сессии не существует.
+   */
+  bool Remove(std::uint64_t id) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return sessions.erase(id) > 0;
+  }
+
+  /**
+   * @brief Получить количество открытых сессий.
+   * @return Функция возвращает количество открытых сессий.
+   */
+  std::size_t Size() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return sessions.size();
+  }
+};
+
+}  // namespace geometry
+
+#endif  // METHODS_SESSION_REGISTRY_HPP_
@@ -0,0 +1,405 @@
+/**
+ * @file methods/sliding_window_convex_hull_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Server sessions for the sliding-window convex hull.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/sliding_window_convex_hull.hpp"
+#include "session_registry.hpp"
+
+namespace geometry {
+
+/**
+ * @brief Largest allowed (and default) "window".
+ */
+static constexpr size_t maxWindow = size_t(1) << 20;
+
+/**
+ * @brief Largest total number of points in all open sessions.
+ *
+ * A point costs up to about 512 bytes: an entry of one of the two stacks
+ * and the vertices and undo journal records of the two hulls. So the
+ * open sessions together keep at most about 1 GB, however many of them
+ * there are.
+ */
+static constexpr size_t maxTotalPoints = size_t(1) << 21;
+
+//! Lock of totalPoints.
+static std::mutex budgetMutex;
+//! Number of points reserved by all open sessions.
+static size_t totalPoints = 0;
+
+/**
+ * @brief Session of the sliding-window convex hull methods.
+ *
+ * Before a push the session reserves room for the points that the window
+ * may grow by, afterwards it keeps only the points the window holds. The
+ * reservation is returned when the session is destroyed.
+ */
+struct WindowSession {
+  //! Sliding-window convex hull.
+  SlidingWindowConvexHull<double> window;
+  //! Largest number of points in the window.
+  size_t capacity;
+  //! Number of points reserved in totalPoints.
+  size_t reserved = 0;
+
+  /**
+   * @brief Create a session.
+   *
+   * @param capacity largest number of points in the window
+   * @param duration duration of the window
+   */
+  WindowSession(size_t capacity, double duration) :
+    window(capacity, duration),
+    capacity(capacity)
+  { }
+
+  /**
+   * @brief Move a session; the reservation passes to the new one.
+   *
+   * @param other session to move
+   */
+  WindowSession(WindowSession&& other) :
+    window(std::move(other.window)),
+    capacity(other.capacity),
+    reserved(other.reserved) {
+    other.reserved = 0;
+  }
+
+  WindowSession& operator=(WindowSession&&) = delete;
+
+  ~WindowSession() { Reserve(0); }
+
+  /**
+   * @brief Change the number of points reserved by the session.
+   *
+   * @param count new number of reserved points
+   * @return false if the other sessions leave no room for count points;
+   * the reservation is not changed then
+   */
+  bool Reserve(size_t count) {
+    std::lock_guard<std::mutex> lock(budgetMutex);
+
+    if (count > reserved && count - reserved > maxTotalPoints - totalPoints)
+      return false;
+
+    totalPoints = totalPoints - reserved + count;
+    reserved = count;
+
+    return true;
+  }
+};
+
+/**
+ * @brief Open sessions of the sliding-window convex hull methods.
+ */
+static SessionRegistry<WindowSession> windowSessions;
+
+/**
+ * @brief Parse the "points" array with optional timestamps "t".
+ *
+ * @param input input data in JSON format
+ * @param points pointer to the parsed points and timestamps
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParseTimedPoints(
+    const nlohmann::json& input,
+    std::vector<std::pair<Point<double>, double>>* points,
+    nlohmann::json* output) {
+  if (!input.contains("points"))
+    return 0;
+
+  if (!input["points"].is_array()) {
+    (*output)["error"] = "'points' must be an array";
+    return 1;
+  }
+
+  for (const auto& point_json : input["points"]) {
+    if (!point_json.is_object() ||
+        !point_json.contains("x") || !point_json["x"].is_number() ||
+        !point_json.contains("y") || !point_json["y"].is_number() ||
+        (point_json.contains("t") && !point_json["t"].is_number())) {
+      (*output)["error"] = "Each point must have 'x' and 'y' numeric fields "
+                           "and may have numeric 't'";
+      return 2;
+    }
+
+    points->emplace_back(Point<double>(point_json["x"].get<double>(),
+                                       point_json["y"].get<double>()),
+                         point_json.value("t", 0.0));
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Parse the session identifier.
+ *
+ * @param input input data in JSON format
+ * @param id pointer to the identifier
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParseWindowId(const nlohmann::json& input, uint64_t* id,
+                         nlohmann::json* output) {
+  if (!input.contains("id") || !input["id"].is_number_unsigned()) {
+    (*output)["error"] = "Input must contain non-negative integer 'id'";
+    return 3;
+  }
+
+  *id = input["id"].get<uint64_t>();
+
+  return 0;
+}
+
+/**
+ * @brief Write the window summary to the output.
+ *
+ * @param id session identifier
+ * @param window sliding-window convex hull
+ * @param output pointer to JSON output
+ */
+static void WriteWindowSummary(uint64_t id,
+                               const SlidingWindowConvexHull<double>& window,
+                               nlohmann::json* output) {
+  (*output)["id"] = id;
+  (*output)["size"] = window.Size();
+}
+
+int SlidingWindowConvexHullCreateMethod(const nlohmann::json& input,
+                                        nlohmann::json* output) {
+  try {
+    size_t capacity = maxWindow;
+    double duration = std::numeric_limits<double>::infinity();
+
+    if (input.contains("window")) {
+      if (!input["window"].is_number_unsigned() ||
+          input["window"].get<size_t>() == 0 ||
+          input["window"].get<size_t>() > maxWindow) {
+        (*output)["error"] = "'window' must be an integer in [1, " +
+                             std::to_string(maxWindow) + "]";
+        return 6;
+      }
+
+      capacity = input["window"].get<size_t>();
+    }
+
+    if (input.contains("duration")) {
+      if (!input["duration"].is_number() ||
+          !(input["duration"].get<double>() >= 0.0)) {
+        (*output)["error"] = "'duration' must be a non-negative number";
+        return 6;
+      }
+
+      duration = input["duration"].get<double>();
+    }
+
+    uint64_t id;
+
+    if (!windowSessions.Create(WindowSession(capacity, duration), &id)) {
+      (*output)["error"] = "Too many open sessions";
+      return 5;
+    }
+
+    (*output)["id"] = id;
+    (*output)["size"] = 0;
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int SlidingWindowConvexHullPushMethod(const nlohmann::json& input,
+                                      nlohmann::json* output) {
+  try {
+    uint64_t id;
+    std::vector<std::pair<Point<double>, double>> points;
+
+    if (int result = ParseWindowId(input, &id, output))
+      return result;
+
+    if (int result = ParseTimedPoints(input, &points, output))
+      return result;
+
+    bool ordered = true;
+    bool reserved = true;
+
+    bool found = windowSessions.Access(id, [&](WindowSession& session) {
+      SlidingWindowConvexHull<double>& window = session.window;
+
+      // The whole batch is checked first, so a rejected request leaves
+      // the window unchanged.
+      double latest = window.LatestTime();
+
+      for (const auto& point : points) {
+        ordered = ordered && point.second >= latest;
+        latest = point.second;
+      }
+
+      if (!ordered)
+        return;
+
+      size_t size = window.Size();
+
+      reserved = session.Reserve(
+          size + std::min(points.size(), session.capacity - size));
+
+      if (!reserved)
+        return;
+
+      size_t expired = 0;
+
+      for (const auto& [point, time] : points)
+        expired += window.Push(point, time);
+
+      session.Reserve(window.Size());
+
+      (*output)["expired"] = expired;
+
+      WriteWindowSummary(id, window, output);
+    });
+
+    if (!found) {
+      (*output)["error"] = "Unknown session 'id'";
+      return 4;
+    }
+
+    if (!ordered) {
+      (*output)["error"] = "'t' must not decrease";
+      return 7;
+    }
+
+    if (!reserved) {
+      (*output)["error"] = "Too many points in open sessions";
+      return 8;
+    }
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int SlidingWindowConvexHullHullMethod(const nlohmann::json& input,
+                                      nlohmann::json* output) {
+  try {
+    uint64_t id;
+
+    if (int result = ParseWindowId(input, &id, output))
+      return result;
+
+    std::vector<Point<double>> convex_hull;
+
+    bool found = windowSessions.Access(id, [&](WindowSession& session) {
+      convex_hull = session.window.Hull();
+
+      WriteWindowSummary(id, session.window, output);
+    });
+
+    if (!found) {
+      (*output)["error"] = "Unknown session 'id'";
+      return 4;
+    }
+
+    nlohmann::json hull_json = nlohmann::json::array();
+
+    for (const auto& point : convex_hull)
+      hull_json.push_back({{"x", point.X()}, {"y", point.Y()}});
+
+    (*output)["convex_hull"] = hull_json;
+    (*output)["hull_size"] = convex_hull.size();
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int SlidingWindowConvexHullDeleteMethod(const nlohmann::json& input,
+                                        nlohmann::json* output) {
+  uint64_t id;
+
+  if (int result = ParseWindowId(input, &id, output))
+    return result;
+
+  if (!windowSessions.Remove(id)) {
+    (*output)["error"] = "Unknown session 'id'";
+    return 4;
+  }
+
+  (*output)["id"] = id;
+
+  return 0;
+}
+
+}  // namespace geometry
+
+/**
+ * The sliding-window convex hull keeps the hull of the most recent points
+ * of a time-ordered stream. Points are appended to the window and the
+ * oldest ones expire in O(log n) amortized time per point.
+ *
+ * /SlidingWindowConvexHull/Create opens a session. Input (all fields
+ * optional):
+ * {
+ *   "window" : 1000,
+ *   "duration" : 60.0
+ * }
+ * "window" is the maximal number of points (from 1 to 2^20, default
+ * 2^20), "duration" keeps only the points whose time is not older than
+ * the time of the latest point minus "duration" (missing - unlimited).
+ * Every session is bounded by "window" even without "duration". All
+ * open sessions together hold at most 2^21 points.
+ * Output:
+ * {
+ *   "id" : 1,
+ *   "size" : 0
+ * }
+ *
+ * /SlidingWindowConvexHull/Push appends points in order. The optional "t"
+ * field is the arrival time (default 0); times must not decrease, within
+ * the request and relative to the points pushed before. A request with a
+ * decreasing time is rejected as a whole, as is a request that could
+ * take the total number of points in all sessions over 2^21.
+ * Input:
+ * {
+ *   "id" : 1,
+ *   "points" : [
+ *     {"x": 1.0, "y": 1.0, "t": 12.5}
+ *   ]
+ * }
+ * Output:
+ * {
+ *   "id" : 1,
+ *   "size" : 1,
+ *   "expired" : 0
+ * }
+ * "expired" is the number of points removed from the window.
+ *
+ * /SlidingWindowConvexHull/Hull returns the hull of the points in the
+ * window counterclockwise from the lexicographically smallest vertex, the
+ * same as /GrahamScan with "predicate": "exact". Input: {"id" : 1}.
+ * Output: "id", "size", "convex_hull" and "hull_size".
+ *
+ * /SlidingWindowConvexHull/Delete closes session "id". Input: {"id" : 1}.
+ *
+ * Return codes: 1 - 'points' is not an array, 2 - a point without numeric
+ * 'x' and 'y' or with non-numeric 't', 3 - no 'id', 4 - unknown session,
+ * 5 - too many open sessions, 6 - invalid 'window' or 'duration',
+ * 7 - 't' decreases, 8 - too many points in open sessions.
+ */
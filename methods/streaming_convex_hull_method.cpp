@@ -0,0 +1,301 @@
+/**
+ * @file methods/streaming_convex_hull_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Bounded-memory convex hull of a file or of an uploaded stream.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/point_stream.hpp"
+#include "../include/streaming_convex_hull.hpp"
+#include "methods.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace geometry {
+
+/**
+ * @brief Directory that /StreamingConvexHull may read files from.
+ */
+static std::filesystem::path dataDirectory =
+    std::filesystem::temp_directory_path() / "geometry_data";
+
+void SetStreamingDataDirectory(const std::string& directory) {
+  dataDirectory = directory;
+}
+
+/**
+ * @brief Resolve a client-supplied file name inside the data directory.
+ *
+ * @param name absolute path or path relative to the data directory
+ * @param path pointer to the resolved path
+ * @return true if the resolved path lies inside the data directory
+ *
+ * Both paths are canonicalized first, so neither ".." nor symbolic links
+ * lead out of the directory.
+ */
+static bool ResolveDataFile(const std::string& name,
+                            std::filesystem::path* path) {
+  std::error_code error;
+  const std::filesystem::path root =
+      std::filesystem::weakly_canonical(dataDirectory, error);
+
+  if (error)
+    return false;
+
+  *path = std::filesystem::weakly_canonical(root / name, error);
+
+  if (error)
+    return false;
+
+  auto rootEnd = root.end();
+
+  // The trailing empty component of "dir/" is not a part of the prefix.
+  if (rootEnd != root.begin() && std::prev(rootEnd)->empty())
+    --rootEnd;
+
+  return std::mismatch(root.begin(), rootEnd,
+                       path->begin(), path->end()).first == rootEnd &&
+         *path != root;
+}
+
+/**
+ * @brief Get the peak resident set size of the server process.
+ *
+ * @return size_t peak RSS in kilobytes (0 if it is not available)
+ */
+static size_t PeakResidentSetSizeKb() {
+#if defined(__unix__) || defined(__APPLE__)
+  rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#else
+  return 0;
+#endif
+}
+
+/**
+ * @brief Largest allowed "chunk_size". A chunk larger than the input
+ * would buffer the whole stream and defeat the memory bound.
+ */
+static constexpr size_t maxChunkSize = size_t(1) << 24;
+
+/**
+ * @brief Parse "format" and "chunk_size".
+ *
+ * @param input input data in JSON format
+ * @param format pointer to the stream format
+ * @param chunk_size pointer to the chunk size
+ * @param output pointer to JSON output (error message)
+ * @return return code: 0 - success, otherwise - error
+ */
+static int ParseStreamOptions(const nlohmann::json& input,
+                              PointFormat* format, size_t* chunk_size,
+                              nlohmann::json* output) {
+  if (input.contains("format")) {
+    if (input["format"] == "csv") {
+      *format = PointFormat::Csv;
+    } else if (input["format"] == "binary") {
+      *format = PointFormat::Binary;
+    } else {
+      (*output)["error"] = "'format' must be 'csv' or 'binary'";
+      return 2;
+    }
+  }
+
+  if (input.contains("chunk_size")) {
+    if (!input["chunk_size"].is_number_unsigned() ||
+        input["chunk_size"].get<size_t>() == 0 ||
+        input["chunk_size"].get<size_t>() > maxChunkSize) {
+      (*output)["error"] = "'chunk_size' must be an integer in [1, " +
+                           std::to_string(maxChunkSize) + "]";
+      return 3;
+    }
+
+    *chunk_size = input["chunk_size"].get<size_t>();
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Write the hull and the memory statistics to the output.
+ *
+ * @param hull streaming convex hull
+ * @param output pointer to JSON output
+ */
+static void WriteStreamingHull(StreamingConvexHull<double>* hull,
+                               nlohmann::json* output) {
+  nlohmann::json hull_json = nlohmann::json::array();
+
+  for (const auto& point : hull->Hull())
+    hull_json.push_back({{"x", point.X()}, {"y", point.Y()}});
+
+  (*output)["convex_hull"] = hull_json;
+  (*output)["hull_size"] = hull->Hull().size();
+  (*output)["num_points"] = hull->NumPoints();
+  (*output)["chunk_size"] = hull->ChunkSize();
+  (*output)["peak_points"] = hull->PeakPoints();
+  (*output)["peak_rss_kb"] = PeakResidentSetSizeKb();
+}
+
+int StreamingConvexHullMethod(const nlohmann::json& input,
+                              nlohmann::json* output) {
+  try {
+    if (!input.contains("file") || !input["file"].is_string()) {
+      (*output)["error"] = "Input must contain 'file' string";
+      return 1;
+    }
+
+    PointFormat format = PointFormat::Csv;
+    size_t chunk_size = 1 << 16;
+
+    if (int result = ParseStreamOptions(input, &format, &chunk_size, output))
+      return result;
+
+    std::filesystem::path path;
+
+    if (!ResolveDataFile(input["file"].get<std::string>(), &path)) {
+      (*output)["error"] = "Cannot open 'file'";
+      return 4;
+    }
+
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if (!file) {
+      (*output)["error"] = "Cannot open 'file'";
+      return 4;
+    }
+
+    StreamingConvexHull<double> hull(chunk_size);
+
+    try {
+      ReadPoints<double>(file, format, [&hull](const Point<double>& point) {
+        hull.Insert(point);
+      });
+    } catch (const std::invalid_argument& e) {
+      (*output)["error"] = e.what();
+      return 5;
+    }
+
+    WriteStreamingHull(&hull, output);
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+int StreamingConvexHullUploadMethod(const nlohmann::json& input,
+                                    const ContentSource& content,
+                                    nlohmann::json* output) {
+  try {
+    PointFormat format = PointFormat::Csv;
+    size_t chunk_size = 1 << 16;
+
+    if (int result = ParseStreamOptions(input, &format, &chunk_size, output))
+      return result;
+
+    StreamingConvexHull<double> hull(chunk_size);
+    PointStreamParser<double> parser(format);
+    auto insert = [&hull](const Point<double>& point) {
+      hull.Insert(point);
+    };
+
+    try {
+      bool received = content([&](const char* data, size_t size) {
+        parser.Feed(data, size, insert);
+        return true;
+      });
+
+      if (!received) {
+        (*output)["error"] = "Failed to receive the request body";
+        return 6;
+      }
+
+      parser.Finish(insert);
+    } catch (const std::invalid_argument& e) {
+      (*output)["error"] = e.what();
+      return 5;
+    }
+
+    WriteStreamingHull(&hull, output);
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+}  // namespace geometry
+
+/**
+ * /StreamingConvexHull reads points from a file on the server in blocks
+ * and keeps at most chunk_size new points plus the current hull in memory,
+ * so the file may be larger than the RAM. Only files inside the data
+ * directory may be read: the second command line argument of the server,
+ * or "geometry_data" in the system temporary directory by default.
+ * Input JSON structure:
+ * {
+ *   "file" : "points.csv",
+ *   "format" : "csv",
+ *   "chunk_size" : 65536
+ * }
+ *
+ * "format" is "csv" (default; one "x,y" point per line, '#' comments and
+ * an optional header line) or "binary" (pairs of native-endian doubles).
+ * "file" is relative to the data directory or an absolute path inside it.
+ * "chunk_size" (default 65536, at most 2^24) is the number of new points
+ * after which the hull is rebuilt.
+ *
+ * /StreamingConvexHull/Upload takes the points as the request body, which
+ * may be sent with chunked transfer encoding; it is parsed while it is
+ * received. "format" and "chunk_size" are passed as query parameters:
+ * /StreamingConvexHull/Upload?format=binary&chunk_size=65536.
+ *
+ * Output JSON structure:
+ * {
+ *   "convex_hull" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 2.0, "y": 0.0},
+ *     {"x": 1.0, "y": 1.0}
+ *   ],
+ *   "hull_size" : 3,
+ *   "num_points" : 4,
+ *   "chunk_size" : 65536,
+ *   "peak_points" : 4,
+ *   "peak_rss_kb" : 5120
+ * }
+ *
+ * "peak_points" is the largest number of points held at once (at most
+ * hull size + chunk_size). "peak_rss_kb" is the peak resident set size of
+ * the whole server process since start (0 where it is not available).
+ *
+ * The hull is computed with the exact predicate, so it is the same as
+ * /GrahamScan with "predicate": "exact" for all points.
+ *
+ * Return codes: 1 - no 'file', 2 - invalid 'format', 3 - invalid
+ * 'chunk_size', 4 - the file cannot be opened or is outside the data
+ * directory, 5 - malformed data (including NaN or infinite coordinates
+ * and CSV lines longer than 1024 bytes), 6 - the request body was not
+ * received.
+ */
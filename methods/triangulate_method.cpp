@@ -0,0 +1,117 @@
+/**
+ * @file methods/triangulate_method.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * @brief Simple polygon triangulation method.
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/polygon_triangulation.hpp"
+#include "../include/predicates.hpp"
+
+namespace geometry {
+
+int TriangulateMethod(const nlohmann::json& input, nlohmann::json* output) {
+  try {
+    if (!input.contains("polygon") || !input["polygon"].is_array()) {
+      (*output)["error"] = "Input must contain 'polygon' array";
+      return 1;
+    }
+
+    std::vector<Point<double>> polygon;
+
+    polygon.reserve(input["polygon"].size());
+
+    for (const auto& point_json : input["polygon"]) {
+      if (!point_json.is_object() ||
+          !point_json.contains("x") || !point_json["x"].is_number() ||
+          !point_json.contains("y") || !point_json["y"].is_number()) {
+        (*output)["error"] = "Each polygon point must have 'x' & 'y'";
+        return 2;
+      }
+
+      polygon.emplace_back(point_json["x"].get<double>(),
+                           point_json["y"].get<double>());
+    }
+
+    if (polygon.size() < 3) {
+      (*output)["error"] = "Polygon must have at least 3 points";
+      return 3;
+    }
+
+    std::string predicate = "tolerance";
+
+    if (input.contains("predicate")) {
+      if (!input["predicate"].is_string() ||
+          (input["predicate"] != "tolerance" &&
+           input["predicate"] != "exact")) {
+        (*output)["error"] = "'predicate' must be 'tolerance' or 'exact'";
+        return 4;
+      }
+
+      predicate = input["predicate"].get<std::string>();
+    }
+
+    std::vector<uint32_t> triangles;
+
+    try {
+      if (predicate == "exact")
+        triangles = TriangulatePolygon(polygon, AdaptiveOrientationPolicy());
+      else
+        triangles = TriangulatePolygon(polygon);
+    } catch (const std::invalid_argument& e) {
+      (*output)["error"] = e.what();
+      return 5;
+    }
+
+    (*output)["triangles_count"] = triangles.size() / 3;
+    (*output)["triangles"] = std::move(triangles);
+    (*output)["vertices_count"] = polygon.size();
+
+    return 0;
+  } catch (const std::exception& e) {
+    (*output)["error"] = std::string("Exception: ") + e.what();
+    return -1;
+  }
+}
+
+}  // namespace geometry
+
+/**
+ * Input JSON structure:
+ * {
+ *   "polygon" : [
+ *     {"x": 0.0, "y": 0.0},
+ *     {"x": 4.0, "y": 0.0},
+ *     {"x": 4.0, "y": 4.0},
+ *     {"x": 2.0, "y": 1.0},
+ *     {"x": 0.0, "y": 4.0}
+ *   ],
+ *   "predicate" : "exact"
+ * }
+ *
+ * The polygon must be simple; its vertices may go in either direction. It
+ * is cut into y-monotone pieces by a sweep line, and every piece is
+ * triangulated in linear time, O(n log n) in total. The optional
+ * "predicate" field selects the orientation predicate as in /GrahamScan:
+ * "tolerance" (default) or "exact".
+ *
+ * Output JSON structure:
+ * {
+ *   "triangles" : [1, 2, 3, 1, 3, 0, 0, 3, 4],
+ *   "triangles_count" : 3,
+ *   "vertices_count" : 5
+ * }
+ *
+ * "triangles" is a flat index buffer: every three consecutive numbers are
+ * the indices of the vertices of one triangle in the input, in
+ * counterclockwise order. There are n - 2 triangles.
+ *
+ * Return codes: 1 - no 'polygon' array, 2 - a vertex without numeric 'x'
+ * and 'y', 3 - fewer than 3 vertices, 4 - invalid 'predicate', 5 - the
+ * polygon is not simple (the sweep found a self-touching boundary).
+ */
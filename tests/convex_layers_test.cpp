@@ -0,0 +1,162 @@
+/**
+ * @file tests/convex_layers_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для функции ConvexLayers().
+ */
+
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <convex_layers.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::AdaptiveOrientationPolicy;
+
+template<typename T>
+static void RandomTest();
+
+static void SimpleTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для функции geometry::ConvexLayers().
+ */
+void TestConvexLayers() {
+  TestSuite suite("TestConvexLayers");
+
+  RUN_TEST(suite, RandomTest<float>);
+  RUN_TEST(suite, RandomTest<double>);
+  RUN_TEST(suite, RandomTest<int>);
+}
+
+/**
+ * @brief Набор тестов для метода /ConvexLayers.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestConvexLayersMethod(httplib::Client* cli) {
+  TestSuite suite("TestConvexLayersMethod");
+
+  RUN_TEST_REMOTE(suite, cli, SimpleTest);
+}
+
+/**
+ * @brief Сравнение с повторным вызовом geometry::GrahamScan().
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Точка принадлежит слою, если она лежит на границе оболочки оставшихся
+ * точек. Если оболочка вырождена в отрезок или точку, то слою
+ * принадлежат все оставшиеся точки.
+ */
+template<typename T>
+static void RandomTest() {
+  const int numTries = 40;
+  const int maxPoints = 300;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> sizeDist(1, maxPoints);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-6, 6);
+  AdaptiveOrientationPolicy orientation;
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<Point<T>> points(sizeDist(gen));
+
+    for (auto& point : points) {
+      if (it % 2 == 0)
+        point = Point<T>(T(coordDist(gen)), T(coordDist(gen)));
+      else
+        point = Point<T>(T(gridDist(gen)), T(gridDist(gen)));
+    }
+
+    std::vector<std::vector<std::size_t>> contours;
+    std::vector<std::size_t> layers = geometry::ConvexLayers(points,
+                                                             &contours);
+    std::vector<std::size_t> remaining(points.size());
+
+    for (std::size_t i = 0; i < remaining.size(); i++)
+      remaining[i] = i;
+
+    for (std::size_t layer = 0; !remaining.empty(); layer++) {
+      std::vector<Point<T>> subset;
+
+      for (std::size_t i : remaining)
+        subset.push_back(points[i]);
+
+      std::vector<Point<T>> hull = geometry::GrahamScan(subset, orientation);
+      std::vector<std::size_t> next;
+
+      REQUIRE(layer < contours.size());
+      REQUIRE_EQUAL(contours[layer].size(), hull.size());
+
+      for (std::size_t i = 0; i < hull.size(); i++) {
+        REQUIRE(points[contours[layer][i]].X() == hull[i].X());
+        REQUIRE(points[contours[layer][i]].Y() == hull[i].Y());
+      }
+
+      for (std::size_t i : remaining) {
+        bool boundary = hull.size() < 3;
+
+        for (std::size_t j = 0; !boundary && j < hull.size(); j++) {
+          boundary = orientation(hull[j], hull[(j + 1) % hull.size()],
+                                 points[i]) == 0;
+        }
+
+        if (boundary)
+          REQUIRE_EQUAL(layers[i], layer);
+        else
+          next.push_back(i);
+      }
+
+      remaining = next;
+    }
+  }
+}
+
+/**
+ * @brief Простой тест для метода /ConvexLayers.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void SimpleTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0},
+        {"x": 6.0, "y": 0.0},
+        {"x": 3.0, "y": 6.0},
+        {"x": 3.0, "y": 0.0},
+        {"x": 3.0, "y": 2.0},
+        {"x": 2.0, "y": 1.0},
+        {"x": 4.0, "y": 1.0},
+        {"x": 3.0, "y": 1.5}
+      ],
+      "contours" : true
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/ConvexLayers", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["layers"] == nlohmann::json({0, 0, 0, 0, 1, 1, 1, 2}));
+  REQUIRE_EQUAL(output["num_layers"].get<int>(), 3);
+  REQUIRE_EQUAL(output["contours"].size(), 3u);
+  REQUIRE_EQUAL(output["contours"][0].size(), 3u);
+
+  input["predicate"] = "random";
+
+  res = cli->Post("/ConvexLayers", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
@@ -0,0 +1,380 @@
+/**
+ * @file tests/dynamic_convex_hull_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса DynamicConvexHull.
+ */
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <dynamic_convex_hull.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::DynamicConvexHull;
+using geometry::AdaptiveOrientationPolicy;
+
+template<typename T>
+static void BuildTest();
+
+template<typename T>
+static void RandomTest();
+
+template<typename T>
+static void ContainsTest();
+
+template<typename T>
+static void UndoTest();
+
+static void SessionTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для класса geometry::DynamicConvexHull.
+ */
+void TestDynamicConvexHull() {
+  TestSuite suite("TestDynamicConvexHull");
+
+  RUN_TEST(suite, BuildTest<float>);
+  RUN_TEST(suite, BuildTest<double>);
+  RUN_TEST(suite, BuildTest<long double>);
+  RUN_TEST(suite, BuildTest<int>);
+  RUN_TEST(suite, RandomTest<float>);
+  RUN_TEST(suite, RandomTest<double>);
+  RUN_TEST(suite, RandomTest<int>);
+  RUN_TEST(suite, ContainsTest<double>);
+  RUN_TEST(suite, UndoTest<double>);
+  RUN_TEST(suite, UndoTest<int>);
+}
+
+/**
+ * @brief Набор тестов для сессий /DynamicConvexHull.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestDynamicConvexHullSession(httplib::Client* cli) {
+  TestSuite suite("TestDynamicConvexHullSession");
+
+  RUN_TEST_REMOTE(suite, cli, SessionTest);
+}
+
+/**
+ * @brief Простые тесты для небольшого числа точек.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ */
+template<typename T>
+static void BuildTest() {
+  DynamicConvexHull<T> hull;
+
+  REQUIRE(hull.Empty());
+  REQUIRE_EQUAL(hull.Size(), 0u);
+  REQUIRE(hull.Hull().empty());
+  REQUIRE(!hull.Contains(Point<T>(T(0), T(0))));
+
+  REQUIRE(hull.Insert(Point<T>(T(0), T(0))));
+  REQUIRE(!hull.Insert(Point<T>(T(0), T(0))));
+  REQUIRE_EQUAL(hull.Size(), 1u);
+  REQUIRE(hull.Contains(Point<T>(T(0), T(0))));
+
+  // Вертикальный отрезок.
+  REQUIRE(hull.Insert(Point<T>(T(0), T(2))));
+  REQUIRE(!hull.Insert(Point<T>(T(0), T(1))));
+  REQUIRE_EQUAL(hull.Size(), 2u);
+  REQUIRE(hull.Contains(Point<T>(T(0), T(1))));
+
+  REQUIRE(hull.Insert(Point<T>(T(4), T(0))));
+  REQUIRE(hull.Insert(Point<T>(T(4), T(2))));
+  REQUIRE(!hull.Insert(Point<T>(T(2), T(2))));
+  REQUIRE(!hull.Insert(Point<T>(T(1), T(1))));
+  REQUIRE(hull.Insert(Point<T>(T(2), T(3))));
+
+  std::vector<Point<T>> expected = {
+    Point<T>(T(0), T(0)),
+    Point<T>(T(4), T(0)),
+    Point<T>(T(4), T(2)),
+    Point<T>(T(2), T(3)),
+    Point<T>(T(0), T(2))
+  };
+  std::vector<Point<T>> result = hull.Hull();
+
+  REQUIRE_EQUAL(result.size(), expected.size());
+  REQUIRE_EQUAL(hull.Size(), expected.size());
+  REQUIRE_EQUAL(hull.NumPoints(), 9u);
+
+  for (std::size_t i = 0; i < result.size(); i++) {
+    REQUIRE(result[i].X() == expected[i].X());
+    REQUIRE(result[i].Y() == expected[i].Y());
+  }
+
+  REQUIRE(hull.Contains(Point<T>(T(2), T(2))));
+  REQUIRE(hull.Contains(Point<T>(T(4), T(1))));
+  REQUIRE(!hull.Contains(Point<T>(T(5), T(1))));
+  REQUIRE(!hull.Contains(Point<T>(T(1), T(3))));
+  REQUIRE(!hull.Contains(Point<T>(T(2), T(-1))));
+
+  hull.Clear();
+
+  REQUIRE(hull.Empty());
+  REQUIRE_EQUAL(hull.NumPoints(), 0u);
+}
+
+/**
+ * @brief Сравнение с geometry::GrahamScan() после каждого добавления.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Каждый второй тест использует маленькую целочисленную сетку, чтобы
+ * среди точек были повторяющиеся и коллинеарные.
+ */
+template<typename T>
+static void RandomTest() {
+  const int numTries = 40;
+  const int maxPoints = 200;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> sizeDist(2, maxPoints);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-4, 4);
+  AdaptiveOrientationPolicy orientation;
+
+  for (int it = 0; it < numTries; it++) {
+    int size = sizeDist(gen);
+    std::vector<Point<T>> points;
+    DynamicConvexHull<T> hull;
+
+    for (int i = 0; i < size; i++) {
+      if (it % 2 == 0)
+        points.emplace_back(T(coordDist(gen)), T(coordDist(gen)));
+      else
+        points.emplace_back(T(gridDist(gen)), T(gridDist(gen)));
+
+      std::size_t before = hull.Size();
+      std::vector<Point<T>> previous = hull.Hull();
+      bool changed = hull.Insert(points.back());
+      std::vector<Point<T>> expected = geometry::GrahamScan(points,
+                                                            orientation);
+      std::vector<Point<T>> result = hull.Hull();
+
+      // Для совпадающих точек GrahamScan() возвращает обе копии.
+      if (expected.size() == 2 &&
+          expected[0].X() == expected[1].X() &&
+          expected[0].Y() == expected[1].Y())
+        expected.pop_back();
+
+      REQUIRE_EQUAL(result.size(), expected.size());
+      REQUIRE_EQUAL(hull.Size(), expected.size());
+
+      for (std::size_t j = 0; j < result.size(); j++) {
+        REQUIRE(result[j].X() == expected[j].X());
+        REQUIRE(result[j].Y() == expected[j].Y());
+      }
+
+      bool same = result.size() == before;
+
+      for (std::size_t j = 0; same && j < result.size(); j++)
+        same = result[j].X() == previous[j].X() &&
+               result[j].Y() == previous[j].Y();
+
+      REQUIRE_EQUAL(changed, !same);
+    }
+  }
+}
+
+/**
+ * @brief Сравнение geometry::DynamicConvexHull::Contains() с проверкой
+ * всех рёбер оболочки.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ */
+template<typename T>
+static void ContainsTest() {
+  const int numTries = 20;
+  const int numPoints = 100;
+  const int numQueries = 500;
+
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-30, 30);
+  AdaptiveOrientationPolicy orientation;
+
+  for (int it = 0; it < numTries; it++) {
+    DynamicConvexHull<T> hull;
+
+    for (int i = 0; i < numPoints; i++)
+      hull.Insert(Point<T>(T(coordDist(gen)), T(coordDist(gen))));
+
+    std::vector<Point<T>> vertices = hull.Hull();
+
+    for (int i = 0; i < numQueries; i++) {
+      // Точки сетки иногда попадают на рёбра и в вершины.
+      Point<T> point(T(gridDist(gen)), T(gridDist(gen)));
+
+      if (i % 10 == 0)
+        point = vertices[i % vertices.size()];
+
+      bool expected = true;
+
+      for (std::size_t j = 0; j < vertices.size(); j++) {
+        const Point<T>& next = vertices[(j + 1) % vertices.size()];
+
+        if (orientation(vertices[j], next, point) < 0)
+          expected = false;
+      }
+
+      REQUIRE_EQUAL(hull.Contains(point), expected);
+    }
+  }
+}
+
+/**
+ * @brief Отмена добавлений возвращает прежние оболочки.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ */
+template<typename T>
+static void UndoTest() {
+  const int numTries = 20;
+  const int maxPoints = 200;
+
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> sizeDist(1, maxPoints);
+  std::uniform_int_distribution<int> gridDist(-6, 6);
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<Point<T>> points(sizeDist(gen));
+
+    for (auto& point : points)
+      point = Point<T>(T(gridDist(gen)), T(gridDist(gen)));
+
+    DynamicConvexHull<T> hull;
+    std::vector<std::vector<Point<T>>> history;
+
+    hull.EnableUndo(true);
+
+    for (const auto& point : points) {
+      history.push_back(hull.Hull());
+      hull.Insert(point);
+    }
+
+    while (!history.empty()) {
+      hull.Undo();
+
+      std::vector<Point<T>> result = hull.Hull();
+
+      REQUIRE_EQUAL(result.size(), history.back().size());
+      REQUIRE_EQUAL(hull.Size(), result.size());
+
+      for (std::size_t i = 0; i < result.size(); i++) {
+        REQUIRE(result[i].X() == history.back()[i].X());
+        REQUIRE(result[i].Y() == history.back()[i].Y());
+      }
+
+      history.pop_back();
+    }
+
+    REQUIRE(hull.Empty());
+    REQUIRE_EQUAL(hull.NumPoints(), 0u);
+    REQUIRE_THROW(hull.Undo(), std::logic_error);
+  }
+}
+
+/**
+ * @brief Тест сессии: добавление точек частями и чтение оболочки.
+ *
+ * @param cli Указатель на HTTP клиент.
+ *
+ * Оболочка сессии должна совпадать с результатом /GrahamScan для всех
+ * присланных точек.
+ */
+static void SessionTest(httplib::Client* cli) {
+  const int numBatches = 10;
+  const int batchSize = 50;
+
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+
+  httplib::Result res = cli->Post("/DynamicConvexHull/Create", "{}",
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+  std::uint64_t id = output["id"].get<std::uint64_t>();
+  nlohmann::json all;
+
+  REQUIRE_EQUAL(output["hull_size"].get<int>(), 0);
+
+  for (int batch = 0; batch < numBatches; batch++) {
+    nlohmann::json input;
+
+    input["id"] = id;
+
+    for (int i = 0; i < batchSize; i++) {
+      nlohmann::json point = {{"x", coordDist(gen)}, {"y", coordDist(gen)}};
+
+      input["points"].push_back(point);
+      all["points"].push_back(point);
+    }
+
+    res = cli->Post("/DynamicConvexHull/Insert", input.dump(),
+                    "application/json");
+
+    REQUIRE_EQUAL(200, res->status);
+
+    output = nlohmann::json::parse(res->body);
+
+    REQUIRE_EQUAL(output["num_points"].get<int>(), (batch + 1) * batchSize);
+
+    res = cli->Post("/DynamicConvexHull/Hull",
+                    nlohmann::json({{"id", id}}).dump(), "application/json");
+
+    REQUIRE_EQUAL(200, res->status);
+
+    output = nlohmann::json::parse(res->body);
+
+    all["predicate"] = "exact";
+
+    res = cli->Post("/GrahamScan", all.dump(), "application/json");
+
+    nlohmann::json expected = nlohmann::json::parse(res->body);
+
+    REQUIRE(output["convex_hull"] == expected["convex_hull"]);
+    REQUIRE(output["hull_size"] == expected["hull_size"]);
+  }
+
+  nlohmann::json input = {
+    {"id", id},
+    {"points", {{{"x", 0.0}, {"y", 0.0}}, {{"x", 1000.0}, {"y", 0.0}}}}
+  };
+
+  res = cli->Post("/DynamicConvexHull/Contains", input.dump(),
+                  "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["contains"] == nlohmann::json({true, false}));
+
+  input = {{"id", id}};
+
+  res = cli->Post("/DynamicConvexHull/Delete", input.dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  res = cli->Post("/DynamicConvexHull/Hull", input.dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  res = cli->Post("/DynamicConvexHull/Insert", "{\"points\": []}",
+                  "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
@@ -6,6 +6,9 @@
  */
 
 #include <httplib.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
 #include <vector>
 #include <random>
 #include <utility>
@@ -16,6 +19,13 @@
 static void SimpleConvexTest(httplib::Client* cli);
 static void CollinearPointsTest(httplib::Client* cli);
 static void RandomPointsTest(httplib::Client* cli);
+static void ExactPredicateTest(httplib::Client* cli);
+static void ParallelTest(httplib::Client* cli);
+static void PrefilterTest(httplib::Client* cli);
+static void AlgorithmTest(httplib::Client* cli);
+static void IndicesTest(httplib::Client* cli);
+static void SortTest(httplib::Client* cli);
+static void ApproximateTest(httplib::Client* cli);
 
 void TestGrahamScan(httplib::Client* cli) {
   TestSuite suite("TestGrahamScan");
@@ -23,6 +33,13 @@ void TestGrahamScan(httplib::Client* cli) {
   RUN_TEST_REMOTE(suite, cli, SimpleConvexTest);
   RUN_TEST_REMOTE(suite, cli, CollinearPointsTest);
   RUN_TEST_REMOTE(suite, cli, RandomPointsTest);
+  RUN_TEST_REMOTE(suite, cli, ExactPredicateTest);
+  RUN_TEST_REMOTE(suite, cli, ParallelTest);
+  RUN_TEST_REMOTE(suite, cli, PrefilterTest);
+  RUN_TEST_REMOTE(suite, cli, AlgorithmTest);
+  RUN_TEST_REMOTE(suite, cli, IndicesTest);
+  RUN_TEST_REMOTE(suite, cli, SortTest);
+  RUN_TEST_REMOTE(suite, cli, ApproximateTest);
 }
 
 /**
@@ -153,3 +170,455 @@ static void RandomPointsTest(httplib::Client* cli) {
     }
   }
 }
+
+/**
+ * @brief test with the exact orientation predicate
+ *
+ * @param cli pointer to HTTP client
+ */
+
+static void ExactPredicateTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0},
+        {"x": 1.0, "y": 1.0},
+        {"x": 2.0, "y": 2.0},
+        {"x": 3.0, "y": 1.0},
+        {"x": 2.0, "y": 0.0},
+        {"x": 1.0, "y": 0.0}
+      ],
+      "predicate" : "exact"
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/GrahamScan",
+                                  input.dump(), "application/json");
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE_EQUAL(4, output["hull_size"]);
+  REQUIRE_EQUAL(6, output["original_size"]);
+  REQUIRE(output["predicate_statistics"]["calls"].get<uint64_t>() > 0);
+  REQUIRE(output["predicate_statistics"]["exact_calls"].get<uint64_t>() <=
+          output["predicate_statistics"]["calls"].get<uint64_t>());
+
+  input["predicate"] = "unknown";
+
+  res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
+
+/**
+ * @brief parallel hull must match the sequential one exactly
+ *
+ * @param cli pointer to HTTP client
+ */
+
+static void ParallelTest(httplib::Client* cli) {
+  const int numTries = 20;
+  const int maxPoints = 1000;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<size_t> sizeDist(1, maxPoints);
+  std::uniform_int_distribution<size_t> threadsDist(2, 8);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-5, 5);
+
+  for (int it = 0; it < numTries; it++) {
+    size_t size = sizeDist(gen);
+    nlohmann::json input;
+
+    // Every second test uses a small integer grid, so that the input
+    // contains duplicates and collinear points.
+    for (size_t i = 0; i < size; i++) {
+      if (it % 2 == 0) {
+        input["points"][i]["x"] = coordDist(gen);
+        input["points"][i]["y"] = coordDist(gen);
+      } else {
+        input["points"][i]["x"] = gridDist(gen);
+        input["points"][i]["y"] = gridDist(gen);
+      }
+    }
+
+    input["predicate"] = "exact";
+    input["threads"] = 1;
+
+    httplib::Result res = cli->Post("/GrahamScan",
+                                    input.dump(), "application/json");
+
+    nlohmann::json expected = nlohmann::json::parse(res->body);
+
+    input["threads"] = threadsDist(gen);
+
+    res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+    nlohmann::json output = nlohmann::json::parse(res->body);
+
+    REQUIRE_EQUAL(expected["hull_size"], output["hull_size"]);
+    REQUIRE(expected["convex_hull"] == output["convex_hull"]);
+
+    // The parallel hull is exact with the default predicate too.
+    input.erase("predicate");
+
+    res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+    output = nlohmann::json::parse(res->body);
+
+    REQUIRE_EQUAL(expected["hull_size"], output["hull_size"]);
+    REQUIRE(expected["convex_hull"] == output["convex_hull"]);
+  }
+}
+
+/**
+ * @brief the prefilter must not change the hull
+ *
+ * @param cli pointer to HTTP client
+ */
+
+static void PrefilterTest(httplib::Client* cli) {
+  const int numTries = 20;
+  const int maxPoints = 2000;
+
+  std::mt19937 gen(2);
+  std::uniform_int_distribution<size_t> sizeDist(1, maxPoints);
+  std::normal_distribution<double> coordDist(0.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-5, 5);
+
+  for (int it = 0; it < numTries; it++) {
+    size_t size = sizeDist(gen);
+    nlohmann::json input;
+
+    for (size_t i = 0; i < size; i++) {
+      if (it % 2 == 0) {
+        input["points"][i]["x"] = coordDist(gen);
+        input["points"][i]["y"] = coordDist(gen);
+      } else {
+        input["points"][i]["x"] = gridDist(gen);
+        input["points"][i]["y"] = gridDist(gen);
+      }
+    }
+
+    input["predicate"] = "exact";
+
+    httplib::Result res = cli->Post("/GrahamScan",
+                                    input.dump(), "application/json");
+
+    nlohmann::json expected = nlohmann::json::parse(res->body);
+
+    input["prefilter"] = true;
+
+    res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+    nlohmann::json output = nlohmann::json::parse(res->body);
+
+    REQUIRE(expected["convex_hull"] == output["convex_hull"]);
+    REQUIRE(output["eliminated"].get<size_t>() <= size);
+
+    // In a large normally distributed cloud most points are interior.
+    if (it % 2 == 0 && size >= 1000)
+      REQUIRE(output["eliminated"].get<size_t>() * 2 >= size);
+  }
+}
+
+/**
+ * @brief all algorithms must return the same hull
+ *
+ * @param cli pointer to HTTP client
+ */
+
+static void AlgorithmTest(httplib::Client* cli) {
+  const int numTries = 20;
+  const int maxPoints = 5000;
+
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<size_t> sizeDist(1, maxPoints);
+  std::normal_distribution<double> coordDist(0.0, 100.0);
+  std::uniform_real_distribution<double> angleDist(0.0, 6.28);
+  std::uniform_int_distribution<int> gridDist(-5, 5);
+
+  for (int it = 0; it < numTries; it++) {
+    size_t size = sizeDist(gen);
+    nlohmann::json input;
+
+    // Normal cloud, points on a circle and a grid with duplicates.
+    for (size_t i = 0; i < size; i++) {
+      if (it % 3 == 0) {
+        input["points"][i]["x"] = coordDist(gen);
+        input["points"][i]["y"] = coordDist(gen);
+      } else if (it % 3 == 1) {
+        double angle = angleDist(gen);
+
+        input["points"][i]["x"] = std::cos(angle);
+        input["points"][i]["y"] = std::sin(angle);
+      } else {
+        input["points"][i]["x"] = gridDist(gen);
+        input["points"][i]["y"] = gridDist(gen);
+      }
+    }
+
+    input["predicate"] = "exact";
+
+    httplib::Result res = cli->Post("/GrahamScan",
+                                    input.dump(), "application/json");
+
+    nlohmann::json expected = nlohmann::json::parse(res->body);
+
+    REQUIRE(expected["algorithm"] == "graham");
+
+    for (const char* algorithm : {"chan", "quickhull", "auto"}) {
+      input["algorithm"] = algorithm;
+
+      res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+      nlohmann::json output = nlohmann::json::parse(res->body);
+
+      REQUIRE(expected["convex_hull"] == output["convex_hull"]);
+
+      if (std::string(algorithm) != "auto")
+        REQUIRE(output["algorithm"] == algorithm);
+      else
+        REQUIRE(output["algorithm"] != "auto");
+    }
+  }
+
+  nlohmann::json input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0}
+      ],
+      "algorithm" : "unknown"
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/GrahamScan",
+                                  input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
+
+/**
+ * @brief indices must refer to the points of the default output
+ *
+ * @param cli pointer to HTTP client
+ */
+
+static void IndicesTest(httplib::Client* cli) {
+  const int numTries = 20;
+  const int maxPoints = 1000;
+
+  std::mt19937 gen(4);
+  std::uniform_int_distribution<size_t> sizeDist(1, maxPoints);
+  std::uniform_int_distribution<int> gridDist(-20, 20);
+
+  for (int it = 0; it < numTries; it++) {
+    size_t size = sizeDist(gen);
+    nlohmann::json input;
+
+    for (size_t i = 0; i < size; i++) {
+      input["points"][i]["x"] = gridDist(gen);
+      input["points"][i]["y"] = gridDist(gen);
+    }
+
+    httplib::Result res = cli->Post("/GrahamScan",
+                                    input.dump(), "application/json");
+
+    nlohmann::json expected = nlohmann::json::parse(res->body);
+
+    input["output"] = "indices";
+
+    res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+    nlohmann::json output = nlohmann::json::parse(res->body);
+
+    REQUIRE(!output.contains("convex_hull"));
+    REQUIRE_EQUAL(expected["hull_size"], output["hull_size"]);
+    REQUIRE_EQUAL(expected["hull_size"], output["hull_indices"].size());
+
+    for (size_t i = 0; i < output["hull_indices"].size(); i++) {
+      size_t index = output["hull_indices"][i].get<size_t>();
+
+      REQUIRE(index < size);
+      REQUIRE(input["points"][index]["x"] == expected["convex_hull"][i]["x"]);
+      REQUIRE(input["points"][index]["y"] == expected["convex_hull"][i]["y"]);
+    }
+  }
+
+  nlohmann::json input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0}
+      ],
+      "output" : "indices",
+      "algorithm" : "chan"
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/GrahamScan",
+                                  input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  input["algorithm"] = "graham";
+  input["output"] = "positions";
+
+  res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
+
+/**
+ * @brief radix sort must not change the hull
+ *
+ * @param cli pointer to HTTP client
+ */
+
+static void SortTest(httplib::Client* cli) {
+  const int numTries = 20;
+  const int maxPoints = 3000;
+
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<size_t> sizeDist(1, maxPoints);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-5, 5);
+
+  for (int it = 0; it < numTries; it++) {
+    size_t size = sizeDist(gen);
+    nlohmann::json input;
+
+    for (size_t i = 0; i < size; i++) {
+      if (it % 2 == 0) {
+        input["points"][i]["x"] = coordDist(gen);
+        input["points"][i]["y"] = coordDist(gen);
+      } else {
+        input["points"][i]["x"] = gridDist(gen);
+        input["points"][i]["y"] = gridDist(gen);
+      }
+    }
+
+    httplib::Result res = cli->Post("/GrahamScan",
+                                    input.dump(), "application/json");
+
+    nlohmann::json expected = nlohmann::json::parse(res->body);
+
+    input["sort"] = "radix";
+    input["threads"] = it % 4 == 0 ? 2 : 1;
+
+    res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+    nlohmann::json output = nlohmann::json::parse(res->body);
+
+    REQUIRE(expected["convex_hull"] == output["convex_hull"]);
+  }
+
+  nlohmann::json input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0}
+      ],
+      "sort" : "bubble"
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/GrahamScan",
+                                  input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
+
+/**
+ * @brief every point must lie within error_bound of the approximate hull
+ *
+ * @param cli pointer to HTTP client
+ */
+
+static void ApproximateTest(httplib::Client* cli) {
+  const int numTries = 10;
+  const int maxPoints = 3000;
+
+  std::mt19937 gen(6);
+  std::uniform_int_distribution<size_t> sizeDist(1, maxPoints);
+  std::normal_distribution<double> coordDist(0.0, 100.0);
+
+  for (int it = 0; it < numTries; it++) {
+    size_t size = sizeDist(gen);
+    nlohmann::json input;
+    std::vector<std::pair<double, double>> points(size);
+
+    for (size_t i = 0; i < size; i++) {
+      points[i] = {coordDist(gen), coordDist(gen)};
+      input["points"][i]["x"] = points[i].first;
+      input["points"][i]["y"] = points[i].second;
+    }
+
+    if (it % 2 == 0)
+      input["epsilon"] = 0.05;
+    else
+      input["strips"] = 7;
+
+    httplib::Result res = cli->Post("/GrahamScan",
+                                    input.dump(), "application/json");
+
+    REQUIRE_EQUAL(200, res->status);
+
+    nlohmann::json output = nlohmann::json::parse(res->body);
+
+    REQUIRE(output["algorithm"] == "approximate");
+    REQUIRE_EQUAL(output["strips"].get<int>(), it % 2 == 0 ? 20 : 7);
+
+    double bound = output["error_bound"].get<double>();
+    const nlohmann::json& hull = output["convex_hull"];
+    size_t h = hull.size();
+
+    for (const auto& [x, y] : points) {
+      bool inside = h >= 3;
+      double distance = h == 0 ? 0.0 : INFINITY;
+
+      for (size_t i = 0; i < h; i++) {
+        double ax = hull[i]["x"], ay = hull[i]["y"];
+        double bx = hull[(i + 1) % h]["x"], by = hull[(i + 1) % h]["y"];
+        double dx = bx - ax, dy = by - ay;
+        double length = dx * dx + dy * dy;
+        double t = length > 0.0 ?
+            std::max(0.0, std::min(1.0, ((x - ax) * dx + (y - ay) * dy) /
+                                        length)) : 0.0;
+
+        inside = inside && dx * (y - ay) - dy * (x - ax) >= 0.0;
+        distance = std::min(distance, std::hypot(x - ax - t * dx,
+                                                 y - ay - t * dy));
+      }
+
+      REQUIRE(inside || distance <= bound * (1.0 + 1e-9));
+    }
+  }
+
+  nlohmann::json input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0}
+      ],
+      "epsilon" : 0.0
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/GrahamScan",
+                                  input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  // Слишком малая погрешность: число полос не помещается в size_t.
+  for (double epsilon : {1e-7, 1e-20, 1e-300}) {
+    input["epsilon"] = epsilon;
+    res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+    REQUIRE_EQUAL(400, res->status);
+  }
+
+  input["epsilon"] = 0.5;
+  input["output"] = "indices";
+
+  res = cli->Post("/GrahamScan", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
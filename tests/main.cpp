@@ -23,6 +23,21 @@ int main(int argc, char* argv[]) {
   TestEdge();
   TestPolygon();
   TestOrientation();
+  TestPointBuffer();
+  TestPredicates();
+  TestPointSort();
+  TestDynamicConvexHull();
+  TestStreamingConvexHull();
+  TestConvexLayers();
+  TestRotatingCalipers();
+  TestSlidingWindowConvexHull();
+  TestPointInPolygon();
+  TestPolygonLocator();
+  TestPolygonGrid();
+  TestPolygonSet();
+  TestPolygonWithHoles();
+  TestPolygonTriangulation();
+  TestMonotonePolygonTriangulation();
 
   if (argc >= 2) {
     // Меняем хост, если предоставлен соответствующий аргумент командной строки.
@@ -43,6 +58,16 @@ int main(int argc, char* argv[]) {
   /* Сюда нужно вставить вызов набора тестов для алгоритма. */
 
   TestGrahamScan(&cli);
+  TestDynamicConvexHullSession(&cli);
+  TestStreamingConvexHullMethod(&cli);
+  TestConvexLayersMethod(&cli);
+  TestRotatingCalipersMethod(&cli);
+  TestSlidingWindowConvexHullSession(&cli);
+  TestPointInPolygonMethod(&cli);
+  TestPolygonSetSession(&cli);
+  TestPolygonWithHolesMethod(&cli);
+  TestTriangulateMethod(&cli);
+  TestMonotonePolygonTriangulationMethod(&cli);
 
   /* Конец вставки. */
 
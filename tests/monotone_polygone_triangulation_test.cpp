@@ -2,27 +2,247 @@
  * @file tests/monotone_polygone_triangulation_test.cpp
  * @author Taisiya Osipova
  *
- * @brief Realization of a set of tests for the Monotone Polygon Triangulation algorithm
+ * @brief Realization of a set of tests for the Monotone Polygon
+ * Triangulation algorithm
  */
 
-#include <httplib.h>
-#include <vector>
-#include <random>
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <point_in_polygon.hpp>
+#include <monotone_polygone_triangulation.hpp>
 #include <nlohmann/json.hpp>
 #include "test_core.hpp"
 #include "test.hpp"
 
+using geometry::Point;
+
+static std::vector<Point<double>> RandomMonotonePolygon(std::mt19937* gen,
+                                                        size_t size);
+static std::vector<std::pair<size_t, size_t>> CheckDiagonals(
+    const std::vector<Point<double>>& polygon,
+    const std::vector<uint32_t>& triangles);
+static void RandomMonotoneTest();
 static void SimpleMonotoneTest(httplib::Client* cli);
 static void SquareTest(httplib::Client* cli);
-static void RandomMonotoneTest(httplib::Client* cli);
+static void MethodTest(httplib::Client* cli);
 
-void TestMonotonePolygonTriangulation(httplib::Client* cli) {
+/**
+ * @brief Set of tests for TriangulateMonotonePolygon()
+ */
+void TestMonotonePolygonTriangulation() {
     TestSuite suite("TestMonotonePolygonTriangulation");
 
+    RUN_TEST(suite, RandomMonotoneTest);
+}
+
+/**
+ * @brief Set of tests for the /MonotonePolygonTriangulation method
+ *
+ * @param cli pointer to HTTP client
+ */
+void TestMonotonePolygonTriangulationMethod(httplib::Client* cli) {
+    TestSuite suite("TestMonotonePolygonTriangulationMethod");
+
     RUN_TEST_REMOTE(suite, cli, SimpleMonotoneTest);
     RUN_TEST_REMOTE(suite, cli, SquareTest);
-    RUN_TEST_REMOTE(suite, cli, RandomMonotoneTest);
+    RUN_TEST_REMOTE(suite, cli, MethodTest);
+}
+
+/**
+ * @brief Sign of the cross product (b - a) x (c - a)
+ */
+static int Orient(const Point<double>& a, const Point<double>& b,
+                  const Point<double>& c) {
+    double cross = (b.X() - a.X()) * (c.Y() - a.Y()) -
+                   (b.Y() - a.Y()) * (c.X() - a.X());
+    return (cross > 0) - (cross < 0);
+}
+
+/**
+ * @brief Check whether two segments have a common point
+ */
+static bool Intersect(const Point<double>& a, const Point<double>& b,
+                      const Point<double>& c, const Point<double>& d) {
+    int abc = Orient(a, b, c), abd = Orient(a, b, d);
+    int cda = Orient(c, d, a), cdb = Orient(c, d, b);
+
+    if (abc * abd < 0 && cda * cdb < 0) return true;
+
+    auto onSegment = [](const Point<double>& p, const Point<double>& q,
+                        const Point<double>& r) {
+        return Orient(p, q, r) == 0 &&
+               std::min(p.X(), q.X()) <= r.X() &&
+               r.X() <= std::max(p.X(), q.X()) &&
+               std::min(p.Y(), q.Y()) <= r.Y() &&
+               r.Y() <= std::max(p.Y(), q.Y());
+    };
+
+    return onSegment(a, b, c) || onSegment(a, b, d) ||
+           onSegment(c, d, a) || onSegment(c, d, b);
+}
+
+/**
+ * @brief Generate a random simple y-monotone polygon
+ *
+ * @param gen random number generator
+ * @param size number of vertices
+ * @return counterclockwise vertices starting from a random one
+ *
+ * Every vertex has its own integer y. The vertices between the top and
+ * the bottom are spread over the two chains at random; both chains
+ * follow a random walk around a common center line, so they have reflex
+ * vertices on both sides. Polygons whose chains touch or that have three
+ * collinear consecutive vertices are rejected.
+ */
+static std::vector<Point<double>> RandomMonotonePolygon(std::mt19937* gen,
+                                                        size_t size) {
+    std::uniform_int_distribution<int> stepDist(-6, 6);
+    std::uniform_int_distribution<int> widthDist(1, 8);
+    std::bernoulli_distribution coin(0.5);
+
+    while (true) {
+        std::vector<Point<double>> left, right;
+        int center = 0;
+
+        for (size_t i = 1; i + 1 < size; ++i) {
+            center += stepDist(*gen);
+            int y = static_cast<int>(size - 1 - i);
+            int width = widthDist(*gen);
+            if (coin(*gen))
+                left.emplace_back(center - width, y);
+            else
+                right.emplace_back(center + width, y);
+        }
+
+        // Counterclockwise: down the left chain, up the right one.
+        std::vector<Point<double>> polygon;
+        polygon.emplace_back(0.0, static_cast<double>(size - 1));
+        polygon.insert(polygon.end(), left.begin(), left.end());
+        polygon.emplace_back(center, 0.0);
+        polygon.insert(polygon.end(), right.rbegin(), right.rend());
+
+        const size_t n = polygon.size();
+        bool simple = true;
+
+        for (size_t i = 0; simple && i < n; ++i)
+            simple = Orient(polygon[(i + n - 1) % n], polygon[i],
+                            polygon[(i + 1) % n]) != 0;
+
+        for (size_t i = 0; simple && i < n; ++i) {
+            for (size_t j = i + 2; simple && j < n; ++j) {
+                if (i == 0 && j == n - 1) continue;
+                simple = !Intersect(polygon[i], polygon[i + 1], polygon[j],
+                                    polygon[(j + 1) % n]);
+            }
+        }
+
+        if (!simple) continue;
+
+        std::uniform_int_distribution<size_t> shiftDist(0, n - 1);
+        std::rotate(polygon.begin(), polygon.begin() + shiftDist(*gen),
+                    polygon.end());
+
+        return polygon;
+    }
+}
+
+/**
+ * @brief Check the diagonals of a triangulation
+ *
+ * @param polygon polygon vertices
+ * @param triangles vertex positions, three per triangle
+ * @return diagonals as pairs (from, to) with from < to, in ascending order
+ *
+ * The sides of the triangles that are not polygon edges must give n - 3
+ * distinct diagonals, each shared by two triangles; no two of them may
+ * cross and the midpoint of each must lie inside the polygon. Every
+ * polygon edge must be a side of exactly one triangle.
+ */
+static std::vector<std::pair<size_t, size_t>> CheckDiagonals(
+    const std::vector<Point<double>>& polygon,
+    const std::vector<uint32_t>& triangles) {
+    const size_t n = polygon.size();
+
+    REQUIRE_EQUAL(triangles.size(), 3 * (n - 2));
+
+    std::multiset<std::pair<size_t, size_t>> sides;
+
+    for (size_t i = 0; i < triangles.size(); i += 3) {
+        for (size_t k = 0; k < 3; ++k) {
+            size_t a = triangles[i + k], b = triangles[i + (k + 1) % 3];
+            REQUIRE(a < n);
+            REQUIRE(b < n);
+            REQUIRE(a != b);
+            sides.emplace(std::min(a, b), std::max(a, b));
+        }
+    }
+
+    std::vector<std::pair<size_t, size_t>> diagonals;
+
+    for (auto it = sides.begin(); it != sides.end();
+         it = sides.upper_bound(*it)) {
+        size_t count = sides.count(*it);
+        bool edge = it->second - it->first == 1 ||
+                    it->second - it->first == n - 1;
+
+        REQUIRE_EQUAL(count, edge ? size_t(1) : size_t(2));
+
+        if (!edge) diagonals.push_back(*it);
+    }
+
+    REQUIRE_EQUAL(diagonals.size(), n - 3);
+
+    geometry::Polygon<double, geometry::CyclicVector<Point<double>>> shape(
+        geometry::CyclicVector<Point<double>>(polygon.begin(),
+                                              polygon.end()));
+
+    for (size_t i = 0; i < diagonals.size(); ++i) {
+        const Point<double>& a = polygon[diagonals[i].first];
+        const Point<double>& b = polygon[diagonals[i].second];
+        Point<double> middle((a.X() + b.X()) / 2, (a.Y() + b.Y()) / 2);
+
+        REQUIRE(geometry::WindingNumberPointInPolygon(middle, shape) ==
+                geometry::PointPosition::INSIDE);
+
+        for (size_t j = i + 1; j < diagonals.size(); ++j) {
+            const Point<double>& c = polygon[diagonals[j].first];
+            const Point<double>& d = polygon[diagonals[j].second];
+
+            REQUIRE(Orient(a, b, c) * Orient(a, b, d) >= 0 ||
+                    Orient(c, d, a) * Orient(c, d, b) >= 0);
+        }
+    }
+
+    return diagonals;
+}
+
+/**
+ * @brief Random y-monotone polygons in both vertex orders
+ */
+static void RandomMonotoneTest() {
+    const int numTries = 2000;
+
+    std::mt19937 gen(23);
+    std::uniform_int_distribution<size_t> sizeDist(3, 60);
+
+    for (int it = 0; it < numTries; ++it) {
+        std::vector<Point<double>> polygon =
+            RandomMonotonePolygon(&gen, sizeDist(gen));
+
+        CheckDiagonals(polygon, geometry::TriangulateMonotonePolygon(polygon));
+
+        std::reverse(polygon.begin(), polygon.end());
+
+        CheckDiagonals(polygon, geometry::TriangulateMonotonePolygon(polygon));
+    }
 }
 
 /**
@@ -86,66 +306,92 @@ static void SquareTest(httplib::Client* cli) {
 }
 
 /**
- * @brief Random test with generated monotone polygons
+ * @brief Test of the /MonotonePolygonTriangulation method
  *
  * @param cli pointer to HTTP client
+ *
+ * The example from the method documentation is checked exactly. For
+ * random polygons "triangles" must be a valid triangulation and
+ * "diagonals" must be exactly the sides of its triangles that are not
+ * polygon edges.
  */
-static void RandomMonotoneTest(httplib::Client* cli) {
-    const int numTries = 20;
-    const int minVertices = 3;
-    const int maxVertices = 50;
-    const double minCoord = -100.0;
-    const double maxCoord = 100.0;
-
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<size_t> sizeDist(minVertices, maxVertices);
-    std::uniform_real_distribution<double> coordDist(minCoord, maxCoord);
-
-    for (int it = 0; it < numTries; it++) {
-        size_t size = sizeDist(gen);
-        nlohmann::json input;
-        std::vector<double> xCoords(size);
-        std::vector<double> yCoords(size);
-        for (size_t i = 0; i < size; i++) {
-            xCoords[i] = coordDist(gen);
-            yCoords[i] = coordDist(gen);
+static void MethodTest(httplib::Client* cli) {
+    nlohmann::json input = R"(
+        {
+            "polygon" : [
+                {"x": 0.0, "y": 4.0},
+                {"x": 2.0, "y": 3.0},
+                {"x": 1.0, "y": 1.0},
+                {"x": 4.0, "y": 0.0},
+                {"x": 0.0, "y": 0.0}
+            ]
         }
+    )"_json;
 
-        // сортируем по х-координате
-        std::sort(xCoords.begin(), xCoords.end());
-
-        // создаем две цепи
-        for (size_t i = 0; i < size; i++) {
-            if (i < size / 2) {
-                input["polygon"][i]["x"] = xCoords[i];
-                input["polygon"][i]["y"] = coordDist(gen) + 50.0;
-            } else {
-                size_t reverse_idx = size - 1 - (i - size / 2);
-                input["polygon"][i]["x"] = xCoords[reverse_idx];
-                input["polygon"][i]["y"] = coordDist(gen) - 50.0;
-            }
-        }
+    httplib::Result res = cli->Post("/MonotonePolygonTriangulation",
+                                    input.dump(), "application/json");
 
-        httplib::Result res = cli->Post("/MonotonePolygonTriangulation",
-                                        input.dump(), "application/json");
-        nlohmann::json output = nlohmann::json::parse(res->body);
-        REQUIRE_EQUAL(size, output["vertices_count"]);
-        // кол-во диагоналей должно быть n-3
-        if (size > 3) {
-            REQUIRE_EQUAL(size - 3, output["diagonals_count"]);
-        } else {
-            REQUIRE_EQUAL(0, output["diagonals_count"]);
-        }
+    REQUIRE_EQUAL(200, res->status);
+
+    nlohmann::json output = nlohmann::json::parse(res->body);
+
+    REQUIRE(output["triangles"] ==
+            nlohmann::json({2, 1, 0, 4, 2, 0, 3, 2, 4}));
+    REQUIRE_EQUAL(output["triangles_count"].get<int>(), 3);
+    REQUIRE(output["diagonals"] == R"(
+        [
+            {"from": 0, "to": 2},
+            {"from": 2, "to": 4}
+        ]
+    )"_json);
+    REQUIRE_EQUAL(output["diagonals_count"].get<int>(), 2);
+    REQUIRE_EQUAL(output["vertices_count"].get<int>(), 5);
+
+    std::mt19937 gen(25);
+    std::uniform_int_distribution<size_t> sizeDist(3, 40);
+
+    for (int it = 0; it < 20; ++it) {
+        std::vector<Point<double>> polygon =
+            RandomMonotonePolygon(&gen, sizeDist(gen));
+        nlohmann::json random;
+
+        for (const auto& point : polygon)
+            random["polygon"].push_back({{"x", point.X()}, {"y", point.Y()}});
+
+        res = cli->Post("/MonotonePolygonTriangulation", random.dump(),
+                        "application/json");
+
+        REQUIRE_EQUAL(200, res->status);
+
+        output = nlohmann::json::parse(res->body);
+
+        std::vector<std::pair<size_t, size_t>> expected = CheckDiagonals(
+            polygon, output["triangles"].get<std::vector<uint32_t>>());
+        std::vector<std::pair<size_t, size_t>> diagonals;
 
         for (const auto& diagonal : output["diagonals"]) {
-            int from = diagonal["from"];
-            int to = diagonal["to"];
-            REQUIRE(from >= 0);
-            REQUIRE(from < static_cast<int>(size));
-            REQUIRE(to >= 0);
-            REQUIRE(to < static_cast<int>(size));
-            REQUIRE(from != to);
+            size_t from = diagonal["from"].get<size_t>();
+            size_t to = diagonal["to"].get<size_t>();
+
+            REQUIRE(from < to);
+            diagonals.emplace_back(from, to);
         }
+
+        std::sort(diagonals.begin(), diagonals.end());
+
+        REQUIRE(diagonals == expected);
+        REQUIRE_EQUAL(output["diagonals_count"].get<size_t>(),
+                      polygon.size() - 3);
+        REQUIRE_EQUAL(output["triangles_count"].get<size_t>(),
+                      polygon.size() - 2);
     }
+
+    // Fewer than three vertices.
+    input["polygon"].erase(2);
+    input["polygon"].erase(2);
+    input["polygon"].erase(2);
+    res = cli->Post("/MonotonePolygonTriangulation", input.dump(),
+                    "application/json");
+
+    REQUIRE_EQUAL(400, res->status);
 }
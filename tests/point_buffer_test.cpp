@@ -0,0 +1,140 @@
+/**
+ * @file tests/point_buffer_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса PointBuffer и пакетных функций ориентации.
+ */
+
+#include <limits>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <orientation.hpp>
+#include <point_buffer.hpp>
+#include <orientation_batch.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::PointBuffer;
+using geometry::SimdLevel;
+
+template<typename T>
+static void BuildTest();
+
+template<typename T>
+static void BatchTest();
+
+/**
+ * @brief Набор тестов для класса geometry::PointBuffer.
+ */
+void TestPointBuffer() {
+  TestSuite suite("TestPointBuffer");
+
+  RUN_TEST(suite, BuildTest<float>);
+  RUN_TEST(suite, BuildTest<double>);
+  RUN_TEST(suite, BuildTest<long double>);
+  RUN_TEST(suite, BatchTest<float>);
+  RUN_TEST(suite, BatchTest<double>);
+  RUN_TEST(suite, BatchTest<long double>);
+}
+
+/**
+ * @brief Тест на компиляцию шаблона.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ */
+template<typename T>
+static void BuildTest() {
+  const T eps = std::numeric_limits<T>::epsilon() * T(1e3);
+
+  {
+    PointBuffer<T> buffer;
+
+    REQUIRE_EQUAL(buffer.Size(), 0u);
+    REQUIRE(buffer.Empty());
+  }
+
+  {
+    std::vector<Point<T>> points = {
+      Point(T(1.0), T(2.0)),
+      Point(T(3.0), T(4.0)),
+      Point(T(5.0), T(6.0))
+    };
+    PointBuffer<T> buffer(points);
+
+    REQUIRE_EQUAL(buffer.Size(), 3u);
+    REQUIRE_CLOSE(buffer.X(1), T(3.0), eps);
+    REQUIRE_CLOSE(buffer.Y(1), T(4.0), eps);
+    REQUIRE_CLOSE(buffer[2].X(), T(5.0), eps);
+    REQUIRE_CLOSE(buffer[2].Y(), T(6.0), eps);
+
+    buffer.PushBack(Point(T(7.0), T(8.0)));
+    buffer.X(0) = T(-1.0);
+
+    std::vector<Point<T>> result = buffer.ToPoints();
+
+    REQUIRE_EQUAL(result.size(), 4u);
+    REQUIRE_CLOSE(result[0].X(), T(-1.0), eps);
+    REQUIRE_CLOSE(result[3].Y(), T(8.0), eps);
+  }
+}
+
+/**
+ * @brief Сравнение пакетных функций со скалярной функцией Orientation().
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Результаты всех уровней векторных инструкций должны совпадать
+ * со скалярными вычислениями.
+ */
+template<typename T>
+static void BatchTest() {
+  const T eps = std::numeric_limits<T>::epsilon() * T(1e3);
+  const SimdLevel levels[] = {
+    SimdLevel::Scalar,
+    SimdLevel::Avx2,
+    SimdLevel::Avx512
+  };
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-3, 3);
+
+  for (std::size_t size : {0u, 1u, 7u, 8u, 17u, 100u}) {
+    PointBuffer<T> buffer;
+
+    for (std::size_t i = 0; i < size; i++) {
+      // Половина точек лежит на целочисленной сетке, чтобы часть точек
+      // оказалась на прямой.
+      if (i % 2 == 0)
+        buffer.PushBack(Point(T(gridDist(gen)), T(gridDist(gen))));
+      else
+        buffer.PushBack(Point(T(coordDist(gen)), T(coordDist(gen))));
+    }
+
+    Point<T> a(T(-1.0), T(-1.0));
+    Point<T> b(T(2.0), T(2.0));
+
+    for (SimdLevel level : levels) {
+      std::vector<T> cross;
+      std::vector<int> orientation;
+
+      geometry::CrossProductBatch(a, b, buffer, &cross, level);
+      geometry::OrientationBatch(a, b, buffer, eps, &orientation, level);
+
+      REQUIRE_EQUAL(cross.size(), size);
+      REQUIRE_EQUAL(orientation.size(), size);
+
+      for (std::size_t i = 0; i < size; i++) {
+        Point<T> c = buffer[i];
+        T expected = (b.X() - a.X()) * (c.Y() - a.Y()) -
+                     (b.Y() - a.Y()) * (c.X() - a.X());
+
+        REQUIRE_CLOSE(cross[i], expected, eps);
+        REQUIRE_EQUAL(orientation[i], geometry::Orientation(a, b, c, eps));
+      }
+    }
+  }
+}
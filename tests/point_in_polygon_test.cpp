@@ -0,0 +1,527 @@
+/**
+ * @file tests/point_in_polygon_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для функции WindingNumberPointInPolygon() и класса PreparedPolygon.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <angle_point_in_polygon.hpp>
+#include <point_in_polygon.hpp>
+#include <graham_scan.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::Polygon;
+using geometry::CyclicVector;
+using geometry::PointPosition;
+
+template<typename Container>
+static void SquareTest();
+
+static void RandomTest();
+
+static void AllocationTest();
+
+static void PreparedTest();
+
+static void ConvexTest();
+
+static void MethodTest(httplib::Client* cli);
+
+static void BatchMethodTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для функции geometry::WindingNumberPointInPolygon().
+ */
+void TestPointInPolygon() {
+  TestSuite suite("TestPointInPolygon");
+
+  RUN_TEST(suite, SquareTest<std::list<Point<double>>>);
+  RUN_TEST(suite, SquareTest<CyclicVector<Point<double>>>);
+  RUN_TEST(suite, RandomTest);
+  RUN_TEST(suite, AllocationTest);
+  RUN_TEST(suite, PreparedTest);
+  RUN_TEST(suite, ConvexTest);
+}
+
+/**
+ * @brief Набор тестов для параметра "method" метода /AnglePointInPolygon и
+ * метода /PointInPolygonBatch.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestPointInPolygonMethod(httplib::Client* cli) {
+  TestSuite suite("TestPointInPolygonMethod");
+
+  RUN_TEST_REMOTE(suite, cli, MethodTest);
+  RUN_TEST_REMOTE(suite, cli, BatchMethodTest);
+}
+
+/**
+ * @brief Точки внутри, снаружи и на границе невыпуклого многоугольника.
+ *
+ * @tparam Container Тип контейнера для хранения вершин.
+ */
+template<typename Container>
+static void SquareTest() {
+  // Квадрат с вырезом сверху, по часовой стрелке.
+  Polygon<double, Container> polygon(Container{
+    Point<double>(0.0, 0.0),
+    Point<double>(0.0, 4.0),
+    Point<double>(1.0, 4.0),
+    Point<double>(2.0, 2.0),
+    Point<double>(3.0, 4.0),
+    Point<double>(4.0, 4.0),
+    Point<double>(4.0, 0.0)
+  });
+
+  auto position = [&polygon](double x, double y) {
+    return geometry::WindingNumberPointInPolygon(Point<double>(x, y),
+                                                 polygon);
+  };
+
+  REQUIRE(position(1.0, 1.0) == PointPosition::INSIDE);
+  REQUIRE(position(0.5, 3.5) == PointPosition::INSIDE);
+  REQUIRE(position(2.0, 1.9) == PointPosition::INSIDE);
+  REQUIRE(position(2.0, 3.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(-1.0, 2.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(5.0, 4.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(-1.0, 4.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(2.0, 5.0) == PointPosition::OUTSIDE);
+
+  // Вершины и рёбра, в том числе горизонтальные.
+  REQUIRE(position(0.0, 0.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(2.0, 2.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(2.0, 0.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(0.5, 4.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(4.0, 1.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(1.5, 3.0) == PointPosition::BOUNDARY);
+
+  // Луч через вершину выреза.
+  REQUIRE(position(1.0, 2.0) == PointPosition::INSIDE);
+  REQUIRE(position(3.5, 2.0) == PointPosition::INSIDE);
+
+  Polygon<double, Container> empty;
+
+  REQUIRE(geometry::WindingNumberPointInPolygon(Point<double>(0.0, 0.0),
+                                                empty) ==
+          PointPosition::OUTSIDE);
+}
+
+/**
+ * @brief Сравнение с geometry::AnglePointInPolygon() на звёздных
+ * многоугольниках.
+ */
+static void RandomTest() {
+  const int numTries = 100;
+  const int maxVertices = 50;
+  const int numPoints = 100;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> sizeDist(3, maxVertices);
+  std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
+  std::uniform_real_distribution<double> radiusDist(1.0, 10.0);
+  std::uniform_real_distribution<double> coordDist(-12.0, 12.0);
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<double> angles(sizeDist(gen));
+
+    for (double& angle : angles)
+      angle = angleDist(gen);
+
+    // По часовой стрелке: углы по убыванию.
+    std::sort(angles.rbegin(), angles.rend());
+
+    CyclicVector<Point<double>> vertices;
+
+    for (double angle : angles) {
+      double radius = radiusDist(gen);
+
+      vertices.emplace_back(radius * std::cos(angle),
+                            radius * std::sin(angle));
+    }
+
+    Polygon<double, CyclicVector<Point<double>>> polygon(
+        std::move(vertices));
+
+    for (int i = 0; i < numPoints; i++) {
+      Point<double> point(coordDist(gen), coordDist(gen));
+
+      REQUIRE(geometry::WindingNumberPointInPolygon(point, polygon) ==
+              geometry::AnglePointInPolygon(point, polygon));
+    }
+  }
+}
+
+/**
+ * @brief Сравнение geometry::PreparedPolygon с
+ * geometry::WindingNumberPointInPolygon().
+ *
+ * Точки берутся на целочисленной сетке, поэтому часть из них попадает на
+ * вершины и рёбра.
+ */
+static void PreparedTest() {
+  const int numTries = 50;
+
+  std::mt19937 gen(2);
+  std::uniform_int_distribution<int> sizeDist(3, 30);
+  std::uniform_int_distribution<int> coordDist(-10, 10);
+
+  for (int it = 0; it < numTries; it++) {
+    CyclicVector<Point<double>> vertices;
+    const int size = sizeDist(gen);
+
+    for (int i = 0; i < size; i++)
+      vertices.emplace_back(coordDist(gen), coordDist(gen));
+
+    Polygon<double, CyclicVector<Point<double>>> polygon(
+        std::move(vertices));
+    geometry::PreparedPolygon<double> prepared(polygon);
+
+    REQUIRE_EQUAL(prepared.Size(), polygon.Size());
+
+    std::vector<Point<double>> points;
+
+    for (int x = -11; x <= 11; x++) {
+      for (int y = -11; y <= 11; y++)
+        points.emplace_back(x, y + 0.5 * (x % 2));
+    }
+
+    std::vector<PointPosition> sequential = prepared.Classify(points, 1);
+    std::vector<PointPosition> parallel = prepared.Classify(points, 4);
+
+    for (size_t i = 0; i < points.size(); i++) {
+      PointPosition expected =
+          geometry::WindingNumberPointInPolygon(points[i], polygon);
+
+      REQUIRE(prepared.Classify(points[i]) == expected);
+      REQUIRE(sequential[i] == expected);
+      REQUIRE(parallel[i] == expected);
+    }
+  }
+
+  geometry::PreparedPolygon<double> empty(
+      Polygon<double, CyclicVector<Point<double>>>{});
+
+  REQUIRE(empty.Classify(Point<double>(0.0, 0.0)) == PointPosition::OUTSIDE);
+  REQUIRE(empty.Classify(std::vector<Point<double>>{}, 4).empty());
+}
+
+/**
+ * @brief Проверка geometry::IsConvex() и сравнение
+ * geometry::PreparedPolygon для выпуклых многоугольников с
+ * geometry::WindingNumberPointInPolygon().
+ *
+ * Многоугольники --- выпуклые оболочки случайных точек с целочисленными
+ * координатами в обоих направлениях обхода, точки запросов лежат на сетке
+ * с шагом 0.5.
+ */
+static void ConvexTest() {
+  const int numTries = 100;
+
+  using ConvexPolygon = Polygon<double, CyclicVector<Point<double>>>;
+
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> sizeDist(3, 40);
+  std::uniform_int_distribution<int> coordDist(-10, 10);
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<Point<double>> points(sizeDist(gen));
+
+    for (auto& point : points)
+      point = Point<double>(coordDist(gen), coordDist(gen));
+
+    std::vector<Point<double>> hull = geometry::GrahamScan(points);
+
+    if (hull.size() < 3)
+      continue;
+
+    for (bool reverse : {false, true}) {
+      if (reverse)
+        std::reverse(hull.begin(), hull.end());
+
+      ConvexPolygon polygon(CyclicVector<Point<double>>(hull.begin(),
+                                                        hull.end()));
+      geometry::PreparedPolygon<double> prepared(polygon);
+
+      REQUIRE(geometry::IsConvex(polygon) != 0);
+      REQUIRE(prepared.IsConvex());
+
+      for (double x = -11.0; x <= 11.0; x += 0.5) {
+        for (double y = -11.0; y <= 11.0; y += 0.5) {
+          Point<double> point(x, y);
+
+          REQUIRE(prepared.Classify(point) ==
+                  geometry::WindingNumberPointInPolygon(point, polygon));
+        }
+      }
+    }
+  }
+
+  // Квадрат с вырезом, квадрат с вершиной на стороне и пентаграмма.
+  ConvexPolygon notched(CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0), Point<double>(0.0, 4.0),
+    Point<double>(2.0, 2.0), Point<double>(4.0, 4.0),
+    Point<double>(4.0, 0.0)
+  });
+  ConvexPolygon collinear(CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0), Point<double>(0.0, 2.0),
+    Point<double>(0.0, 4.0), Point<double>(4.0, 4.0),
+    Point<double>(4.0, 0.0)
+  });
+  ConvexPolygon pentagram;
+
+  for (int i = 0; i < 5; i++) {
+    const double angle = 2.0 * M_PI * ((2 * i) % 5) / 5.0;
+
+    pentagram.Vertices().emplace_back(std::cos(angle), std::sin(angle));
+  }
+
+  REQUIRE_EQUAL(geometry::IsConvex(notched), 0);
+  REQUIRE_EQUAL(geometry::IsConvex(collinear), 0);
+  REQUIRE_EQUAL(geometry::IsConvex(pentagram), 0);
+  REQUIRE_EQUAL(geometry::IsConvex(ConvexPolygon(CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0), Point<double>(0.0, 1.0),
+    Point<double>(1.0, 0.0)
+  })), -1);
+  REQUIRE(!geometry::PreparedPolygon<double>(pentagram).IsConvex());
+  REQUIRE(geometry::PreparedPolygon<double>(pentagram).Classify(
+              Point<double>(0.0, 0.0)) == PointPosition::INSIDE);
+}
+
+//! Количество выделений памяти через CountingAllocator.
+static std::size_t numAllocations = 0;
+
+/**
+ * @brief Аллокатор, считающий выделения памяти.
+ *
+ * @tparam U Тип элементов.
+ */
+template<typename U>
+struct CountingAllocator {
+  using value_type = U;
+
+  CountingAllocator() = default;
+
+  template<typename V>
+  explicit CountingAllocator(const CountingAllocator<V>&) { }
+
+  U* allocate(std::size_t n) {
+    numAllocations++;
+    return std::allocator<U>().allocate(n);
+  }
+
+  void deallocate(U* p, std::size_t n) {
+    std::allocator<U>().deallocate(p, n);
+  }
+
+  template<typename V>
+  bool operator==(const CountingAllocator<V>&) const { return true; }
+
+  template<typename V>
+  bool operator!=(const CountingAllocator<V>&) const { return false; }
+};
+
+/**
+ * @brief Запрос к многоугольнику на списке не должен выделять память.
+ */
+static void AllocationTest() {
+  using Container = std::list<Point<double>,
+                              CountingAllocator<Point<double>>>;
+
+  Polygon<double, Container> polygon(Container{
+    Point<double>(0.0, 0.0),
+    Point<double>(0.0, 4.0),
+    Point<double>(4.0, 4.0),
+    Point<double>(4.0, 0.0)
+  });
+
+  numAllocations = 0;
+
+  for (double x : {-1.0, 0.0, 2.0, 4.0}) {
+    Point<double> point(x, 2.0);
+
+    REQUIRE(geometry::AnglePointInPolygon(point, polygon) ==
+            geometry::WindingNumberPointInPolygon(point, polygon));
+  }
+
+  REQUIRE_EQUAL(numAllocations, 0u);
+}
+
+/**
+ * @brief Выбор алгоритма в методе /AnglePointInPolygon.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void MethodTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "point": {"x": 0.5, "y": 0.0},
+      "polygon": [
+        {"x": 0.0, "y": 0.0},
+        {"x": 0.0, "y": 1.0},
+        {"x": 1.0, "y": 1.0},
+        {"x": 1.0, "y": 0.0}
+      ],
+      "method": "winding"
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/AnglePointInPolygon", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "boundary");
+  REQUIRE(output["method"] == "winding");
+
+  input["point"] = {{"x", 0.5}, {"y", 0.5}};
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "inside");
+
+  input["point"] = {{"x", 1.5}, {"y", 0.5}};
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "outside");
+
+  input["method"] = "grid";
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "outside");
+  REQUIRE(output["method"] == "grid");
+  REQUIRE(output["memory"].get<int>() > 0);
+
+  input["point"] = {{"x", 1.0}, {"y", 0.5}};
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "boundary");
+
+  input["method"] = "auto";
+  input["point"] = {{"x", 0.5}, {"y", 0.5}};
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "inside");
+  REQUIRE(output["path"] == "convex");
+
+  // Без "method" выпуклый многоугольник проверяется за O(log n).
+  input.erase("method");
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "inside");
+  REQUIRE(output["method"] == "auto");
+  REQUIRE(output["path"] == "convex");
+
+  input["method"] = "auto";
+
+  // Вершина на стороне квадрата: многоугольник не строго выпуклый.
+  input["polygon"].push_back({{"x", 0.5}, {"y", 0.0}});
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "inside");
+  REQUIRE(output["path"] == "winding");
+
+  input["method"] = "ray";
+  res = cli->Post("/AnglePointInPolygon", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
+
+/**
+ * @brief Тест метода /PointInPolygonBatch.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void BatchMethodTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "polygon": [
+        {"x": 0.0, "y": 0.0},
+        {"x": 0.0, "y": 1.0},
+        {"x": 1.0, "y": 1.0},
+        {"x": 1.0, "y": 0.0}
+      ],
+      "points": [
+        {"x": 0.5, "y": 0.5},
+        {"x": 2.0, "y": 0.5},
+        {"x": 0.0, "y": 0.5},
+        {"x": 0.25, "y": 0.75}
+      ]
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/PointInPolygonBatch", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["positions"] == "iobi");
+  REQUIRE_EQUAL(output["inside"].get<int>(), 2);
+  REQUIRE_EQUAL(output["outside"].get<int>(), 1);
+  REQUIRE_EQUAL(output["boundary"].get<int>(), 1);
+  REQUIRE_EQUAL(output["polygon_size"].get<int>(), 4);
+
+  input.erase("points");
+  input["coordinates"] = {0.5, 0.5, 2.0, 0.5, 1.0, 1.0};
+  input["threads"] = 2;
+  res = cli->Post("/PointInPolygonBatch", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["positions"] == "iob");
+  REQUIRE(output["method"] == "prepared");
+  REQUIRE(output["path"] == "convex");
+
+  input["method"] = "grid";
+  res = cli->Post("/PointInPolygonBatch", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["positions"] == "iob");
+  REQUIRE(output["method"] == "grid");
+  REQUIRE(output["memory"].get<int>() > 0);
+
+  input["method"] = "slabs";
+  res = cli->Post("/PointInPolygonBatch", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  input.erase("method");
+  input["coordinates"] = {0.5, 0.5, 2.0};
+  res = cli->Post("/PointInPolygonBatch", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  input["points"] = nlohmann::json::array();
+  res = cli->Post("/PointInPolygonBatch", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file tests/point_sort_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для поразрядной сортировки точек.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <point_sort.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::PointSort;
+
+template<typename T>
+static void OrderedKeyTest();
+
+template<typename T>
+static void RadixSortTest();
+
+/**
+ * @brief Набор тестов для функции geometry::RadixSort().
+ */
+void TestPointSort() {
+  TestSuite suite("TestPointSort");
+
+  RUN_TEST(suite, OrderedKeyTest<float>);
+  RUN_TEST(suite, OrderedKeyTest<double>);
+  RUN_TEST(suite, OrderedKeyTest<int>);
+  RUN_TEST(suite, OrderedKeyTest<std::int64_t>);
+  RUN_TEST(suite, RadixSortTest<float>);
+  RUN_TEST(suite, RadixSortTest<double>);
+  RUN_TEST(suite, RadixSortTest<long double>);
+  RUN_TEST(suite, RadixSortTest<int>);
+}
+
+/**
+ * @brief Ключи должны сохранять порядок чисел.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ */
+template<typename T>
+static void OrderedKeyTest() {
+  std::vector<T> values = {
+    std::numeric_limits<T>::lowest(),
+    T(-100),
+    T(-1),
+    T(0),
+    T(1),
+    T(2),
+    T(100),
+    std::numeric_limits<T>::max()
+  };
+
+  if constexpr (std::is_floating_point_v<T>) {
+    values.push_back(-std::numeric_limits<T>::infinity());
+    values.push_back(std::numeric_limits<T>::infinity());
+    values.push_back(-std::numeric_limits<T>::denorm_min());
+    values.push_back(std::numeric_limits<T>::denorm_min());
+    values.push_back(T(-0.5));
+    values.push_back(T(0.5));
+
+    REQUIRE(geometry::OrderedKey(T(-0.0)) == geometry::OrderedKey(T(0.0)));
+  }
+
+  for (T a : values) {
+    for (T b : values) {
+      REQUIRE_EQUAL(a < b,
+                    geometry::OrderedKey(a) < geometry::OrderedKey(b));
+      REQUIRE_EQUAL(a == b,
+                    geometry::OrderedKey(a) == geometry::OrderedKey(b));
+    }
+  }
+}
+
+/**
+ * @brief Сравнение с std::sort() на случайных точках.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Проверяются короткие и длинные последовательности, точки с
+ * повторяющимися координатами и точки с одинаковыми старшими разрядами
+ * ключей, при которых часть проходов пропускается.
+ */
+template<typename T>
+static void RadixSortTest() {
+  const int numTries = 30;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<std::size_t> sizeDist(0, 60000);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+  std::uniform_int_distribution<int> gridDist(-5, 5);
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<Point<T>> points(sizeDist(gen));
+
+    for (auto& point : points) {
+      if (it % 3 == 0)
+        point = Point<T>(T(coordDist(gen)), T(coordDist(gen)));
+      else if (it % 3 == 1)
+        point = Point<T>(T(gridDist(gen)), T(gridDist(gen)));
+      else
+        point = Point<T>(T(7), T(gridDist(gen)));
+    }
+
+    std::vector<Point<T>> expected = points;
+
+    std::sort(expected.begin(), expected.end());
+    geometry::SortPoints(points.begin(), points.end(), PointSort::Radix);
+
+    REQUIRE_EQUAL(points.size(), expected.size());
+
+    for (std::size_t i = 0; i < points.size(); i++) {
+      REQUIRE(points[i].X() == expected[i].X());
+      REQUIRE(points[i].Y() == expected[i].Y());
+    }
+  }
+}
@@ -0,0 +1,191 @@
+/**
+ * @file tests/polygon_grid_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса PolygonGrid.
+ */
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <point_in_polygon.hpp>
+#include <polygon_grid.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::Polygon;
+using geometry::CyclicVector;
+using geometry::PointPosition;
+using geometry::PolygonGrid;
+
+static void SquareTest();
+
+static void RandomTest();
+
+static void DegenerateTest();
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonGrid.
+ */
+void TestPolygonGrid() {
+  TestSuite suite("TestPolygonGrid");
+
+  RUN_TEST(suite, SquareTest);
+  RUN_TEST(suite, RandomTest);
+  RUN_TEST(suite, DegenerateTest);
+}
+
+/**
+ * @brief Точки внутри, снаружи и на границе невыпуклого многоугольника.
+ */
+static void SquareTest() {
+  // Квадрат с вырезом сверху, по часовой стрелке.
+  Polygon<double, CyclicVector<Point<double>>> polygon(
+      CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0),
+    Point<double>(0.0, 4.0),
+    Point<double>(1.0, 4.0),
+    Point<double>(2.0, 2.0),
+    Point<double>(3.0, 4.0),
+    Point<double>(4.0, 4.0),
+    Point<double>(4.0, 0.0)
+  });
+
+  for (double cellsPerEdge : {0.1, 1.0, 4.0, 64.0}) {
+    PolygonGrid<double> grid(polygon, 1e-9, cellsPerEdge);
+
+    REQUIRE_EQUAL(grid.Size(), 7u);
+    REQUIRE(grid.NumColumns() * grid.NumRows() >= 1u);
+
+    auto position = [&grid](double x, double y) {
+      return grid.Classify(Point<double>(x, y));
+    };
+
+    REQUIRE(position(1.0, 1.0) == PointPosition::INSIDE);
+    REQUIRE(position(0.5, 3.5) == PointPosition::INSIDE);
+    REQUIRE(position(2.0, 1.9) == PointPosition::INSIDE);
+    REQUIRE(position(1.0, 2.0) == PointPosition::INSIDE);
+    REQUIRE(position(3.5, 2.0) == PointPosition::INSIDE);
+    REQUIRE(position(2.0, 3.0) == PointPosition::OUTSIDE);
+    REQUIRE(position(-1.0, 2.0) == PointPosition::OUTSIDE);
+    REQUIRE(position(5.0, 4.0) == PointPosition::OUTSIDE);
+    REQUIRE(position(4.0 + 1e-6, 2.0) == PointPosition::OUTSIDE);
+
+    REQUIRE(position(0.0, 0.0) == PointPosition::BOUNDARY);
+    REQUIRE(position(2.0, 2.0) == PointPosition::BOUNDARY);
+    REQUIRE(position(2.0, 0.0) == PointPosition::BOUNDARY);
+    REQUIRE(position(0.5, 4.0) == PointPosition::BOUNDARY);
+    REQUIRE(position(4.0, 1.0) == PointPosition::BOUNDARY);
+    REQUIRE(position(1.5, 3.0) == PointPosition::BOUNDARY);
+  }
+
+  PolygonGrid<double> empty;
+
+  REQUIRE(empty.Classify(Point<double>(0.0, 0.0)) == PointPosition::OUTSIDE);
+  REQUIRE_THROW(PolygonGrid<double>(polygon, 1e-9, 0.0),
+                std::invalid_argument);
+}
+
+/**
+ * @brief Сравнение с geometry::WindingNumberPointInPolygon().
+ *
+ * Вершины случайные, поэтому многоугольники бывают
+ * самопересекающимися. Точки берутся на сетке с шагом 0.5, поэтому многие
+ * из них попадают на вершины, рёбра и границы ячеек.
+ */
+static void RandomTest() {
+  const int numTries = 100;
+
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> sizeDist(3, 60);
+  std::uniform_int_distribution<int> coordDist(-10, 10);
+  std::uniform_real_distribution<double> densityDist(0.05, 8.0);
+
+  for (int it = 0; it < numTries; it++) {
+    CyclicVector<Point<double>> vertices;
+    const int size = sizeDist(gen);
+
+    for (int i = 0; i < size; i++)
+      vertices.emplace_back(coordDist(gen), coordDist(gen));
+
+    Polygon<double, CyclicVector<Point<double>>> polygon(
+        std::move(vertices));
+    PolygonGrid<double> grid(polygon, 1e-9, densityDist(gen));
+
+    REQUIRE(grid.MemoryUsage() > sizeof(grid));
+
+    std::vector<Point<double>> points;
+
+    for (double x = -11.0; x <= 11.0; x += 0.5) {
+      for (double y = -11.0; y <= 11.0; y += 0.5)
+        points.emplace_back(x, y);
+    }
+
+    std::vector<PointPosition> parallel = grid.Classify(points, 4);
+
+    for (size_t i = 0; i < points.size(); i++) {
+      PointPosition expected =
+          geometry::WindingNumberPointInPolygon(points[i], polygon);
+
+      REQUIRE(grid.Classify(points[i]) == expected);
+      REQUIRE(parallel[i] == expected);
+    }
+  }
+}
+
+/**
+ * @brief Многоугольники с нулевой шириной или высотой и длинные узкие
+ * многоугольники.
+ */
+static void DegenerateTest() {
+  Polygon<double, CyclicVector<Point<double>>> segment(
+      CyclicVector<Point<double>>{
+    Point<double>(0.0, 1.0),
+    Point<double>(4.0, 1.0),
+    Point<double>(2.0, 1.0)
+  });
+  PolygonGrid<double> segmentGrid(segment);
+
+  REQUIRE_EQUAL(segmentGrid.NumRows(), 1u);
+  REQUIRE(segmentGrid.Classify(Point<double>(1.0, 1.0)) ==
+          PointPosition::BOUNDARY);
+  REQUIRE(segmentGrid.Classify(Point<double>(1.0, 1.5)) ==
+          PointPosition::OUTSIDE);
+  REQUIRE(segmentGrid.Classify(Point<double>(5.0, 1.0)) ==
+          PointPosition::OUTSIDE);
+
+  Polygon<double, CyclicVector<Point<double>>> point(
+      CyclicVector<Point<double>>{Point<double>(2.0, 3.0)});
+  PolygonGrid<double> pointGrid(point);
+
+  REQUIRE(pointGrid.Classify(Point<double>(2.0, 3.0)) ==
+          PointPosition::BOUNDARY);
+  REQUIRE(pointGrid.Classify(Point<double>(2.0, 3.5)) ==
+          PointPosition::OUTSIDE);
+
+  // Узкий треугольник, наклонённый к сетке.
+  Polygon<double, CyclicVector<Point<double>>> sliver(
+      CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0),
+    Point<double>(1000.0, 1.0),
+    Point<double>(1000.0, 1.001)
+  });
+  PolygonGrid<double> sliverGrid(sliver, 1e-9, 16.0);
+  std::mt19937 gen(4);
+  std::uniform_real_distribution<double> xDist(0.0, 1000.0);
+  std::uniform_real_distribution<double> yDist(0.0, 1.001);
+
+  for (int i = 0; i < 10000; i++) {
+    Point<double> query(xDist(gen), yDist(gen));
+
+    REQUIRE(sliverGrid.Classify(query) ==
+            geometry::WindingNumberPointInPolygon(query, sliver));
+  }
+}
@@ -0,0 +1,316 @@
+/**
+ * @file tests/polygon_locator_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса PolygonLocator.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <random>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <point_in_polygon.hpp>
+#include <polygon_locator.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::CyclicVector;
+using geometry::PointPosition;
+using geometry::PolygonLocator;
+
+//! Многоугольник, используемый в тестах.
+using StarPolygon = geometry::Polygon<double, CyclicVector<Point<double>>>;
+
+static StarPolygon RandomStarPolygon(std::mt19937* gen, int size);
+
+static void SquareTest();
+
+static void RandomTest();
+
+static void LargeTest();
+
+static void SerializationTest();
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonLocator.
+ */
+void TestPolygonLocator() {
+  TestSuite suite("TestPolygonLocator");
+
+  RUN_TEST(suite, SquareTest);
+  RUN_TEST(suite, RandomTest);
+  RUN_TEST(suite, LargeTest);
+  RUN_TEST(suite, SerializationTest);
+}
+
+/**
+ * @brief Построить звёздный многоугольник с целочисленными вершинами.
+ *
+ * @param gen Генератор случайных чисел.
+ * @param size Количество случайных точек.
+ * @return Функция возвращает простой многоугольник, вершины которого
+ * упорядочены по полярному углу по часовой стрелке.
+ *
+ * Из точек с одинаковым полярным углом остаётся одна, а соседние
+ * вершины отличаются по углу меньше, чем на \f$ \pi \f$.
+ */
+static StarPolygon RandomStarPolygon(std::mt19937* gen, int size) {
+  std::uniform_int_distribution<int> coordDist(-10, 10);
+
+  while (true) {
+    std::vector<Point<double>> points;
+
+    for (int i = 0; i < size; i++) {
+      Point<double> point(coordDist(*gen), coordDist(*gen));
+
+      if (point.X() != 0.0 || point.Y() != 0.0)
+        points.push_back(point);
+    }
+
+    auto angle = [](const Point<double>& point) {
+      return std::atan2(point.Y(), point.X());
+    };
+
+    std::sort(points.begin(), points.end(),
+              [&angle](const Point<double>& a, const Point<double>& b) {
+                return angle(a) > angle(b);
+              });
+    points.erase(std::unique(points.begin(), points.end(),
+                             [](const Point<double>& a,
+                                const Point<double>& b) {
+                               return a.X() * b.Y() == a.Y() * b.X() &&
+                                      a.X() * b.X() + a.Y() * b.Y() > 0;
+                             }),
+                 points.end());
+
+    bool simple = points.size() >= 3;
+
+    for (size_t i = 0; simple && i < points.size(); i++) {
+      const Point<double>& a = points[i];
+      const Point<double>& b = points[(i + 1) % points.size()];
+
+      // Поворот от a к b по часовой стрелке меньше, чем на pi.
+      simple = a.X() * b.Y() - a.Y() * b.X() < 0;
+    }
+
+    if (simple)
+      return StarPolygon(CyclicVector<Point<double>>(points.begin(),
+                                                     points.end()));
+  }
+}
+
+/**
+ * @brief Точки внутри, снаружи и на границе невыпуклого многоугольника.
+ */
+static void SquareTest() {
+  // Квадрат с вырезом сверху и вертикальными рёбрами, по часовой стрелке.
+  StarPolygon polygon(CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0),
+    Point<double>(0.0, 4.0),
+    Point<double>(1.0, 4.0),
+    Point<double>(2.0, 2.0),
+    Point<double>(3.0, 4.0),
+    Point<double>(4.0, 4.0),
+    Point<double>(4.0, 0.0)
+  });
+  PolygonLocator<double> locator(polygon);
+
+  REQUIRE_EQUAL(locator.NumSlabs(), 4u);
+
+  auto position = [&locator](double x, double y) {
+    return locator.Locate(Point<double>(x, y));
+  };
+
+  REQUIRE(position(1.0, 1.0) == PointPosition::INSIDE);
+  REQUIRE(position(0.5, 3.5) == PointPosition::INSIDE);
+  REQUIRE(position(2.0, 1.9) == PointPosition::INSIDE);
+  REQUIRE(position(1.0, 2.0) == PointPosition::INSIDE);
+  REQUIRE(position(2.0, 3.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(-1.0, 2.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(5.0, 4.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(4.0 + 1e-6, 2.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(2.0, 5.0) == PointPosition::OUTSIDE);
+
+  REQUIRE(position(0.0, 0.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(0.0, 2.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(4.0, 1.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(2.0, 2.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(2.0, 0.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(0.5, 4.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(1.5, 3.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(1.0, 4.0) == PointPosition::BOUNDARY);
+
+  PolygonLocator<double> empty;
+
+  REQUIRE_EQUAL(empty.NumSlabs(), 0u);
+  REQUIRE(empty.Locate(Point<double>(0.0, 0.0)) == PointPosition::OUTSIDE);
+}
+
+/**
+ * @brief Сравнение с geometry::WindingNumberPointInPolygon() на звёздных
+ * многоугольниках.
+ *
+ * Вершины и точки лежат на сетке с шагом 0.5, поэтому многие точки
+ * попадают на вершины, рёбра и границы полос.
+ */
+static void RandomTest() {
+  const int numTries = 200;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> sizeDist(3, 40);
+
+  for (int it = 0; it < numTries; it++) {
+    StarPolygon polygon = RandomStarPolygon(&gen, sizeDist(gen));
+    PolygonLocator<double> locator(polygon);
+
+    for (double x = -11.0; x <= 11.0; x += 0.5) {
+      for (double y = -11.0; y <= 11.0; y += 0.5) {
+        Point<double> point(x, y);
+
+        REQUIRE(locator.Locate(point) ==
+                geometry::WindingNumberPointInPolygon(point, polygon));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Размер индекса для многоугольника, который вертикальная прямая
+ * пересекает в \f$ \Theta(n) \f$ точках.
+ *
+ * Разбиение на полосы хранило бы \f$ \Theta(n^2) \f$ рёбер, а дерево
+ * должно занимать \f$ O(n \log n) \f$ узлов.
+ */
+static void LargeTest() {
+  const int size = 20000;
+  const int numQueries = 2000;
+
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> angleDist(0.0, 2.0 * M_PI);
+  std::uniform_real_distribution<double> radiusDist(500.0, 1000.0);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+  std::vector<double> angles(size);
+
+  for (double& angle : angles)
+    angle = angleDist(gen);
+
+  std::sort(angles.rbegin(), angles.rend());
+
+  CyclicVector<Point<double>> vertices;
+
+  for (double angle : angles) {
+    double radius = radiusDist(gen);
+
+    vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+  }
+
+  StarPolygon polygon(std::move(vertices));
+  PolygonLocator<double> locator(polygon);
+
+  REQUIRE(locator.NumNodes() < 4.0 * size * std::log2(size));
+
+  for (int i = 0; i < numQueries; i++) {
+    Point<double> point(coordDist(gen), coordDist(gen));
+
+    REQUIRE(locator.Locate(point) ==
+            geometry::WindingNumberPointInPolygon(point, polygon));
+  }
+}
+
+/**
+ * @brief Сохранение и чтение индекса.
+ */
+static void SerializationTest() {
+  std::mt19937 gen(2);
+  StarPolygon polygon = RandomStarPolygon(&gen, 30);
+  PolygonLocator<double> locator(polygon);
+  std::stringstream stream;
+
+  locator.Write(stream);
+
+  const std::string data = stream.str();
+  PolygonLocator<double> loaded = PolygonLocator<double>::Read(stream);
+
+  REQUIRE_EQUAL(loaded.NumSlabs(), locator.NumSlabs());
+  REQUIRE_EQUAL(loaded.NumNodes(), locator.NumNodes());
+
+  for (double x = -11.0; x <= 11.0; x += 0.5) {
+    for (double y = -11.0; y <= 11.0; y += 0.5) {
+      Point<double> point(x, y);
+
+      REQUIRE(loaded.Locate(point) == locator.Locate(point));
+    }
+  }
+
+  std::stringstream truncated(data.substr(0, data.size() - 1));
+
+  REQUIRE_THROW(PolygonLocator<double>::Read(truncated),
+                std::invalid_argument);
+
+  std::stringstream otherType(data);
+
+  REQUIRE_THROW(PolygonLocator<float>::Read(otherType),
+                std::invalid_argument);
+
+  std::string corrupted = data;
+
+  // Неизвестная версия формата.
+  corrupted[4] = '\x7f';
+
+  std::stringstream corruptedStream(corrupted);
+
+  REQUIRE_THROW(PolygonLocator<double>::Read(corruptedStream),
+                std::invalid_argument);
+
+  // Огромный размер массива без данных не должен выделять память заранее.
+  std::string oversized = data.substr(0, 3 * sizeof(std::uint32_t) +
+                                         5 * sizeof(double));
+  const std::uint64_t hugeSize = 0xffffffffu;
+
+  oversized.append(reinterpret_cast<const char*>(&hugeSize),
+                   sizeof(hugeSize));
+
+  std::stringstream oversizedStream(oversized);
+
+  REQUIRE_THROW(PolygonLocator<double>::Read(oversizedStream),
+                std::invalid_argument);
+
+  // Узел, ссылающийся на самого себя.
+  std::stringstream rewritten;
+  PolygonLocator<double> small(StarPolygon(CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0),
+    Point<double>(0.0, 1.0),
+    Point<double>(1.0, 0.0)
+  }));
+
+  small.Write(rewritten);
+
+  std::string cyclic = rewritten.str();
+  // Заголовок, границы, xs (2 числа), segments (2 ребра), размер nodes,
+  // узел 0 и поле segment узла 1.
+  const std::size_t leftOffset = 3 * sizeof(std::uint32_t) +
+                                 5 * sizeof(double) +
+                                 3 * sizeof(std::uint64_t) +
+                                 2 * sizeof(double) + 8 * sizeof(double) +
+                                 4 * sizeof(std::uint32_t) +
+                                 sizeof(std::uint32_t);
+  const std::uint32_t self = 1;
+
+  cyclic.replace(leftOffset, sizeof(self),
+                 reinterpret_cast<const char*>(&self), sizeof(self));
+
+  std::stringstream cyclicStream(cyclic);
+
+  REQUIRE_THROW(PolygonLocator<double>::Read(cyclicStream),
+                std::invalid_argument);
+}
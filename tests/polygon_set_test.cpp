@@ -0,0 +1,262 @@
+/**
+ * @file tests/polygon_set_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса PolygonSet.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <point_in_polygon.hpp>
+#include <polygon_set.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::CyclicVector;
+using geometry::PointPosition;
+using geometry::PolygonSet;
+
+//! Многоугольник, используемый в тестах.
+using Zone = geometry::Polygon<double, CyclicVector<Point<double>>>;
+
+static std::vector<Zone> JitteredGrid(std::mt19937* gen, int size);
+
+static void TilingTest();
+
+static void OverlapTest();
+
+static void SessionTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonSet.
+ */
+void TestPolygonSet() {
+  TestSuite suite("TestPolygonSet");
+
+  RUN_TEST(suite, TilingTest);
+  RUN_TEST(suite, OverlapTest);
+}
+
+/**
+ * @brief Набор тестов для сессий /PolygonSet.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestPolygonSetSession(httplib::Client* cli) {
+  TestSuite suite("TestPolygonSetSession");
+
+  RUN_TEST_REMOTE(suite, cli, SessionTest);
+}
+
+/**
+ * @brief Разбить квадрат на четырёхугольники.
+ *
+ * @param gen Генератор случайных чисел.
+ * @param size Количество ячеек по каждой стороне.
+ * @return Функция возвращает size * size четырёхугольников по часовой
+ * стрелке.
+ *
+ * Узлы решётки с шагом 4 сдвигаются на целое число от -1 до 1 (кроме
+ * узлов на сторонах квадрата), поэтому соседние ячейки имеют общие рёбра
+ * и вместе покрывают квадрат \f$ [0, 4 size]^2 \f$.
+ */
+static std::vector<Zone> JitteredGrid(std::mt19937* gen, int size) {
+  std::uniform_int_distribution<int> shiftDist(-1, 1);
+  std::vector<std::vector<Point<double>>> nodes(size + 1);
+
+  for (int i = 0; i <= size; i++) {
+    for (int j = 0; j <= size; j++) {
+      const int dx = (i == 0 || i == size) ? 0 : shiftDist(*gen);
+      const int dy = (j == 0 || j == size) ? 0 : shiftDist(*gen);
+
+      nodes[i].emplace_back(4 * i + dx, 4 * j + dy);
+    }
+  }
+
+  std::vector<Zone> zones;
+
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      zones.emplace_back(CyclicVector<Point<double>>{
+        nodes[i][j], nodes[i][j + 1], nodes[i + 1][j + 1], nodes[i + 1][j]
+      });
+    }
+  }
+
+  return zones;
+}
+
+/**
+ * @brief Сравнение с перебором всех многоугольников на разбиении
+ * квадрата.
+ *
+ * Точки берутся на сетке с шагом 0.5, поэтому многие из них попадают на
+ * общие рёбра и вершины ячеек.
+ */
+static void TilingTest() {
+  std::mt19937 gen(1);
+
+  for (int size : {1, 3, 10, 25}) {
+    std::vector<Zone> zones = JitteredGrid(&gen, size);
+    PolygonSet<double> set(zones);
+
+    REQUIRE_EQUAL(set.Size(), zones.size());
+    REQUIRE(set.Depth() >= 1u);
+
+    std::vector<Point<double>> points;
+
+    for (double x = -1.0; x <= 4 * size + 1; x += 0.5) {
+      for (double y = -1.0; y <= 4 * size + 1; y += 0.5)
+        points.emplace_back(x, y);
+    }
+
+    std::vector<std::size_t> parallel = set.Find(points, 4);
+    std::vector<std::size_t> all;
+
+    for (std::size_t i = 0; i < points.size(); i++) {
+      std::vector<std::size_t> expected;
+
+      for (std::size_t j = 0; j < zones.size(); j++) {
+        if (geometry::WindingNumberPointInPolygon(points[i], zones[j]) !=
+            PointPosition::OUTSIDE)
+          expected.push_back(j);
+      }
+
+      set.FindAll(points[i], &all);
+
+      REQUIRE(all == expected);
+      REQUIRE_EQUAL(set.Find(points[i]),
+                    expected.empty() ? PolygonSet<double>::npos :
+                                       expected.front());
+      REQUIRE_EQUAL(parallel[i], set.Find(points[i]));
+    }
+  }
+}
+
+/**
+ * @brief Вложенные и пересекающиеся многоугольники, пустые многоугольники
+ * и пустой набор.
+ */
+static void OverlapTest() {
+  std::vector<Zone> zones = {
+    Zone(CyclicVector<Point<double>>{
+      Point<double>(0.0, 0.0), Point<double>(0.0, 10.0),
+      Point<double>(10.0, 10.0), Point<double>(10.0, 0.0)
+    }),
+    Zone(),
+    Zone(CyclicVector<Point<double>>{
+      Point<double>(2.0, 2.0), Point<double>(2.0, 4.0),
+      Point<double>(4.0, 4.0), Point<double>(4.0, 2.0)
+    }),
+    Zone(CyclicVector<Point<double>>{
+      Point<double>(8.0, 8.0), Point<double>(8.0, 12.0),
+      Point<double>(12.0, 12.0), Point<double>(12.0, 8.0)
+    })
+  };
+  PolygonSet<double> set(zones);
+  std::vector<std::size_t> all;
+
+  set.FindAll(Point<double>(3.0, 3.0), &all);
+  REQUIRE(all == std::vector<std::size_t>({0, 2}));
+
+  set.FindAll(Point<double>(9.0, 9.0), &all);
+  REQUIRE(all == std::vector<std::size_t>({0, 3}));
+
+  REQUIRE_EQUAL(set.Find(Point<double>(11.0, 11.0)), 3u);
+  REQUIRE_EQUAL(set.Find(Point<double>(10.0, 5.0)), 0u);
+  REQUIRE_EQUAL(set.Find(Point<double>(11.0, 5.0)),
+                PolygonSet<double>::npos);
+
+  PolygonSet<double> empty(std::vector<Zone>{});
+
+  REQUIRE_EQUAL(empty.Size(), 0u);
+  REQUIRE_EQUAL(empty.Depth(), 0u);
+  REQUIRE_EQUAL(empty.Find(Point<double>(0.0, 0.0)),
+                PolygonSet<double>::npos);
+  REQUIRE(empty.Find(std::vector<Point<double>>(3, Point<double>()), 2) ==
+          std::vector<std::size_t>(3, PolygonSet<double>::npos));
+}
+
+/**
+ * @brief Создание набора, запросы и удаление через /PolygonSet.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void SessionTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "polygons": [
+        [
+          {"x": 0.0, "y": 0.0},
+          {"x": 0.0, "y": 1.0},
+          {"x": 1.0, "y": 1.0},
+          {"x": 1.0, "y": 0.0}
+        ],
+        [
+          {"x": 1.0, "y": 0.0},
+          {"x": 1.0, "y": 1.0},
+          {"x": 2.0, "y": 1.0},
+          {"x": 2.0, "y": 0.0}
+        ]
+      ]
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/PolygonSet/Create", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE_EQUAL(output["size"].get<int>(), 2);
+
+  const std::uint64_t id = output["id"].get<std::uint64_t>();
+
+  nlohmann::json query = {
+    {"id", id},
+    {"points", {{{"x", 0.5}, {"y", 0.5}}, {{"x", 1.5}, {"y", 0.5}}}}
+  };
+
+  res = cli->Post("/PolygonSet/Query", query.dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["polygons"] == nlohmann::json({0, 1}));
+  REQUIRE_EQUAL(output["matched"].get<int>(), 2);
+
+  // Общее ребро принадлежит многоугольнику с меньшим номером.
+  query.erase("points");
+  query["coordinates"] = {1.0, 0.5, 3.0, 0.5};
+  query["threads"] = 2;
+  res = cli->Post("/PolygonSet/Query", query.dump(), "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["polygons"] == nlohmann::json({0, -1}));
+  REQUIRE_EQUAL(output["matched"].get<int>(), 1);
+
+  res = cli->Post("/PolygonSet/Delete", nlohmann::json({{"id", id}}).dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  res = cli->Post("/PolygonSet/Query", query.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  input["polygons"][1][0] = {{"x", 1.0}};
+  res = cli->Post("/PolygonSet/Create", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
@@ -8,9 +8,11 @@
 #include <limits>
 #include <utility>
 #include <list>
+#include <random>
 #include <point.hpp>
 #include <edge.hpp>
 #include <polygon.hpp>
+#include <cyclic_vector.hpp>
 #include "test_core.hpp"
 #include "test.hpp"
 
@@ -18,10 +20,20 @@
 using geometry::Point;
 using geometry::Edge;
 using geometry::Rotation;
+using geometry::CyclicVector;
 
 template<typename T>
 static void BuildTest();
 
+template<typename T>
+static void CyclicVectorTest();
+
+template<typename T>
+static void SplitTest();
+
+template<typename Container>
+static void EdgesTest();
+
 /**
  * @brief Набор тестов для класса geometry::Polygon.
  */
@@ -31,6 +43,12 @@ void TestPolygon() {
   RUN_TEST(suite, BuildTest<float>);
   RUN_TEST(suite, BuildTest<double>);
   RUN_TEST(suite, BuildTest<long double>);
+  RUN_TEST(suite, CyclicVectorTest<float>);
+  RUN_TEST(suite, CyclicVectorTest<double>);
+  RUN_TEST(suite, CyclicVectorTest<long double>);
+  RUN_TEST(suite, SplitTest<double>);
+  RUN_TEST(suite, EdgesTest<std::list<Point<double>>>);
+  RUN_TEST(suite, EdgesTest<CyclicVector<Point<double>>>);
 }
 
 /**
@@ -295,3 +313,217 @@ static void BuildTest() {
     REQUIRE_CLOSE(other.CounterClockWise()->Y(), T(4.0), eps);
   }
 }
+
+/**
+ * @brief Тест для многоугольника с контейнером geometry::CyclicVector.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ */
+template<typename T>
+static void CyclicVectorTest() {
+  using Container = CyclicVector<Point<T>>;
+  using Polygon = geometry::Polygon<T, Container>;
+
+  const T eps = std::numeric_limits<T>::epsilon() * T(1e3);
+
+  {
+    Polygon polygon;
+
+    REQUIRE_EQUAL(polygon.Size(), 0u);
+    REQUIRE(polygon.ClockWise() == polygon.Vertices().end());
+  }
+
+  {
+    Container vertices = {
+      Point(T(1.0), T(2.0)),
+      Point(T(3.0), T(4.0)),
+      Point(T(5.0), T(6.0))
+    };
+    Polygon polygon(vertices, std::next(vertices.begin(), 2));
+
+    REQUIRE_EQUAL(polygon.Size(), 3u);
+    REQUIRE_CLOSE(polygon.Current()->X(), T(5.0), eps);
+    REQUIRE_CLOSE(polygon.ClockWise()->X(), T(1.0), eps);
+    REQUIRE_CLOSE(polygon.CounterClockWise()->X(), T(3.0), eps);
+
+    const Polygon copy(polygon);
+
+    REQUIRE_CLOSE(copy.Current()->X(), T(5.0), eps);
+    REQUIRE_CLOSE(copy.ClockWise()->X(), T(1.0), eps);
+    REQUIRE_CLOSE(copy.CounterClockWise()->X(), T(3.0), eps);
+
+    Polygon moved(std::move(polygon));
+
+    REQUIRE_CLOSE(moved.Current()->X(), T(5.0), eps);
+
+    // Итератор должен ссылаться на новый контейнер.
+    moved.Current()->X() = T(7.0);
+
+    REQUIRE_CLOSE(moved.Vertices().back().X(), T(7.0), eps);
+
+    moved.Advance(Rotation::ClockWise);
+
+    REQUIRE_CLOSE(moved.Current()->X(), T(1.0), eps);
+
+    moved.Advance(Rotation::CounterClockWise);
+    moved.Advance(Rotation::CounterClockWise);
+
+    REQUIRE_CLOSE(moved.Current()->X(), T(3.0), eps);
+
+    Edge<T> edge = moved.GetEdge();
+
+    REQUIRE_CLOSE(edge.Origin().X(), T(3.0), eps);
+    REQUIRE_CLOSE(edge.Destination().X(), T(7.0), eps);
+  }
+
+  {
+    Polygon polygon(Container{
+      Point(T(1.0), T(2.0)),
+      Point(T(3.0), T(4.0))
+    });
+
+    // Итератор на текущую вершину остаётся действительным при
+    // перераспределении памяти.
+    for (int i = 0; i < 100; i++)
+      polygon.Insert(Point(T(5.0), T(6.0)));
+
+    REQUIRE_EQUAL(polygon.Size(), 102u);
+    REQUIRE_CLOSE(polygon.ClockWise()->X(), T(3.0), eps);
+
+    for (int i = 0; i < 100; i++)
+      polygon.Remove(polygon.Current());
+
+    REQUIRE_EQUAL(polygon.Size(), 2u);
+    REQUIRE_CLOSE(polygon.Current()->X(), T(1.0), eps);
+    REQUIRE_CLOSE(polygon.ClockWise()->X(), T(3.0), eps);
+  }
+}
+
+/**
+ * @brief Сравнение метода geometry::Polygon::Split() для разных контейнеров.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Результат разбиения многоугольника с контейнером geometry::CyclicVector
+ * должен совпадать с результатом для контейнера std::list.
+ */
+template<typename T>
+static void SplitTest() {
+  using ListPolygon = geometry::Polygon<T, std::list<Point<T>>>;
+  using VectorPolygon = geometry::Polygon<T, CyclicVector<Point<T>>>;
+
+  const int numTries = 100;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> sizeDist(1, 20);
+
+  auto check = [](auto polygon, const auto& expected) {
+    REQUIRE_EQUAL(polygon.Size(), expected.Size());
+
+    auto it = expected.Current();
+
+    for (std::size_t i = 0; i < expected.Size(); i++) {
+      REQUIRE(polygon.Current()->X() == it->X());
+
+      polygon.Advance(Rotation::ClockWise);
+
+      if (++it == expected.Vertices().end())
+        it = expected.Vertices().begin();
+    }
+  };
+
+  for (int it = 0; it < numTries; it++) {
+    int size = sizeDist(gen);
+    std::uniform_int_distribution<int> indexDist(0, size - 1);
+    std::list<Point<T>> listVertices;
+    CyclicVector<Point<T>> vectorVertices;
+
+    for (int i = 0; i < size; i++) {
+      listVertices.emplace_back(T(i), T(0));
+      vectorVertices.emplace_back(T(i), T(0));
+    }
+
+    int current = indexDist(gen);
+    int position = indexDist(gen);
+
+    ListPolygon listPolygon(listVertices,
+        std::next(listVertices.begin(), current));
+    VectorPolygon vectorPolygon(vectorVertices,
+        std::next(vectorVertices.begin(), current));
+
+    ListPolygon listOther = listPolygon.Split(
+        std::next(listPolygon.Vertices().begin(), position));
+    VectorPolygon vectorOther = vectorPolygon.Split(
+        std::next(vectorPolygon.Vertices().begin(), position));
+
+    check(vectorPolygon, listPolygon);
+    check(vectorOther, listOther);
+  }
+}
+
+/**
+ * @brief Тест для обхода рёбер geometry::Polygon::Edges().
+ *
+ * @tparam Container Тип контейнера для хранения вершин.
+ */
+template<typename Container>
+static void EdgesTest() {
+  using Polygon = geometry::Polygon<double, Container>;
+
+  {
+    const Polygon polygon;
+    const auto edges = polygon.Edges();
+
+    REQUIRE(edges.begin() == edges.end());
+  }
+
+  {
+    const Polygon polygon(Container{Point(1.0, 2.0)});
+    const auto edges = polygon.Edges();
+    auto edge = edges.begin();
+
+    REQUIRE(edge != edges.end());
+    REQUIRE_EQUAL(edge.Origin().X(), 1.0);
+    REQUIRE_EQUAL(edge.Destination().X(), 1.0);
+    REQUIRE(++edge == edges.end());
+  }
+
+  Polygon polygon(Container{
+    Point(1.0, 2.0),
+    Point(3.0, 4.0),
+    Point(5.0, 6.0),
+    Point(7.0, 8.0)
+  });
+
+  polygon.Advance(Rotation::ClockWise);
+  polygon.Advance(Rotation::ClockWise);
+
+  // Обход начинается с текущего ребра и совпадает с обходом GetEdge().
+  const Polygon& view = polygon;
+  Polygon copy = polygon;
+  std::size_t numEdges = 0;
+
+  for (const Edge<double>& edge : view.Edges()) {
+    Edge<double> expected = copy.GetEdge();
+
+    REQUIRE_EQUAL(edge.Origin().X(), expected.Origin().X());
+    REQUIRE_EQUAL(edge.Destination().X(), expected.Destination().X());
+
+    copy.Advance(Rotation::ClockWise);
+    numEdges++;
+  }
+
+  REQUIRE_EQUAL(numEdges, 4u);
+
+  // Начало и конец ребра --- ссылки на вершины многоугольника.
+  auto edge = view.Edges().begin();
+
+  REQUIRE(&edge.Origin() == &*polygon.Current());
+  REQUIRE(&edge.Destination() == &*polygon.ClockWise());
+
+  edge++;
+  edge++;
+
+  REQUIRE_EQUAL(edge.Origin().X(), 1.0);
+  REQUIRE_EQUAL(edge.Destination().X(), 3.0);
+}
@@ -0,0 +1,332 @@
+/**
+ * @file tests/polygon_triangulation_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для триангуляции простого многоугольника.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <monotone_polygone_triangulation.hpp>
+#include <polygon_triangulation.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::TriangulatePolygon;
+
+template<typename T>
+static double Area(const std::vector<Point<T>>& polygon);
+
+template<typename T>
+static void CheckTriangulation(const std::vector<Point<T>>& polygon,
+                               const std::vector<uint32_t>& triangles);
+
+static void SimpleTest();
+
+static void RandomTest();
+
+static void TypesTest();
+
+static void MethodTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для функции TriangulatePolygon().
+ */
+void TestPolygonTriangulation() {
+  TestSuite suite("TestPolygonTriangulation");
+
+  RUN_TEST(suite, SimpleTest);
+  RUN_TEST(suite, RandomTest);
+  RUN_TEST(suite, TypesTest);
+}
+
+/**
+ * @brief Набор тестов для метода /Triangulate.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestTriangulateMethod(httplib::Client* cli) {
+  TestSuite suite("TestTriangulateMethod");
+
+  RUN_TEST_REMOTE(suite, cli, MethodTest);
+}
+
+/**
+ * @brief Ориентированная площадь многоугольника.
+ *
+ * @tparam T Тип координат.
+ *
+ * @param polygon Вершины многоугольника.
+ * @return Площадь, положительная при обходе против часовой стрелки.
+ */
+template<typename T>
+static double Area(const std::vector<Point<T>>& polygon) {
+  double area = 0.0;
+
+  for (std::size_t i = 0; i < polygon.size(); i++) {
+    const Point<T>& a = polygon[i];
+    const Point<T>& b = polygon[(i + 1) % polygon.size()];
+
+    area += static_cast<double>(a.X()) * b.Y() -
+            static_cast<double>(b.X()) * a.Y();
+  }
+
+  return area / 2.0;
+}
+
+/**
+ * @brief Проверить триангуляцию многоугольника.
+ *
+ * Треугольников должно быть n - 2, каждый должен быть обойдён против
+ * часовой стрелки, каждая вершина должна входить хотя бы в один
+ * треугольник, а сумма площадей треугольников должна совпадать с площадью
+ * многоугольника.
+ *
+ * @tparam T Тип координат.
+ *
+ * @param polygon Вершины многоугольника.
+ * @param triangles Номера вершин треугольников, по три на треугольник.
+ */
+template<typename T>
+static void CheckTriangulation(const std::vector<Point<T>>& polygon,
+                               const std::vector<uint32_t>& triangles) {
+  const std::size_t n = polygon.size();
+
+  REQUIRE_EQUAL(triangles.size(), 3 * (n - 2));
+
+  std::vector<char> used(n, 0);
+  double area = 0.0;
+
+  for (std::size_t i = 0; i < triangles.size(); i += 3) {
+    std::vector<Point<T>> triangle;
+
+    for (std::size_t j = i; j < i + 3; j++) {
+      REQUIRE(triangles[j] < n);
+
+      used[triangles[j]] = 1;
+      triangle.push_back(polygon[triangles[j]]);
+    }
+
+    const double triangleArea = Area(triangle);
+
+    REQUIRE(triangleArea > 0.0);
+    area += triangleArea;
+  }
+
+  REQUIRE(std::count(used.begin(), used.end(), 0) == 0);
+  REQUIRE(std::fabs(area - std::fabs(Area(polygon))) <=
+          1e-9 * std::fabs(Area(polygon)));
+}
+
+/**
+ * @brief Простые многоугольники с вершинами разных типов.
+ */
+static void SimpleTest() {
+  // Выпуклый квадрат.
+  std::vector<Point<double>> square = {
+    Point<double>(0.0, 0.0), Point<double>(1.0, 0.0),
+    Point<double>(1.0, 1.0), Point<double>(0.0, 1.0)
+  };
+
+  CheckTriangulation(square, TriangulatePolygon(square));
+
+  // Вершина слияния и вершина разбиения.
+  std::vector<Point<double>> bowtie = {
+    Point<double>(0.0, 0.0), Point<double>(2.0, 1.0), Point<double>(4.0, 0.0),
+    Point<double>(4.0, 4.0), Point<double>(2.0, 3.0), Point<double>(0.0, 4.0)
+  };
+
+  CheckTriangulation(bowtie, TriangulatePolygon(bowtie));
+
+  // Тот же многоугольник, обходимый по часовой стрелке.
+  std::reverse(bowtie.begin(), bowtie.end());
+
+  CheckTriangulation(bowtie,
+                     TriangulatePolygon(bowtie,
+                                        geometry::AdaptiveOrientationPolicy()));
+
+  // Гребёнка с горизонтальными рёбрами и вершинами слияния.
+  std::vector<Point<double>> comb = {
+    Point<double>(0.0, 0.0), Point<double>(9.0, 0.0)
+  };
+
+  for (int i = 4; i >= 0; i--) {
+    for (const auto& [x, y] : {std::pair(1.0, 5.0), std::pair(0.5, 1.0),
+                               std::pair(0.0, 5.0)})
+      comb.emplace_back(2.0 * i + x, y);
+  }
+
+  CheckTriangulation(comb, TriangulatePolygon(comb));
+}
+
+/**
+ * @brief Случайные звёздные многоугольники.
+ *
+ * Вершины лежат на лучах из начала координат через равные углы со
+ * случайным сдвигом и имеют случайное расстояние до центра, поэтому
+ * многоугольник прост, но содержит много вершин разбиения и слияния.
+ * Половина многоугольников обходится по часовой стрелке.
+ */
+static void RandomTest() {
+  const int numTries = 200;
+
+  std::mt19937 gen(24);
+  std::uniform_int_distribution<std::size_t> sizeDist(3, 200);
+  std::uniform_real_distribution<double> jitterDist(-0.4, 0.4);
+  std::uniform_real_distribution<double> radiusDist(1.0, 100.0);
+  std::bernoulli_distribution coin(0.5);
+
+  for (int it = 0; it < numTries; it++) {
+    const std::size_t size = sizeDist(gen);
+    const double step = 2.0 * M_PI / size;
+    std::vector<Point<double>> polygon;
+
+    for (std::size_t i = 0; i < size; i++) {
+      const double angle = step * (i + jitterDist(gen));
+      const double radius = radiusDist(gen);
+
+      polygon.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+
+    if (coin(gen))
+      std::reverse(polygon.begin(), polygon.end());
+
+    CheckTriangulation(polygon, TriangulatePolygon(polygon));
+  }
+}
+
+/**
+ * @brief Триангуляция многоугольников с координатами типов float и
+ * int64_t.
+ *
+ * Гребёнка с целыми координатами триангулируется для каждого типа, а
+ * монотонная "пила" --- также функцией TriangulateMonotonePolygon().
+ */
+static void TypesTest() {
+  std::vector<Point<float>> floatComb = {
+    Point<float>(0.0f, 0.0f), Point<float>(12.0f, 0.0f)
+  };
+  std::vector<Point<int64_t>> intComb = {
+    Point<int64_t>(0, 0), Point<int64_t>(12, 0)
+  };
+
+  for (int i = 3; i >= 0; i--) {
+    for (const auto& [x, y] : {std::pair(3, 7), std::pair(2, 1),
+                               std::pair(1, 7)}) {
+      floatComb.emplace_back(static_cast<float>(3 * i + x),
+                             static_cast<float>(y));
+      intComb.emplace_back(3 * i + x, y);
+    }
+  }
+
+  CheckTriangulation(floatComb, TriangulatePolygon(floatComb));
+  CheckTriangulation(intComb, TriangulatePolygon(intComb));
+  REQUIRE(TriangulatePolygon(intComb) ==
+          TriangulatePolygon(intComb, geometry::AdaptiveOrientationPolicy()));
+
+  // Вершины "пилы" чередуются между левой и правой цепями.
+  std::vector<Point<int64_t>> saw;
+
+  for (int64_t y = 20; y >= 0; y -= 2)
+    saw.emplace_back(-1 - (y % 4), y);
+
+  for (int64_t y = 1; y < 20; y += 2)
+    saw.emplace_back(1 + (y % 3), y);
+
+  CheckTriangulation(saw, geometry::TriangulateMonotonePolygon(saw));
+  CheckTriangulation(saw, TriangulatePolygon(saw));
+}
+
+/**
+ * @brief Тест метода /Triangulate.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void MethodTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "polygon": [
+        {"x": 0.0, "y": 0.0},
+        {"x": 4.0, "y": 0.0},
+        {"x": 4.0, "y": 4.0},
+        {"x": 2.0, "y": 1.0},
+        {"x": 0.0, "y": 4.0}
+      ]
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/Triangulate", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE_EQUAL(output["triangles_count"].get<int>(), 3);
+  REQUIRE_EQUAL(output["vertices_count"].get<int>(), 5);
+
+  std::vector<Point<double>> polygon;
+
+  for (const auto& point_json : input["polygon"]) {
+    polygon.emplace_back(point_json["x"].get<double>(),
+                         point_json["y"].get<double>());
+  }
+
+  CheckTriangulation(polygon,
+                     output["triangles"].get<std::vector<uint32_t>>());
+
+  input["predicate"] = "exact";
+  res = cli->Post("/Triangulate", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  CheckTriangulation(polygon,
+                     output["triangles"].get<std::vector<uint32_t>>());
+
+  input["predicate"] = "fast";
+  res = cli->Post("/Triangulate", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  input.erase("predicate");
+  input["polygon"].erase(2);
+  input["polygon"].erase(2);
+  input["polygon"].erase(2);
+  res = cli->Post("/Triangulate", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  // Самокасающийся многоугольник: два ребра пересекают заметающую прямую
+  // в одной точке. Метод должен вернуть ошибку, а не уронить сервер.
+  nlohmann::json touching = R"(
+    {
+      "polygon": [
+        {"x": 0.0, "y": 2.0},
+        {"x": 2.0, "y": 3.0},
+        {"x": 2.0, "y": 0.0},
+        {"x": 2.0, "y": 3.0}
+      ]
+    }
+  )"_json;
+
+  res = cli->Post("/Triangulate", touching.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE_EQUAL(std::string("polygon is not simple"),
+                output["error"].get<std::string>());
+}
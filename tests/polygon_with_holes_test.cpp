@@ -0,0 +1,270 @@
+/**
+ * @file tests/polygon_with_holes_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса PolygonWithHoles.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <polygon.hpp>
+#include <cyclic_vector.hpp>
+#include <point_in_polygon.hpp>
+#include <polygon_with_holes.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::CyclicVector;
+using geometry::PointPosition;
+using geometry::PolygonWithHoles;
+
+//! Кольцо многоугольника с дырами, используемое в тестах.
+using Ring = geometry::Polygon<double, CyclicVector<Point<double>>>;
+
+static void SquareTest();
+
+static void RandomTest();
+
+static void MethodTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonWithHoles.
+ */
+void TestPolygonWithHoles() {
+  TestSuite suite("TestPolygonWithHoles");
+
+  RUN_TEST(suite, SquareTest);
+  RUN_TEST(suite, RandomTest);
+}
+
+/**
+ * @brief Набор тестов для метода /PointInPolygonWithHoles и параметра
+ * "holes" метода /PointInPolygonBatch.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestPolygonWithHolesMethod(httplib::Client* cli) {
+  TestSuite suite("TestPolygonWithHolesMethod");
+
+  RUN_TEST_REMOTE(suite, cli, MethodTest);
+}
+
+/**
+ * @brief Квадрат с двумя дырами, обходимыми в разных направлениях.
+ */
+static void SquareTest() {
+  const Ring outer(CyclicVector<Point<double>>{
+    Point<double>(0.0, 0.0), Point<double>(0.0, 10.0),
+    Point<double>(10.0, 10.0), Point<double>(10.0, 0.0)
+  });
+  const std::vector<Ring> holes = {
+    Ring(CyclicVector<Point<double>>{
+      Point<double>(2.0, 2.0), Point<double>(2.0, 4.0),
+      Point<double>(4.0, 4.0), Point<double>(4.0, 2.0)
+    }),
+    Ring(),
+    Ring(CyclicVector<Point<double>>{
+      Point<double>(6.0, 6.0), Point<double>(8.0, 6.0),
+      Point<double>(7.0, 8.0)
+    })
+  };
+  const PolygonWithHoles<double> polygon(outer, holes);
+
+  REQUIRE_EQUAL(polygon.Size(), 11u);
+  REQUIRE_EQUAL(polygon.NumHoles(), 3u);
+  REQUIRE_EQUAL(polygon.Lower().X(), 0.0);
+  REQUIRE_EQUAL(polygon.Upper().Y(), 10.0);
+
+  auto position = [&polygon](double x, double y) {
+    return polygon.Classify(Point<double>(x, y));
+  };
+
+  REQUIRE(position(1.0, 1.0) == PointPosition::INSIDE);
+  REQUIRE(position(5.0, 3.0) == PointPosition::INSIDE);
+  REQUIRE(position(1.0, 3.0) == PointPosition::INSIDE);
+  REQUIRE(position(6.2, 7.0) == PointPosition::INSIDE);
+  REQUIRE(position(3.0, 3.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(7.0, 7.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(-1.0, 3.0) == PointPosition::OUTSIDE);
+  REQUIRE(position(11.0, 7.0) == PointPosition::OUTSIDE);
+
+  REQUIRE(position(0.0, 5.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(2.0, 3.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(4.0, 4.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(7.0, 6.0) == PointPosition::BOUNDARY);
+  REQUIRE(position(7.0, 8.0) == PointPosition::BOUNDARY);
+
+  const PolygonWithHoles<double> empty(Ring(), holes);
+
+  REQUIRE_EQUAL(empty.Size(), 0u);
+  REQUIRE(empty.Classify(Point<double>(3.0, 3.0)) == PointPosition::OUTSIDE);
+  REQUIRE(PolygonWithHoles<double>().Classify(Point<double>()) ==
+          PointPosition::OUTSIDE);
+}
+
+/**
+ * @brief Сравнение с отдельной проверкой каждого кольца.
+ *
+ * Внешнее кольцо --- невыпуклая "гистограмма" со столбцами ширины 4 и
+ * случайной высоты, дыры --- случайные четырёхугольники в нижней части
+ * некоторых столбцов, обходимые в случайном направлении. Точки берутся на
+ * сетке с шагом 0.5, поэтому многие из них попадают на вершины и рёбра.
+ */
+static void RandomTest() {
+  const int numTries = 50;
+
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> columnsDist(1, 12);
+  std::uniform_int_distribution<int> heightDist(10, 20);
+  std::uniform_int_distribution<int> radiusDist(1, 3);
+  std::bernoulli_distribution coin(0.5);
+
+  for (int it = 0; it < numTries; it++) {
+    const int columns = columnsDist(gen);
+    CyclicVector<Point<double>> outerVertices;
+    std::vector<Ring> holes;
+
+    outerVertices.emplace_back(0.0, 0.0);
+
+    for (int i = 0; i < columns; i++) {
+      const double height = heightDist(gen);
+
+      outerVertices.emplace_back(4.0 * i, height);
+      outerVertices.emplace_back(4.0 * (i + 1), height);
+
+      if (!coin(gen))
+        continue;
+
+      const double cx = 4.0 * i + 2.0;
+      const double cy = 5.0;
+      CyclicVector<Point<double>> hole{
+        Point<double>(cx + 1.0, cy), Point<double>(cx, cy + radiusDist(gen)),
+        Point<double>(cx - 1.0, cy), Point<double>(cx, cy - radiusDist(gen))
+      };
+
+      if (coin(gen))
+        std::reverse(hole.begin(), hole.end());
+
+      holes.emplace_back(std::move(hole));
+    }
+
+    outerVertices.emplace_back(4.0 * columns, 0.0);
+
+    const Ring outer(std::move(outerVertices));
+    const PolygonWithHoles<double> polygon(outer, holes);
+    std::vector<Point<double>> points;
+
+    for (double x = -1.0; x <= 4.0 * columns + 1.0; x += 0.5) {
+      for (double y = -1.0; y <= 21.0; y += 0.5)
+        points.emplace_back(x, y);
+    }
+
+    const std::vector<PointPosition> parallel = polygon.Classify(points, 4);
+
+    for (std::size_t i = 0; i < points.size(); i++) {
+      PointPosition expected =
+          geometry::WindingNumberPointInPolygon(points[i], outer);
+
+      for (const Ring& hole : holes) {
+        const PointPosition inHole =
+            geometry::WindingNumberPointInPolygon(points[i], hole);
+
+        if (inHole == PointPosition::BOUNDARY)
+          expected = PointPosition::BOUNDARY;
+        else if (inHole == PointPosition::INSIDE &&
+                 expected == PointPosition::INSIDE)
+          expected = PointPosition::OUTSIDE;
+      }
+
+      REQUIRE(polygon.Classify(points[i]) == expected);
+      REQUIRE(parallel[i] == expected);
+    }
+  }
+}
+
+/**
+ * @brief Тест метода /PointInPolygonWithHoles и параметра "holes" метода
+ * /PointInPolygonBatch.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void MethodTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "point": {"x": 1.5, "y": 1.5},
+      "polygon": [
+        {"x": 0.0, "y": 0.0},
+        {"x": 0.0, "y": 4.0},
+        {"x": 4.0, "y": 4.0},
+        {"x": 4.0, "y": 0.0}
+      ],
+      "holes": [
+        [
+          {"x": 1.0, "y": 1.0},
+          {"x": 1.0, "y": 2.0},
+          {"x": 2.0, "y": 2.0},
+          {"x": 2.0, "y": 1.0}
+        ]
+      ]
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/PointInPolygonWithHoles", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "outside");
+  REQUIRE_EQUAL(output["polygon_size"].get<int>(), 8);
+  REQUIRE_EQUAL(output["holes"].get<int>(), 1);
+
+  input["point"] = {{"x", 1.0}, {"y", 1.5}};
+  res = cli->Post("/PointInPolygonWithHoles", input.dump(),
+                  "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "boundary");
+
+  input["point"] = {{"x", 3.0}, {"y", 1.5}};
+  res = cli->Post("/PointInPolygonWithHoles", input.dump(),
+                  "application/json");
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["position"] == "inside");
+
+  nlohmann::json batch = {
+    {"polygon", input["polygon"]},
+    {"holes", input["holes"]},
+    {"coordinates", {1.5, 1.5, 1.0, 1.5, 3.0, 1.5, 5.0, 1.5}}
+  };
+
+  res = cli->Post("/PointInPolygonBatch", batch.dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["positions"] == "obio");
+  REQUIRE(output["path"] == "holes");
+  REQUIRE_EQUAL(output["holes"].get<int>(), 1);
+
+  batch["method"] = "grid";
+  res = cli->Post("/PointInPolygonBatch", batch.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  input["holes"][0][1] = {{"y", 2.0}};
+  res = cli->Post("/PointInPolygonWithHoles", input.dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
@@ -0,0 +1,201 @@
+/**
+ * @file tests/predicates_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для адаптивного предиката ориентации.
+ */
+
+#include <limits>
+#include <random>
+#include <vector>
+#include <point.hpp>
+#include <edge.hpp>
+#include <orientation.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::Edge;
+using geometry::Intersection;
+using geometry::OrientationStatistics;
+using geometry::AdaptiveOrientationPolicy;
+
+template<typename T>
+static void NearDegenerateTest();
+
+template<typename T>
+static void RandomTest();
+
+template<typename T>
+static void EdgeTest();
+
+template<typename T>
+static void GrahamScanTest();
+
+/**
+ * @brief Набор тестов для функции geometry::AdaptiveOrientation().
+ */
+void TestPredicates() {
+  TestSuite suite("TestPredicates");
+
+  RUN_TEST(suite, NearDegenerateTest<float>);
+  RUN_TEST(suite, NearDegenerateTest<double>);
+  RUN_TEST(suite, NearDegenerateTest<long double>);
+  RUN_TEST(suite, RandomTest<float>);
+  RUN_TEST(suite, RandomTest<double>);
+  RUN_TEST(suite, RandomTest<long double>);
+  RUN_TEST(suite, RandomTest<int>);
+  RUN_TEST(suite, EdgeTest<double>);
+  RUN_TEST(suite, GrahamScanTest<double>);
+}
+
+/**
+ * @brief Точки, отстоящие от прямой на несколько единиц младшего разряда.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Точка \f$ (0.5 + i u, 0.5 + j u) \f$, где \f$ u \f$ --- единица младшего
+ * разряда числа 0.5, лежит слева от прямой \f$ y = x \f$ тогда и только
+ * тогда, когда \f$ j > i \f$.
+ */
+template<typename T>
+static void NearDegenerateTest() {
+  const T ulp = std::numeric_limits<T>::epsilon() / T(2);
+  const int size = 64;
+  Point<T> b(T(12.0), T(12.0));
+  Point<T> c(T(24.0), T(24.0));
+  OrientationStatistics statistics;
+
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      Point<T> a(T(0.5) + T(i) * ulp, T(0.5) + T(j) * ulp);
+      int expected = j > i ? 1 : (j < i ? -1 : 0);
+
+      REQUIRE_EQUAL(geometry::AdaptiveOrientation(a, b, c, &statistics),
+                    expected);
+      REQUIRE_EQUAL(geometry::AdaptiveOrientation(b, c, a, &statistics),
+                    expected);
+      REQUIRE_EQUAL(geometry::AdaptiveOrientation(c, a, b, &statistics),
+                    expected);
+      REQUIRE_EQUAL(geometry::AdaptiveOrientation(b, a, c, &statistics),
+                    -expected);
+    }
+  }
+
+  REQUIRE_EQUAL(statistics.calls, 4u * size * size);
+  REQUIRE(statistics.exactCalls > 0);
+}
+
+/**
+ * @brief Сравнение со скалярной функцией Orientation() на случайных точках.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Для точек общего положения почти все вызовы должны обрабатываться
+ * фильтром без точной арифметики.
+ */
+template<typename T>
+static void RandomTest() {
+  const int numTries = 10000;
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> coordDist(-1000.0, 1000.0);
+  OrientationStatistics statistics;
+  AdaptiveOrientationPolicy orientation(&statistics);
+
+  for (int it = 0; it < numTries; it++) {
+    Point<T> p0(T(coordDist(gen)), T(coordDist(gen)));
+    Point<T> p1(T(coordDist(gen)), T(coordDist(gen)));
+    Point<T> p2(T(coordDist(gen)), T(coordDist(gen)));
+
+    int result = orientation(p0, p1, p2);
+
+    if (geometry::Orientation(p0, p1, p2, T(1e-2)) != 0)
+      REQUIRE_EQUAL(result, geometry::Orientation(p0, p1, p2, T(0)));
+  }
+
+  REQUIRE_EQUAL(statistics.calls, static_cast<std::uint64_t>(numTries));
+  REQUIRE(statistics.exactCalls * 100 <= statistics.calls);
+}
+
+/**
+ * @brief Тест для метода geometry::Edge::Intersect() со стратегией.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ */
+template<typename T>
+static void EdgeTest() {
+  AdaptiveOrientationPolicy orientation;
+  T t = T(0);
+
+  {
+    Edge<T> e1(Point(T(0.0), T(0.0)), Point(T(1.0), T(1.0)));
+    Edge<T> e2(Point(T(0.0), T(1.0)), Point(T(3.0), T(4.0)));
+
+    REQUIRE(e1.Intersect(e2, &t, orientation) == Intersection::Parallel);
+  }
+
+  {
+    Edge<T> e1(Point(T(0.0), T(0.0)), Point(T(1.0), T(1.0)));
+    Edge<T> e2(Point(T(2.0), T(2.0)), Point(T(3.0), T(3.0)));
+
+    REQUIRE(e1.Intersect(e2, &t, orientation) == Intersection::Collinear);
+  }
+
+  {
+    Edge<T> e1(Point(T(0.0), T(0.0)), Point(T(2.0), T(2.0)));
+    Edge<T> e2(Point(T(0.0), T(2.0)), Point(T(2.0), T(0.0)));
+
+    REQUIRE(e1.Cross(e2, &t, orientation) == Intersection::SkewCross);
+    REQUIRE_CLOSE(t, T(0.5), std::numeric_limits<T>::epsilon() * T(1e3));
+  }
+
+  {
+    // Абсолютная точность 1e-9 больше знаменателя 1e-12, поэтому функция
+    // с точностью ошибочно считает рёбра параллельными или коллинеарными.
+    Edge<T> e1(Point(T(0.0), T(0.0)), Point(T(1e-6), T(0.0)));
+    Edge<T> e2(Point(T(0.0), T(1e-6)), Point(T(1e-6), T(2e-6)));
+
+    REQUIRE(e1.Intersect(e2, &t, T(1e-9)) != Intersection::Skew);
+    REQUIRE(e1.Intersect(e2, &t, orientation) == Intersection::Skew);
+    REQUIRE_CLOSE(t, T(-1.0), std::numeric_limits<T>::epsilon() * T(1e3));
+  }
+}
+
+/**
+ * @brief Тест для функции geometry::GrahamScan() со стратегией.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * На целочисленной сетке обычная арифметика точна, поэтому результаты
+ * должны совпадать.
+ */
+template<typename T>
+static void GrahamScanTest() {
+  const int numTries = 100;
+
+  std::mt19937 gen(2);
+  std::uniform_int_distribution<int> coordDist(-10, 10);
+  std::uniform_int_distribution<std::size_t> sizeDist(1, 100);
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<Point<T>> points(sizeDist(gen));
+
+    for (auto& point : points)
+      point = Point<T>(T(coordDist(gen)), T(coordDist(gen)));
+
+    std::vector<Point<T>> expected = geometry::GrahamScan(points);
+    std::vector<Point<T>> result = geometry::GrahamScan(points,
+        AdaptiveOrientationPolicy());
+
+    REQUIRE_EQUAL(result.size(), expected.size());
+
+    for (std::size_t i = 0; i < result.size(); i++) {
+      REQUIRE(result[i].X() == expected[i].X());
+      REQUIRE(result[i].Y() == expected[i].Y());
+    }
+  }
+}
@@ -0,0 +1,268 @@
+/**
+ * @file tests/rotating_calipers_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для функции RotatingCalipers().
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <rotating_calipers.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::AdaptiveOrientationPolicy;
+
+template<typename T>
+static void RandomTest();
+
+static void DegenerateTest();
+
+static void SimpleTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для функции geometry::RotatingCalipers().
+ */
+void TestRotatingCalipers() {
+  TestSuite suite("TestRotatingCalipers");
+
+  RUN_TEST(suite, RandomTest<float>);
+  RUN_TEST(suite, RandomTest<double>);
+  RUN_TEST(suite, DegenerateTest);
+}
+
+/**
+ * @brief Набор тестов для метода /RotatingCalipers.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestRotatingCalipersMethod(httplib::Client* cli) {
+  TestSuite suite("TestRotatingCalipersMethod");
+
+  RUN_TEST_REMOTE(suite, cli, SimpleTest);
+}
+
+/**
+ * @brief Сравнение с перебором за \f$ O(h^2) \f$.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Диаметр сравнивается с наибольшим расстоянием между вершинами, ширина и
+ * прямоугольники --- с перебором всех рёбер. Пара вершин антиподальна,
+ * если через них проходят параллельные опорные прямые, т.е. конусы
+ * внешних нормалей в вершинах пересекаются после отражения одного из них.
+ */
+template<typename T>
+static void RandomTest() {
+  const int numTries = 100;
+  const int maxPoints = 200;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> sizeDist(3, maxPoints);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-8, 8);
+  AdaptiveOrientationPolicy orientation;
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<Point<T>> points(sizeDist(gen));
+
+    for (auto& point : points) {
+      if (it % 2 == 0)
+        point = Point<T>(T(coordDist(gen)), T(coordDist(gen)));
+      else
+        point = Point<T>(T(gridDist(gen)), T(gridDist(gen)));
+    }
+
+    std::vector<Point<T>> hull = geometry::GrahamScan(points, orientation);
+    const std::size_t h = hull.size();
+
+    if (h < 3)
+      continue;
+
+    geometry::HullMetrics<T> metrics = geometry::RotatingCalipers(hull);
+    const T precision = T(1e-3) * (T(1) + metrics.diameter);
+
+    T diameter = 0;
+
+    for (std::size_t i = 0; i < h; i++) {
+      for (std::size_t j = i + 1; j < h; j++)
+        diameter = std::max(diameter, (hull[i] - hull[j]).Length());
+    }
+
+    REQUIRE(std::abs(metrics.diameter - diameter) <= precision);
+    REQUIRE(std::abs((hull[metrics.diameterPair.first] -
+                      hull[metrics.diameterPair.second]).Length() -
+                     diameter) <= precision);
+
+    T width = 0;
+    T area = 0;
+    T perimeter = 0;
+
+    for (std::size_t i = 0; i < h; i++) {
+      Point<T> e = hull[(i + 1) % h] - hull[i];
+      Point<T> u = (T(1) / e.Length()) * e;
+      Point<T> n(-u.Y(), u.X());
+      T minProjection = 0, maxProjection = 0, height = 0;
+
+      for (const auto& vertex : hull) {
+        minProjection = std::min(minProjection, u * (vertex - hull[i]));
+        maxProjection = std::max(maxProjection, u * (vertex - hull[i]));
+        height = std::max(height, n * (vertex - hull[i]));
+      }
+
+      T rectangleWidth = maxProjection - minProjection;
+
+      if (i == 0 || height < width)
+        width = height;
+
+      if (i == 0 || rectangleWidth * height < area)
+        area = rectangleWidth * height;
+
+      if (i == 0 || rectangleWidth + height < perimeter / 2)
+        perimeter = 2 * (rectangleWidth + height);
+    }
+
+    REQUIRE(std::abs(metrics.width - width) <= precision);
+    REQUIRE(std::abs(metrics.minAreaRectangle.Area() - area) <=
+            precision * metrics.diameter);
+    REQUIRE(std::abs(metrics.minPerimeterRectangle.Perimeter() - perimeter) <=
+            precision);
+
+    // Все вершины лежат в прямоугольнике.
+    const auto& corners = metrics.minAreaRectangle.corners;
+
+    for (const auto& vertex : hull) {
+      for (std::size_t k = 0; k < 4; k++) {
+        Point<T> side = corners[(k + 1) % 4] - corners[k];
+        Point<T> d = vertex - corners[k];
+
+        REQUIRE(side.X() * d.Y() - side.Y() * d.X() >=
+                -precision * metrics.diameter);
+      }
+    }
+
+    // Перебор антиподальных пар: вершины i и j антиподальны, если
+    // существует направление, в котором i наибольшая, а j наименьшая
+    // проекция. Направления-кандидаты --- нормали рёбер.
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+
+    auto cross = [](const Point<T>& a, const Point<T>& b) {
+      return a.X() * b.Y() - a.Y() * b.X();
+    };
+
+    for (std::size_t i = 0; i < h; i++) {
+      for (std::size_t j = i + 1; j < h; j++) {
+        // Вершина j лежит между опорными прямыми, параллельными рёбрам,
+        // смежным с i, тогда и только тогда, когда одно из рёбер i или j
+        // при сдвиге на другую вершину остаётся опорным.
+        auto supports = [&](std::size_t a, std::size_t b) {
+          Point<T> prev = hull[a] - hull[(a + h - 1) % h];
+          Point<T> next = hull[(a + 1) % h] - hull[a];
+          Point<T> bPrev = hull[b] - hull[(b + h - 1) % h];
+          Point<T> bNext = hull[(b + 1) % h] - hull[b];
+
+          // Направление, противоположное одному из рёбер при b, лежит
+          // между направлениями рёбер при a.
+          return (cross(prev, -T(1) * bNext) >= 0 &&
+                  cross(-T(1) * bNext, next) >= 0) ||
+                 (cross(prev, -T(1) * bPrev) >= 0 &&
+                  cross(-T(1) * bPrev, next) >= 0);
+        };
+
+        if (supports(i, j) || supports(j, i))
+          pairs.emplace_back(i, j);
+      }
+    }
+
+    if (it % 2 == 1)
+      REQUIRE(pairs == metrics.antipodalPairs);
+  }
+}
+
+/**
+ * @brief Оболочки из одной и двух точек и прямоугольник.
+ */
+static void DegenerateTest() {
+  geometry::HullMetrics<double> metrics = geometry::RotatingCalipers(
+      std::vector<Point<double>>());
+
+  REQUIRE_EQUAL(metrics.diameter, 0.0);
+  REQUIRE(metrics.antipodalPairs.empty());
+
+  metrics = geometry::RotatingCalipers(
+      std::vector<Point<double>>{Point<double>(1.0, 2.0)});
+
+  REQUIRE_EQUAL(metrics.diameter, 0.0);
+  REQUIRE_EQUAL(metrics.minAreaRectangle.Area(), 0.0);
+
+  metrics = geometry::RotatingCalipers(std::vector<Point<double>>{
+      Point<double>(0.0, 0.0), Point<double>(3.0, 4.0)});
+
+  REQUIRE_EQUAL(metrics.diameter, 5.0);
+  REQUIRE_EQUAL(metrics.width, 0.0);
+  REQUIRE_EQUAL(metrics.minPerimeterRectangle.Perimeter(), 10.0);
+  REQUIRE_EQUAL(metrics.antipodalPairs.size(), 1u);
+
+  metrics = geometry::RotatingCalipers(std::vector<Point<double>>{
+      Point<double>(0.0, 0.0), Point<double>(4.0, 0.0),
+      Point<double>(4.0, 2.0), Point<double>(0.0, 2.0)});
+
+  REQUIRE_EQUAL(metrics.width, 2.0);
+  REQUIRE_EQUAL(metrics.minAreaRectangle.Area(), 8.0);
+  REQUIRE_EQUAL(metrics.minPerimeterRectangle.Perimeter(), 12.0);
+  REQUIRE_EQUAL(metrics.antipodalPairs.size(), 6u);
+}
+
+/**
+ * @brief Простой тест для метода /RotatingCalipers.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void SimpleTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0},
+        {"x": 4.0, "y": 0.0},
+        {"x": 4.0, "y": 2.0},
+        {"x": 0.0, "y": 2.0},
+        {"x": 1.0, "y": 1.0},
+        {"x": 2.0, "y": 0.0}
+      ]
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/RotatingCalipers", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  REQUIRE_EQUAL(output["hull_size"].get<int>(), 4);
+  REQUIRE_EQUAL(output["convex_hull"].size(), 4u);
+  REQUIRE(std::abs(output["diameter"]["length"].get<double>() -
+                   std::sqrt(20.0)) < 1e-12);
+  REQUIRE_EQUAL(output["width"]["length"].get<double>(), 2.0);
+  REQUIRE_EQUAL(output["min_area_rectangle"]["area"].get<double>(), 8.0);
+  REQUIRE_EQUAL(output["min_area_rectangle"]["corners"].size(), 4u);
+  REQUIRE_EQUAL(output["min_perimeter_rectangle"]["perimeter"].get<double>(),
+                12.0);
+  REQUIRE(output["antipodal_pairs"] ==
+          nlohmann::json({{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}}));
+
+  input["predicate"] = "random";
+
+  res = cli->Post("/RotatingCalipers", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
@@ -0,0 +1,332 @@
+/**
+ * @file tests/sliding_window_convex_hull_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса SlidingWindowConvexHull.
+ */
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <sliding_window_convex_hull.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::SlidingWindowConvexHull;
+using geometry::AdaptiveOrientationPolicy;
+
+template<typename T>
+static void CountWindowTest();
+
+static void TimeWindowTest();
+
+static void SessionTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для класса geometry::SlidingWindowConvexHull.
+ */
+void TestSlidingWindowConvexHull() {
+  TestSuite suite("TestSlidingWindowConvexHull");
+
+  RUN_TEST(suite, CountWindowTest<float>);
+  RUN_TEST(suite, CountWindowTest<double>);
+  RUN_TEST(suite, CountWindowTest<int>);
+  RUN_TEST(suite, TimeWindowTest);
+}
+
+/**
+ * @brief Набор тестов для сессий /SlidingWindowConvexHull.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestSlidingWindowConvexHullSession(httplib::Client* cli) {
+  TestSuite suite("TestSlidingWindowConvexHullSession");
+
+  RUN_TEST_REMOTE(suite, cli, SessionTest);
+}
+
+/**
+ * @brief Сравнить оболочку окна с geometry::GrahamScan() точек окна.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ * @param window Окно.
+ * @param points Точки окна.
+ */
+template<typename T>
+static void CheckWindow(const SlidingWindowConvexHull<T>& window,
+                        const std::deque<Point<T>>& points) {
+  std::vector<Point<T>> expected = geometry::GrahamScan(
+      std::vector<Point<T>>(points.begin(), points.end()),
+      AdaptiveOrientationPolicy());
+  std::vector<Point<T>> result = window.Hull();
+
+  // Для совпадающих точек GrahamScan() возвращает обе копии.
+  if (expected.size() == 2 &&
+      expected[0].X() == expected[1].X() &&
+      expected[0].Y() == expected[1].Y())
+    expected.pop_back();
+
+  REQUIRE_EQUAL(window.Size(), points.size());
+  REQUIRE_EQUAL(result.size(), expected.size());
+
+  for (std::size_t i = 0; i < result.size(); i++) {
+    REQUIRE(result[i].X() == expected[i].X());
+    REQUIRE(result[i].Y() == expected[i].Y());
+  }
+}
+
+/**
+ * @brief Окно из последних N точек.
+ *
+ * @tparam T Тип данных, используемый для арифметики.
+ *
+ * Каждый второй тест использует маленькую целочисленную сетку, чтобы
+ * среди точек были повторяющиеся и коллинеарные.
+ */
+template<typename T>
+static void CountWindowTest() {
+  const int numTries = 20;
+  const int numPoints = 300;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<std::size_t> capacityDist(1, 50);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-5, 5);
+
+  for (int it = 0; it < numTries; it++) {
+    std::size_t capacity = capacityDist(gen);
+    SlidingWindowConvexHull<T> window(capacity);
+    std::deque<Point<T>> points;
+
+    REQUIRE(window.Empty());
+    REQUIRE(window.Hull().empty());
+
+    for (int i = 0; i < numPoints; i++) {
+      Point<T> point;
+
+      if (it % 2 == 0)
+        point = Point<T>(T(coordDist(gen)), T(coordDist(gen)));
+      else
+        point = Point<T>(T(gridDist(gen)), T(gridDist(gen)));
+
+      std::size_t expired = window.Push(point);
+
+      points.push_back(point);
+
+      REQUIRE_EQUAL(expired, points.size() > capacity ? 1u : 0u);
+
+      if (points.size() > capacity)
+        points.pop_front();
+
+      CheckWindow(window, points);
+    }
+
+    while (!points.empty()) {
+      REQUIRE(window.Oldest().X() == points.front().X());
+      REQUIRE(window.Oldest().Y() == points.front().Y());
+
+      window.Pop();
+      points.pop_front();
+
+      CheckWindow(window, points);
+    }
+
+    REQUIRE_THROW(window.Pop(), std::logic_error);
+  }
+}
+
+/**
+ * @brief Окно по времени поступления точек.
+ */
+static void TimeWindowTest() {
+  const int numPoints = 500;
+  const double duration = 10.0;
+
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::exponential_distribution<double> delayDist(1.0);
+
+  SlidingWindowConvexHull<double> window(0, duration);
+  std::deque<std::pair<Point<double>, double>> points;
+  double time = 0.0;
+
+  for (int i = 0; i < numPoints; i++) {
+    Point<double> point(coordDist(gen), coordDist(gen));
+
+    time += delayDist(gen);
+    window.Push(point, time);
+    points.emplace_back(point, time);
+
+    while (points.front().second < time - duration)
+      points.pop_front();
+
+    std::deque<Point<double>> expected;
+
+    for (const auto& entry : points)
+      expected.push_back(entry.first);
+
+    REQUIRE_EQUAL(window.OldestTime(), points.front().second);
+    CheckWindow(window, expected);
+  }
+
+  // Более раннее время нарушило бы порядок удаления точек.
+  const std::size_t size = window.Size();
+
+  REQUIRE_THROW(window.Push(Point<double>(0.0, 0.0), time - 1.0),
+                std::invalid_argument);
+  REQUIRE_EQUAL(window.Size(), size);
+  REQUIRE_EQUAL(window.LatestTime(), time);
+}
+
+/**
+ * @brief Тест сессии /SlidingWindowConvexHull.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void SessionTest(httplib::Client* cli) {
+  nlohmann::json input = R"(
+    {
+      "window" : 4
+    }
+  )"_json;
+
+  httplib::Result res = cli->Post("/SlidingWindowConvexHull/Create",
+                                  input.dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+  uint64_t id = output["id"].get<uint64_t>();
+
+  REQUIRE_EQUAL(output["size"].get<int>(), 0);
+
+  input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0},
+        {"x": 4.0, "y": 0.0},
+        {"x": 4.0, "y": 4.0},
+        {"x": 0.0, "y": 4.0},
+        {"x": 1.0, "y": 1.0},
+        {"x": 2.0, "y": 1.0}
+      ]
+    }
+  )"_json;
+  input["id"] = id;
+
+  res = cli->Post("/SlidingWindowConvexHull/Push", input.dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE_EQUAL(output["size"].get<int>(), 4);
+  REQUIRE_EQUAL(output["expired"].get<int>(), 2);
+
+  res = cli->Post("/SlidingWindowConvexHull/Hull",
+                  nlohmann::json({{"id", id}}).dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["convex_hull"] == R"(
+    [
+      {"x": 0.0, "y": 4.0},
+      {"x": 1.0, "y": 1.0},
+      {"x": 2.0, "y": 1.0},
+      {"x": 4.0, "y": 4.0}
+    ]
+  )"_json);
+
+  res = cli->Post("/SlidingWindowConvexHull/Delete",
+                  nlohmann::json({{"id", id}}).dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  res = cli->Post("/SlidingWindowConvexHull/Hull",
+                  nlohmann::json({{"id", id}}).dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  res = cli->Post("/SlidingWindowConvexHull/Create",
+                  R"({"duration": -1.0})", "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  // Без ограничения по количеству сессия хранила бы все точки.
+  res = cli->Post("/SlidingWindowConvexHull/Create",
+                  R"({"window": 1048577})", "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  res = cli->Post("/SlidingWindowConvexHull/Create",
+                  R"({"window": 0})", "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  res = cli->Post("/SlidingWindowConvexHull/Create",
+                  R"({"duration": 10.0})", "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  id = nlohmann::json::parse(res->body)["id"].get<uint64_t>();
+
+  input = R"(
+    {
+      "points" : [
+        {"x": 0.0, "y": 0.0, "t": 5.0}
+      ]
+    }
+  )"_json;
+  input["id"] = id;
+
+  res = cli->Post("/SlidingWindowConvexHull/Push", input.dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  // Убывающее время отклоняется вместе со всем запросом.
+  input = R"(
+    {
+      "points" : [
+        {"x": 1.0, "y": 0.0, "t": 6.0},
+        {"x": 1.0, "y": 1.0, "t": 4.0}
+      ]
+    }
+  )"_json;
+  input["id"] = id;
+
+  res = cli->Post("/SlidingWindowConvexHull/Push", input.dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  input["points"] = R"([{"x": 1.0, "y": 1.0, "t": 4.0}])"_json;
+
+  res = cli->Post("/SlidingWindowConvexHull/Push", input.dump(),
+                  "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  res = cli->Post("/SlidingWindowConvexHull/Hull",
+                  nlohmann::json({{"id", id}}).dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+  REQUIRE_EQUAL(nlohmann::json::parse(res->body)["size"].get<int>(), 1);
+
+  res = cli->Post("/SlidingWindowConvexHull/Delete",
+                  nlohmann::json({{"id", id}}).dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+}
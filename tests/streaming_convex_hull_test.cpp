@@ -0,0 +1,379 @@
+/**
+ * @file tests/streaming_convex_hull_test.cpp
+ * @author Mikhail Lozhnikov
+ *
+ * Тесты для класса StreamingConvexHull и разбора потока точек.
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <point.hpp>
+#include <predicates.hpp>
+#include <graham_scan.hpp>
+#include <point_stream.hpp>
+#include <streaming_convex_hull.hpp>
+#include <nlohmann/json.hpp>
+#include "test_core.hpp"
+#include "test.hpp"
+
+
+using geometry::Point;
+using geometry::PointFormat;
+using geometry::PointStreamParser;
+using geometry::StreamingConvexHull;
+
+static void ParserTest();
+
+static void ParserErrorTest();
+
+static void RandomTest();
+
+static void FileTest(httplib::Client* cli);
+
+static void UploadTest(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для класса geometry::StreamingConvexHull.
+ */
+void TestStreamingConvexHull() {
+  TestSuite suite("TestStreamingConvexHull");
+
+  RUN_TEST(suite, ParserTest);
+  RUN_TEST(suite, ParserErrorTest);
+  RUN_TEST(suite, RandomTest);
+}
+
+/**
+ * @brief Набор тестов для методов /StreamingConvexHull.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestStreamingConvexHullMethod(httplib::Client* cli) {
+  TestSuite suite("TestStreamingConvexHullMethod");
+
+  RUN_TEST_REMOTE(suite, cli, FileTest);
+  RUN_TEST_REMOTE(suite, cli, UploadTest);
+}
+
+/**
+ * @brief Разбор потока, разрезанного на части всеми возможными способами.
+ */
+static void ParserTest() {
+  const std::string csv = "x,y\n1,2\r\n\n# comment\n-3.5 ; 4e1\n  5\t6  \n7,8";
+  const std::vector<Point<double>> expected = {
+    Point<double>(1.0, 2.0),
+    Point<double>(-3.5, 40.0),
+    Point<double>(5.0, 6.0),
+    Point<double>(7.0, 8.0)
+  };
+
+  std::string binary;
+
+  for (const auto& point : expected) {
+    double coords[2] = {point.X(), point.Y()};
+
+    binary.append(reinterpret_cast<const char*>(coords), sizeof(coords));
+  }
+
+  for (PointFormat format : {PointFormat::Csv, PointFormat::Binary}) {
+    const std::string& data = format == PointFormat::Csv ? csv : binary;
+
+    for (std::size_t step = 1; step <= data.size(); step++) {
+      PointStreamParser<double> parser(format);
+      std::vector<Point<double>> points;
+      auto consume = [&points](const Point<double>& point) {
+        points.push_back(point);
+      };
+
+      for (std::size_t i = 0; i < data.size(); i += step)
+        parser.Feed(data.data() + i, std::min(step, data.size() - i), consume);
+
+      parser.Finish(consume);
+
+      REQUIRE_EQUAL(points.size(), expected.size());
+
+      for (std::size_t i = 0; i < points.size(); i++) {
+        REQUIRE(points[i].X() == expected[i].X());
+        REQUIRE(points[i].Y() == expected[i].Y());
+      }
+    }
+  }
+
+  std::istringstream stream(csv);
+  std::vector<Point<double>> points;
+
+  geometry::ReadPoints<double>(stream, PointFormat::Csv,
+      [&points](const Point<double>& point) { points.push_back(point); }, 3);
+
+  REQUIRE_EQUAL(points.size(), expected.size());
+}
+
+/**
+ * @brief Некорректные данные должны приводить к исключению.
+ */
+static void ParserErrorTest() {
+  auto ignore = [](const Point<double>&) { };
+
+  for (std::string data : {"1,2\n3,\n", "1,2\nx,y\n", "1,2,3\n", "1 2 a",
+                           "1,2\nnan,nan\n", "inf,1\n", "1,2\n3,-inf"}) {
+    PointStreamParser<double> parser(PointFormat::Csv);
+    bool thrown = false;
+
+    try {
+      parser.Feed(data.data(), data.size(), ignore);
+      parser.Finish(ignore);
+    } catch (const std::invalid_argument&) {
+      thrown = true;
+    }
+
+    REQUIRE(thrown);
+  }
+
+  // Строка без символа конца строки не должна накапливаться без ограничения.
+  PointStreamParser<double> longParser(PointFormat::Csv);
+  std::string chunk(100, '1');
+  bool thrown = false;
+
+  try {
+    for (int i = 0; i < 1000; i++)
+      longParser.Feed(chunk.data(), chunk.size(), ignore);
+  } catch (const std::invalid_argument&) {
+    thrown = true;
+  }
+
+  REQUIRE(thrown);
+
+  PointStreamParser<double> parser(PointFormat::Binary);
+  std::string data(2 * sizeof(double) + 1, '\0');
+
+  thrown = false;
+
+  try {
+    parser.Feed(data.data(), data.size(), ignore);
+    parser.Finish(ignore);
+  } catch (const std::invalid_argument&) {
+    thrown = true;
+  }
+
+  REQUIRE(thrown);
+
+  double coords[2] = {1.0, std::numeric_limits<double>::quiet_NaN()};
+  PointStreamParser<double> nanParser(PointFormat::Binary);
+
+  thrown = false;
+
+  try {
+    nanParser.Feed(reinterpret_cast<const char*>(coords), sizeof(coords),
+                   ignore);
+  } catch (const std::invalid_argument&) {
+    thrown = true;
+  }
+
+  REQUIRE(thrown);
+}
+
+/**
+ * @brief Сравнение с geometry::GrahamScan() для разных размеров порции.
+ */
+static void RandomTest() {
+  const int numTries = 30;
+  const std::size_t maxPoints = 5000;
+
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<std::size_t> sizeDist(1, maxPoints);
+  std::uniform_int_distribution<std::size_t> chunkDist(1, 300);
+  std::normal_distribution<double> coordDist(0.0, 100.0);
+  std::uniform_int_distribution<int> gridDist(-5, 5);
+  geometry::AdaptiveOrientationPolicy orientation;
+
+  for (int it = 0; it < numTries; it++) {
+    std::vector<Point<double>> points(sizeDist(gen));
+
+    for (auto& point : points) {
+      if (it % 2 == 0)
+        point = Point<double>(coordDist(gen), coordDist(gen));
+      else
+        point = Point<double>(gridDist(gen), gridDist(gen));
+    }
+
+    std::size_t chunkSize = chunkDist(gen);
+    StreamingConvexHull<double> hull(chunkSize);
+
+    hull.Insert(points.begin(), points.end());
+
+    std::vector<Point<double>> expected = geometry::GrahamScan(points,
+                                                               orientation);
+    const std::vector<Point<double>>& result = hull.Hull();
+
+    REQUIRE_EQUAL(hull.NumPoints(), points.size());
+    // Промежуточные оболочки таких наборов содержат меньше 100 вершин.
+    REQUIRE(hull.PeakPoints() <= chunkSize + 100);
+    REQUIRE_EQUAL(result.size(), expected.size());
+
+    for (std::size_t i = 0; i < result.size(); i++) {
+      REQUIRE(result[i].X() == expected[i].X());
+      REQUIRE(result[i].Y() == expected[i].Y());
+    }
+  }
+}
+
+/**
+ * @brief Оболочка точек из файла на сервере.
+ *
+ * @param cli Указатель на HTTP клиент.
+ *
+ * Предполагается, что сервер запущен на той же машине с каталогом данных
+ * по умолчанию.
+ */
+static void FileTest(httplib::Client* cli) {
+  const int numPoints = 10000;
+
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::filesystem::path directory = std::filesystem::temp_directory_path() /
+                                    "geometry_data";
+  std::filesystem::path path = directory / "geometry_streaming_hull_test.bin";
+  nlohmann::json all;
+
+  std::filesystem::create_directories(directory);
+
+  {
+    std::ofstream file(path, std::ios::out | std::ios::binary);
+
+    for (int i = 0; i < numPoints; i++) {
+      double coords[2] = {coordDist(gen), coordDist(gen)};
+
+      file.write(reinterpret_cast<const char*>(coords), sizeof(coords));
+      all["points"].push_back({{"x", coords[0]}, {"y", coords[1]}});
+    }
+  }
+
+  nlohmann::json input = {
+    {"file", path.string()},
+    {"format", "binary"},
+    {"chunk_size", 1000}
+  };
+
+  httplib::Result res = cli->Post("/StreamingConvexHull", input.dump(),
+                                  "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  all["predicate"] = "exact";
+
+  res = cli->Post("/GrahamScan", all.dump(), "application/json");
+
+  nlohmann::json expected = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["convex_hull"] == expected["convex_hull"]);
+  REQUIRE_EQUAL(output["num_points"].get<int>(), numPoints);
+  REQUIRE(output["peak_points"].get<int>() <= 1000 + 100);
+
+  // Путь относительно каталога данных.
+  input["file"] = path.filename().string();
+  res = cli->Post("/StreamingConvexHull", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  // Файлы вне каталога данных не читаются, даже если они существуют.
+  std::filesystem::path outside = std::filesystem::temp_directory_path() /
+                                  "geometry_streaming_hull_outside.bin";
+
+  std::filesystem::copy_file(path, outside,
+      std::filesystem::copy_options::overwrite_existing);
+
+  for (const std::string& name : {outside.string(),
+                                  "../" + outside.filename().string(),
+                                  directory.string()}) {
+    input["file"] = name;
+    res = cli->Post("/StreamingConvexHull", input.dump(), "application/json");
+
+    REQUIRE_EQUAL(400, res->status);
+
+    output = nlohmann::json::parse(res->body);
+
+    REQUIRE_EQUAL(std::string("Cannot open 'file'"),
+                  output["error"].get<std::string>());
+  }
+
+  std::filesystem::remove(outside);
+  std::filesystem::remove(path);
+
+  input["file"] = path.string();
+  res = cli->Post("/StreamingConvexHull", input.dump(), "application/json");
+
+  REQUIRE_EQUAL(400, res->status);
+}
+
+/**
+ * @brief Оболочка точек из тела запроса.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+static void UploadTest(httplib::Client* cli) {
+  const int numPoints = 2000;
+
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> coordDist(-100.0, 100.0);
+  std::ostringstream csv;
+  nlohmann::json all;
+
+  csv.precision(17);
+  csv << "x,y\n";
+
+  for (int i = 0; i < numPoints; i++) {
+    double x = coordDist(gen);
+    double y = coordDist(gen);
+
+    csv << x << "," << y << "\n";
+    all["points"].push_back({{"x", x}, {"y", y}});
+  }
+
+  httplib::Result res = cli->Post(
+      "/StreamingConvexHull/Upload?format=csv&chunk_size=100",
+      csv.str(), "text/csv");
+
+  REQUIRE_EQUAL(200, res->status);
+
+  nlohmann::json output = nlohmann::json::parse(res->body);
+
+  all["predicate"] = "exact";
+
+  res = cli->Post("/GrahamScan", all.dump(), "application/json");
+
+  nlohmann::json expected = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["convex_hull"] == expected["convex_hull"]);
+  REQUIRE_EQUAL(output["num_points"].get<int>(), numPoints);
+
+  res = cli->Post("/StreamingConvexHull/Upload?format=csv",
+                  "1,2\n3,oops\n", "text/csv");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  // Порция больше допустимой буферизовала бы весь поток.
+  res = cli->Post(
+      "/StreamingConvexHull/Upload?format=csv&chunk_size=16777217",
+      csv.str(), "text/csv");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  // Тело без символа конца строки не должно буферизоваться целиком.
+  res = cli->Post("/StreamingConvexHull/Upload?format=csv",
+                  std::string(1 << 20, '1'), "text/csv");
+
+  REQUIRE_EQUAL(400, res->status);
+
+  output = nlohmann::json::parse(res->body);
+
+  REQUIRE(output["error"].get<std::string>().find("longer than") !=
+          std::string::npos);
+}
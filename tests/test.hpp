@@ -30,6 +30,82 @@ void TestPolygon();
  */
 void TestOrientation();
 
+/**
+ * @brief Набор тестов для класса geometry::PointBuffer.
+ */
+void TestPointBuffer();
+
+/**
+ * @brief Набор тестов для функции geometry::AdaptiveOrientation().
+ */
+void TestPredicates();
+
+/**
+ * @brief Набор тестов для функции geometry::RadixSort().
+ */
+void TestPointSort();
+
+/**
+ * @brief Набор тестов для класса geometry::DynamicConvexHull.
+ */
+void TestDynamicConvexHull();
+
+/**
+ * @brief Набор тестов для класса geometry::StreamingConvexHull.
+ */
+void TestStreamingConvexHull();
+
+/**
+ * @brief Набор тестов для функции geometry::ConvexLayers().
+ */
+void TestConvexLayers();
+
+/**
+ * @brief Набор тестов для функции geometry::RotatingCalipers().
+ */
+void TestRotatingCalipers();
+
+/**
+ * @brief Набор тестов для класса geometry::SlidingWindowConvexHull.
+ */
+void TestSlidingWindowConvexHull();
+
+/**
+ * @brief Набор тестов для функции geometry::WindingNumberPointInPolygon() и
+ * класса geometry::PreparedPolygon.
+ */
+void TestPointInPolygon();
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonLocator.
+ */
+void TestPolygonLocator();
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonGrid.
+ */
+void TestPolygonGrid();
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonSet.
+ */
+void TestPolygonSet();
+
+/**
+ * @brief Набор тестов для класса geometry::PolygonWithHoles.
+ */
+void TestPolygonWithHoles();
+
+/**
+ * @brief Набор тестов для функции TriangulatePolygon().
+ */
+void TestPolygonTriangulation();
+
+/**
+ * @brief Набор тестов для функции TriangulateMonotonePolygon().
+ */
+void TestMonotonePolygonTriangulation();
+
 /* Сюда нужно добавить объявления тестовых функций. */
 
 /**
@@ -40,6 +116,78 @@ void TestOrientation();
 
 void TestGrahamScan(httplib::Client* cli);
 
+/**
+ * @brief Набор тестов для сессий /DynamicConvexHull.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestDynamicConvexHullSession(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для методов /StreamingConvexHull.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestStreamingConvexHullMethod(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для метода /ConvexLayers.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestConvexLayersMethod(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для метода /RotatingCalipers.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestRotatingCalipersMethod(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для сессий /SlidingWindowConvexHull.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestSlidingWindowConvexHullSession(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для параметра "method" метода /AnglePointInPolygon и
+ * метода /PointInPolygonBatch.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestPointInPolygonMethod(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для сессий /PolygonSet.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestPolygonSetSession(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для метода /PointInPolygonWithHoles и параметра
+ * "holes" метода /PointInPolygonBatch.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestPolygonWithHolesMethod(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для метода /Triangulate.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestTriangulateMethod(httplib::Client* cli);
+
+/**
+ * @brief Набор тестов для метода /MonotonePolygonTriangulation.
+ *
+ * @param cli Указатель на HTTP клиент.
+ */
+void TestMonotonePolygonTriangulationMethod(httplib::Client* cli);
+
 /* Конец вставки. */
 
 #endif  // TESTS_TEST_HPP_